@@ -27,7 +27,48 @@ class UnitBase;
 class Map;
 
 class AStarSearch {
+private:
+    struct TileData {
+        Coord   parentCoord;
+        size_t  openListIndex;
+        float   g;
+        float   h;
+        float   f;
+        bool    bInOpenList;
+        bool    bClosed;
+        Uint32  generation;     ///< the search generation this data belongs to
+    };
+
 public:
+
+    /**
+        The Workspace holds all the memory needed by a search. It is owned by the map and reused for every search on this map, so
+        that no memory has to be allocated or cleared per search. Instead of clearing the tile data a generation counter is incremented
+        for each search and tile data with an old generation is treated as if it was zero-initialized.
+    */
+    class Workspace {
+    public:
+        Workspace();
+        ~Workspace();
+
+    private:
+        friend class AStarSearch;
+
+        /**
+            Prepares this workspace for a new search on a map of size sizeX x sizeY.
+            \param  sizeX   the width of the map
+            \param  sizeY   the height of the map
+        */
+        void beginSearch(int sizeX, int sizeY);
+
+        int                 sizeX;              ///< the width of the map this workspace is allocated for
+        int                 sizeY;              ///< the height of the map this workspace is allocated for
+        Uint32              currentGeneration;  ///< the generation of the current search
+        TileData*           mapData;            ///< the search data for every tile
+        std::vector<Coord>  openList;           ///< the open list (as a binary heap); the capacity is kept between searches
+        std::vector<short>  depthCheckCount;    ///< number of closed tiles per distance to the destination
+    };
+
     AStarSearch(Map* pMap, UnitBase* pUnit, Coord start, Coord destination);
     ~AStarSearch();
 
@@ -54,18 +95,26 @@ public:
     };
 
 private:
-    struct TileData {
-        Coord   parentCoord;
-        size_t  openListIndex;
-        float   g;
-        float   h;
-        float   f;
-        bool    bInOpenList;
-        bool    bClosed;
-    };
 
-
-    inline TileData& getMapData(const Coord& coord) const { return mapData[coord.y * sizeX + coord.x]; };
+    /**
+        Returns the search data for the tile at coord. If this tile was not yet touched by the current search its data is reset first.
+        \param coord   the tile to get the data for
+        \return the search data of this tile
+    */
+    inline TileData& getMapData(const Coord& coord) const {
+        TileData& tileData = mapData[coord.y * sizeX + coord.x];
+        if(tileData.generation != generation) {
+            tileData.parentCoord = Coord(0,0);
+            tileData.openListIndex = 0;
+            tileData.g = 0.0f;
+            tileData.h = 0.0f;
+            tileData.f = 0.0f;
+            tileData.bInOpenList = false;
+            tileData.bClosed = false;
+            tileData.generation = generation;
+        }
+        return tileData;
+    };
 
     void trickleUp(size_t openListIndex) {
         Coord bottom = openList[openListIndex];
@@ -177,8 +226,9 @@ private:
     int sizeX;
     int sizeY;
     Coord bestCoord;
+    Uint32 generation;
     TileData* mapData;
-    std::vector<Coord> openList;
+    std::vector<Coord>& openList;
 };
 
 #endif //ASTARSEARCH_H
@@ -0,0 +1,113 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef BUILDSITEGRID_H
+#define BUILDSITEGRID_H
+
+#include <DataTypes.h>
+
+#include <vector>
+
+// forward declarations
+class Map;
+
+/**
+    The BuildSiteGrid caches the information needed to rate and check the places where a structure can be built:
+    - For every house and every tile the number of tiles owned by this house within BUILDRANGE of this tile. The owned tiles are
+      counted when the owner of a tile changes, so isWithinBuildRange() does not have to look at the surrounding tiles.
+    - For every tile the nearest sand tile. This field is recomputed by update() if the terrain of a tile has changed between
+      sand and rock since the last update.
+    The grid is informed about changes by Tile::setOwner(), Tile::setType() and Tile::setSpice().
+*/
+class BuildSiteGrid {
+public:
+    /**
+        Creates an empty grid for pMap. reset() must be called after the tiles of the map are initialized.
+        \param  pMap    the map to cache the build sites of
+    */
+    BuildSiteGrid(Map* pMap);
+    ~BuildSiteGrid();
+
+    /**
+        Rebuilds the whole grid from the tiles of the map (e.g. after loading the map).
+    */
+    void reset();
+
+    /**
+        This method must be called when the owner of a tile has changed.
+        \param  location    the tile that has changed
+        \param  oldOwner    the previous owner of the tile (INVALID if none)
+        \param  newOwner    the new owner of the tile (INVALID if none)
+    */
+    void onTileOwnerChanged(const Coord& location, int oldOwner, int newOwner);
+
+    /**
+        This method must be called when the terrain type of a tile might have changed.
+        \param  location    the tile that has changed
+    */
+    void onTerrainChanged(const Coord& location);
+
+    /**
+        Recomputes the nearest sand tiles if the terrain has changed. This must be called before getNearestSand() is used;
+        it is done by Game::thinkPlayers() before the players think.
+    */
+    void update();
+
+    /**
+        Checks if the tile x,y is within BUILDRANGE of a tile owned by houseID.
+        \param  x       the x coordinate of the tile
+        \param  y       the y coordinate of the tile
+        \param  houseID the house to check for
+        \return true if houseID may build on this tile, false otherwise
+    */
+    bool isWithinBuildRange(int x, int y, int houseID) const;
+
+    /**
+        Returns the sand tile (sand, dunes, spice, ...) that is nearest to location.
+        \param  location    the tile to search from
+        \return the nearest sand tile or Coord::Invalid() if there is no sand on the map
+    */
+    Coord getNearestSand(const Coord& location) const;
+
+private:
+    /**
+        Computes for every tile the nearest tile that is marked in sourceFlags by a breadth first search starting from all of them.
+        \param  sourceFlags the tiles to search for
+        \param  nearestTile the index of the nearest marked tile for every tile (-1 if there is none)
+    */
+    void computeNearestTiles(const std::vector<bool>& sourceFlags, std::vector<Sint32>& nearestTile) const;
+
+    /**
+        Converts the index of a tile as returned by computeNearestTiles() into its location.
+        \param  tileIndex   the index of the tile or -1
+        \return the location of the tile or Coord::Invalid() for -1
+    */
+    Coord getTileLocation(Sint32 tileIndex) const;
+
+    Map*    pMap;                           ///< the map the build sites are cached for
+    int     sizeX;                          ///< the width of the map
+    int     sizeY;                          ///< the height of the map
+
+    std::vector<Uint8>  buildRangeCounts;   ///< for every house and tile the number of owned tiles in build range (indexed by houseID*sizeX*sizeY + tile index)
+
+    std::vector<bool>   sandFlags;          ///< for every tile if it is sand
+    std::vector<Sint32> nearestSandTile;    ///< for every tile the index of the nearest sand tile
+    bool    bSandChanged;                   ///< nearestSandTile has to be recomputed
+};
+
+#endif // BUILDSITEGRID_H
@@ -24,12 +24,13 @@
 #include <ScreenBorder.h>
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
+#include <misc/DenseList.h>
 
 // forward declarations
 class House;
 
 
-class Bullet
+class Bullet : public DenseListElement
 {
 public:
 	Bullet(Uint32 shooterID, Coord* newLocation, Coord* newDestination, Uint32 bulletID, int damage, bool air);
@@ -45,14 +46,14 @@ public:
 	void destroy();
 
 	inline int getBulletID() const { return bulletID; }
-	inline float getRealX() const { return realX; }
-	inline float getRealY() const { return realY; }
+	inline FixPoint getRealX() const { return realX; }
+	inline FixPoint getRealY() const { return realY; }
 
 private:
     // constants for each bullet type
     int     damageRadius;               ///< The radius of the bullet
     bool    explodesAtGroundObjects;    ///< false = bullet goes through objects, true = bullet explodes at ground objects
-    float  speed;                       ///< The speed of this bullet
+    FixPoint speed;                     ///< The speed of this bullet
     Sint8    detonationTimer;            ///< How long is this bullet alive before it explodes
 
     // bullet state
@@ -66,13 +67,13 @@ private:
 	Coord   source;                     ///< the source location (in world coordinates) of this bullet
 	Coord	destination;                ///< the destination (in world coordinates) of this bullet
 	Coord   location;                   ///< the current location of this bullet (in map coordinates)
-	float   realX;                      ///< the x-coordinate of the current position (in world coordinates)
-	float   realY;                      ///< the y-coordinate of the current position (in world coordinates)
+	FixPoint realX;                     ///< the x-coordinate of the current position (in world coordinates)
+	FixPoint realY;                     ///< the y-coordinate of the current position (in world coordinates)
 
-	float   xSpeed;                     ///< Speed in x direction
-	float	ySpeed;                     ///< Speed in x direction
+	FixPoint xSpeed;                    ///< Speed in x direction
+	FixPoint ySpeed;                    ///< Speed in x direction
 
-	float	angle;                      ///< the angle of the bullet
+	FixPoint angle;                     ///< the angle of the bullet (in 256th of a full circle)
 	Sint8   drawnAngle;                 ///< the drawn angle of the bullet
 
 	bool	airAttack;                  ///< Is this an air attack?
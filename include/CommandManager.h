@@ -22,13 +22,28 @@
 
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
+#include <misc/IFileStream.h>
 
 #include <Network/CommandList.h>
 
 #include <vector>
+#include <utility>
+#include <string>
+
+#define REPLAYKEYFRAME          0xFFFFFFFF      ///< written to a replay instead of a game cycle to mark a keyframe
+#define REPLAYKEYFRAMEINDEX     0xFFFFFFFE      ///< written to a replay instead of a game cycle to mark the keyframe index
+#define REPLAYKEYFRAMEMAGIC     0x4D52464B      ///< the last 4 bytes of a replay with a keyframe index
 
 /**
     The command manager collects all the given user commands (e.g. move unit u to position (x,y)) . These commands might be transfered over a network.
+    The commands are kept in a ring buffer of timeslots that only covers the cycles which are not executed yet or which might
+    still have to be sent to another peer. Older cycles are dropped; they are only contained in the replay stream (see setStream()).
+    A replay is read from its stream while it is played (see setReplayStream()).
+
+    A replay file contains the GameInitSettings followed by the commands, each one stored as its game cycle and the command itself.
+    Between the commands keyframes may be stored (REPLAYKEYFRAME, game cycle, savegame as string) which allow starting the replay at
+    this game cycle. At the end of the file there is an index of all keyframes (REPLAYKEYFRAMEINDEX, number of keyframes, game cycle
+    and file position of every keyframe, file position of the index, REPLAYKEYFRAMEMAGIC).
 */
 class CommandManager {
 public:
@@ -54,6 +69,50 @@ public:
     */
 	OutputStream* getStream() const { return pStream; };
 
+    /**
+        This method sets a stream the commands of a replay are read from. The commands are read when their game cycle is executed, so
+        that the complete replay is never held in memory. Commands read from this stream are added even if this command manager is read-only.
+        \param  pReplayStream   pointer to a stream positioned at the first command (the stream must be created with new). NULL for disabling. pReplayStream is deleted with delete if all commands are read or this command manager is destroyed.
+    */
+	void setReplayStream(InputStream* pReplayStream);
+
+    /**
+        Writes a keyframe to the stream set with setStream(). Nothing is written if the stream is not a file stream.
+        \param  CycleNumber the game cycle of the keyframe. The keyframe must be taken before the commands of this cycle are executed.
+        \param  keyframe    the savegame of the current game state
+    */
+	void addKeyframe(Uint32 CycleNumber, const std::string& keyframe);
+
+    /**
+        Writes the index of all keyframes added with addKeyframe() to the stream set with setStream(). No commands or
+        keyframes may be added afterwards.
+    */
+	void writeKeyframeIndex();
+
+    /**
+        Reads the keyframe index at the end of a replay. The read position of stream is not changed. If the replay contains
+        no keyframe index there are no keyframes.
+        \param  stream  the replay to read the index from
+    */
+	void readKeyframeIndex(IFileStream& stream);
+
+    /**
+        Returns the last keyframe at or before the game cycle CycleNumber (see readKeyframeIndex()).
+        \param  CycleNumber the game cycle to search the keyframe for
+        \return the game cycle of the keyframe or 0 if there is none
+    */
+	Uint32 getKeyframeCycle(Uint32 CycleNumber) const;
+
+    /**
+        Reads the last keyframe at or before the game cycle CycleNumber. On success the read position of stream is directly after
+        the keyframe, so that the replay can be continued from there, otherwise the read position is unchanged.
+        \param  stream      the replay to read the keyframe from
+        \param  CycleNumber the game cycle to search the keyframe for
+        \param  keyframe    the savegame stored in the keyframe
+        \return true if a keyframe was read, false otherwise
+    */
+	bool loadKeyframe(IFileStream& stream, Uint32 CycleNumber, std::string& keyframe);
+
     /**
         If bReadOnly == true it is impossible to add new commands to this command manager. This is useful for replays.
         \param  bReadOnly   true = addCommand() is a NO-OP, false = addCommand() has normal behaviour
@@ -67,7 +126,8 @@ public:
 	bool getReadOnly() const { return bReadOnly; };
 
     /**
-        Save all commands to stream. The read-only status is not saved.
+        Save all commands still kept in the ring buffer to stream. The read-only status is not saved. Commands of cycles that
+        are already executed might be missing; they are only contained in the replay stream.
         \param  stream  the stream to write to
     */
 	void save(OutputStream& stream) const;
@@ -113,13 +173,74 @@ public:
         Runs all commands scheduled for game cycle CycleNumber
         \param  CycleNumber the current game cycle
     */
-	void executeCommands(Uint32 CycleNumber) const;
+	void executeCommands(Uint32 CycleNumber);
+
+    /**
+        Checks if there are commands scheduled for CycleNumber or any later cycle. For a replay this is false after the end of the recorded game.
+        \param  CycleNumber the game cycle to check from
+        \return true if there are commands for CycleNumber or later, false otherwise
+    */
+	bool hasCommandsFrom(Uint32 CycleNumber) const {
+        return (pReplayStream != NULL) || (pNextReplayCommand != NULL) || (endCycle > CycleNumber);
+	};
 
 private:
-	std::vector< std::vector<Command> > timeslot;   ///< a vector of vectors containing the scheduled commands. At index x is a list of all commands scheduled for game cycle x.
+    /**
+        Adds a command at the game cycle CycleNumber without checking the read-only status and without writing it to the stream.
+        \param  cmd         the command to add
+        \param  CycleNumber the game cycle this command shall take effect
+    */
+	void insertCommand(const Command& cmd, Uint32 CycleNumber);
+
+    /**
+        Returns the commands scheduled for the game cycle CycleNumber.
+        \param  CycleNumber the game cycle
+        \return the scheduled commands or NULL if there are none
+    */
+	const std::vector<Command>* getTimeslot(Uint32 CycleNumber) const {
+        if((CycleNumber < firstCycle) || (CycleNumber >= endCycle)) {
+            return NULL;
+        }
+        return &timeslot[CycleNumber & (timeslot.size() - 1)];
+	};
+
+    /**
+        Makes the ring buffer big enough to hold all cycles from newFirstCycle to newEndCycle-1.
+        \param  newFirstCycle   the first cycle that shall be contained
+        \param  newEndCycle     the cycle after the last cycle that shall be contained
+    */
+	void resizeTimeslots(Uint32 newFirstCycle, Uint32 newEndCycle);
+
+    /**
+        Drops all cycles before CycleNumber from the ring buffer. No commands can be added for these cycles afterwards.
+        \param  CycleNumber the first cycle to keep
+    */
+	void dropTimeslots(Uint32 CycleNumber);
+
+    /**
+        Drops all cycles up to CycleNumber from the ring buffer that are not needed for resending them to other peers.
+        \param  CycleNumber the game cycle that was executed last
+    */
+	void dropExecutedTimeslots(Uint32 CycleNumber);
+
+    /**
+        Reads all commands up to the game cycle CycleNumber from the replay stream.
+        \param  CycleNumber the game cycle to read the commands for
+    */
+	void readReplayCommands(Uint32 CycleNumber);
+
+	std::vector< std::vector<Command> > timeslot;   ///< a ring buffer containing the scheduled commands. At index (x % timeslot.size()) is a list of all commands scheduled for game cycle x. The size is always a power of two.
+	Uint32 firstCycle;                              ///< the first cycle contained in the ring buffer
+	Uint32 endCycle;                                ///< the cycle after the last cycle with commands (equal to firstCycle if there are no commands)
+	Uint32 firstKeptCycle;                          ///< all cycles before this cycle are dropped
+	Uint32 firstUnacknowledgedCycle;                ///< the first cycle that was not yet acknowledged by all peers
 	OutputStream* pStream;                          ///< a stream all added commands will be written to. May be NULL
+	InputStream* pReplayStream;                     ///< a stream the commands of a replay are read from. May be NULL
+	Command* pNextReplayCommand;                    ///< the command read from pReplayStream that has to be added next. May be NULL
+	Uint32 nextReplayCommandCycle;                  ///< the cycle of pNextReplayCommand
 	bool bReadOnly;                                 ///< true = addCommand() is a NO-OP, false = addCommand() has normal behaviour
 	Uint32 networkCycleBuffer;                      ///< the number of frames a command is given in advance
+	std::vector< std::pair<Uint32, Uint32> > keyframeIndex; ///< the game cycle and the file position of every keyframe in the replay, ordered by game cycle
 };
 
 #endif // COMMANDMANAGER_H
@@ -26,7 +26,7 @@
 #define DEFAULT_METASERVER  "http://dunelegacy.sourceforge.net/metaserver/metaserver.php"
 
 #define SAVEMAGIC           8675309
-#define SAVEGAMEVERSION     9630
+#define SAVEGAMEVERSION     9634
 
 #define MAX_PLAYERNAMELENGHT    24
 
@@ -71,6 +71,7 @@
 #define INVALID (-1)
 
 #define DEVIATIONTIME MILLI2CYCLES(120*1000)
+#define FOGTIME MILLI2CYCLES(10*1000)                 //a tile that was not seen for this time is fogged again
 #define HARVESTERMAXSPICE 700
 #define HARVESTSPEED 0.1344f
 #define BADLYDAMAGEDRATIO 0.5f	                //if health/getMaxHealth() < this, damage will become bad - smoke and shit
@@ -21,10 +21,11 @@
 #include <DataTypes.h>
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
+#include <misc/DenseList.h>
 
 #include <SDL.h>
 
-class Explosion
+class Explosion : public DenseListElement
 {
 public:
     Explosion();
@@ -24,10 +24,14 @@
 #include <SDL.h>
 #include <string>
 #include <vector>
+#include <misc/unordered_map.h>
 
 /// A class for loading all the PAK-Files.
 /**
 	This class manages all the PAK-Files and provides access to the contained files through SDL_RWops.
+	On construction an index of all files in the search path and in the PAK-Files is built, so that a file is found
+	by one case insensitive hash lookup. The files in the search path are preferred over the files in the PAK-Files.
+	Files added to the search path after the construction are not found.
 */
 class FileManager {
 public:
@@ -45,10 +49,41 @@ public:
 	SDL_RWops* openFile(std::string filename);
 
 	bool exists(std::string filename) const;
+
+    /**
+        Returns a checksum of the game data. It is calculated from the MD5 checksums of all loaded PAK-Files and the names, sizes and
+        modification dates of the data files in the search path. It changes whenever the data is replaced or updated, so it can be used to
+        check if data derived from the game data (e.g. the SpriteCache) is still up to date.
+        \return the checksum as a hex string
+    */
+    inline const std::string& getDataChecksum() const { return dataChecksum; }
+
 private:
     std::string md5FromFilename(std::string filename);
 
+    /**
+        Calculates the checksum returned by getDataChecksum().
+        \param  pakChecksums    the MD5 checksums of the loaded PAK-Files concatenated
+    */
+    void calculateDataChecksum(const std::string& pakChecksums);
+
+    /**
+        Builds the index of all files in the search path and in the PAK-Files.
+    */
+    void buildFileIndex();
+
+    /// Where a file is found
+    struct FileLocation {
+        FileLocation() : pPakfile(NULL), pakIndex(0) { }
+
+        std::string     externalFilepath;   ///< the path of the file in the search path (empty if there is none)
+        Pakfile*        pPakfile;           ///< the PAK-File containing the file (NULL if there is none)
+        unsigned int    pakIndex;           ///< the index of the file inside pPakfile
+    };
+
 	std::vector<Pakfile*> pakFiles;
+	std::string dataChecksum;           ///< the checksum of the game data (see getDataChecksum())
+	std::unordered_map<std::string, FileLocation> fileIndex;    ///< all files by their lower case name
 };
 
 #endif // FILEMANAGER_H
@@ -19,16 +19,23 @@
 #define GFXMANAGER_H
 
 #include <SDL.h>
+#include <SDL_thread.h>
 #include "Animation.h"
 #include "Shpfile.h"
 #include "Wsafile.h"
+#include "Icnfile.h"
+#include "Palette.h"
 #include <DataTypes.h>
+#include <misc/draw_util.h>
 
 #include <string>
+#include <vector>
+#include <map>
 #include <misc/memory.h>
 
 #define NUM_MAPCHOICEPIECES	28
 #define NUM_MAPCHOICEARROWS	9
+#define NUM_FOGTILES        16
 
 // ObjPics
 typedef enum {
@@ -426,7 +433,18 @@ typedef enum {
 	NUM_ANIMATION
 } Animation_enum;
 
+// forward declarations
+class PictureFactory;
+class SpriteCache;
 
+/**
+    The GFXManager provides all graphics of the game. Every picture is only loaded (decoded, scaled and converted to the
+    display format) when it is requested the first time. All zoom levels of a picture are loaded together because the
+    objects keep the returned arrays.
+    If the screen is a software surface a background thread decodes the pictures in advance, starting with the ones needed
+    by the menu. The conversion to the display format is always done by the main thread.
+    The decoded and scaled object pictures are kept in a SpriteCache so that they are not decoded again on the next start.
+*/
 class GFXManager {
 public:
 	GFXManager();
@@ -442,14 +460,107 @@ public:
 	SDL_Surface*    getTransparent40Surface() { return pTransparent40Surface; };
 	SDL_Surface*    getTransparent150Surface() { return pTransparent150Surface; };
 
+    /**
+        Returns the pixels of a fog tile (see ObjPic_Terrain_HiddenFog) that are darkened by the fog of war.
+        \param  fogTile     the fog tile
+        \param  zoomlevel   the zoom level
+        \return the mask of this fog tile
+    */
+	const std::vector<MaskSpan>& getFogMask(int fogTile, int zoomlevel) {
+	    if(objPicState[ObjPic_Terrain_HiddenFog] != AssetState_Ready) {
+            getObjPic(ObjPic_Terrain_HiddenFog);
+	    }
+	    return fogMask[fogTile][zoomlevel];
+	};
+
+    /**
+        Returns a color map that has the same effect as blitting the transparent 40 surface over a pixel of the screen.
+        The color map is recalculated if the screen surface or its palette has changed.
+        \return the color map (256 entries)
+    */
+	const Uint8*    getTransparent40ColorMap();
+
 	Animation*		getAnimation(unsigned int id);
 
 private:
+    /// The loading state of a picture
+    typedef enum {
+        AssetState_NotLoaded,       ///< nothing is loaded yet
+        AssetState_Built,           ///< the picture is decoded but not yet converted to the display format
+        AssetState_Ready            ///< the picture is in the display format and can be used
+    } AssetState;
+
+    /**
+        Loads the object picture id with all zoom levels from the sprite cache or decodes it if it is not cached. The assetMutex must be locked.
+        \param  id  the id of the object picture
+    */
+    void buildObjPic(unsigned int id);
+
+    /**
+        Decodes the object picture id with all zoom levels from the game data.
+        \param  id  the id of the object picture
+    */
+    void decodeObjPic(unsigned int id);
+
+    /**
+        Converts the object picture id to the display format. Must be called by the main thread with the assetMutex locked.
+        \param  id  the id of the object picture
+    */
+    void publishObjPic(unsigned int id);
+
+    /**
+        Decodes the ui graphic id and all ui graphics that are created together with it. The assetMutex must be locked.
+        \param  id  the id of the ui graphic
+    */
+    void buildUIGraphic(unsigned int id);
+
+    /**
+        Converts the ui graphic id to the display format. Must be called by the main thread with the assetMutex locked.
+        \param  id  the id of the ui graphic
+    */
+    void publishUIGraphic(unsigned int id);
+
+    /**
+        Decodes the small detail picture id. The assetMutex must be locked.
+        \param  id  the id of the small detail picture
+    */
+    void buildSmallDetailPic(unsigned int id);
+
+    /**
+        Converts the small detail picture id to the display format. Must be called by the main thread with the assetMutex locked.
+        \param  id  the id of the small detail picture
+    */
+    void publishSmallDetailPic(unsigned int id);
+
+    /**
+        Loads all map choice pieces and arrows if they are not loaded yet. Must be called by the main thread.
+    */
+    void loadMapChoiceGraphics();
+
+    /**
+        The main function of the thread that decodes the pictures in advance.
+        \param  data    the GFXManager
+        \return always 0
+    */
+    static int prewarmThreadMain(void* data);
+
 	Animation* loadAnimationFromWsa(std::string filename);
 
     std::shared_ptr<Shpfile>  loadShpfile(std::string filename);
     std::shared_ptr<Wsafile>  loadWsafile(std::string filename);
 
+    /**
+        Returns the shp file filename. Every shp file is only read once. The assetMutex must be locked.
+        \param  filename    the name of the shp file
+        \return the shp file
+    */
+    std::shared_ptr<Shpfile>  getShpfile(std::string filename);
+
+    std::shared_ptr<Shpfile>  getChoamShpfile();
+    std::shared_ptr<Shpfile>  getMentatShpfile();
+    std::shared_ptr<Icnfile>  getIcnfile();
+    std::shared_ptr<PictureFactory>  getPictureFactory();
+
 	SDL_Surface*	extractSmallDetailPic(std::string filename);
 
 	SDL_Surface*	objPic[NUM_OBJPICS][(int) NUM_HOUSES][NUM_ZOOMLEVEL];
@@ -459,8 +570,29 @@ private:
 	SDL_Surface*	mapChoiceArrows[NUM_MAPCHOICEARROWS];
 	Animation*		animation[NUM_ANIMATION];
 
+	Uint8           objPicState[NUM_OBJPICS];                       ///< the AssetState of every object picture
+	Uint8           smallDetailPicState[NUM_SMALLDETAILPICS];       ///< the AssetState of every small detail picture
+	Uint8           uiGraphicState[NUM_UIGRAPHICS];                 ///< the AssetState of every ui graphic
+	bool            bMapChoiceGraphicsLoaded;                       ///< are the map choice pieces and arrows loaded?
+
+	std::map<std::string, std::shared_ptr<Shpfile> > shpfiles;      ///< all shp files read so far
+	std::shared_ptr<Icnfile>        icnfile;                        ///< ICON.ICN (read on first use)
+	std::shared_ptr<PictureFactory> pictureFactory;                 ///< created on first use
+	Palette         benePalette;                                    ///< the palette of the Bene Gesserit mentat
+	SpriteCache*    pSpriteCache;                                   ///< the decoded object pictures of the last start
+	std::string     languageFileExtension;                          ///< the file extension of the language specific files
+
+	SDL_mutex*      assetMutex;                                     ///< guards everything that is not AssetState_Ready yet
+	SDL_Thread*     prewarmThread;                                  ///< the thread that decodes pictures in advance (NULL if not running)
+	bool            bStopPrewarming;                                ///< tells the prewarm thread to stop (guarded by assetMutex)
+
 	SDL_Surface*    pTransparent40Surface;
 	SDL_Surface*    pTransparent150Surface;
+
+	std::vector<MaskSpan>   fogMask[NUM_FOGTILES][NUM_ZOOMLEVEL];   ///< the pixels of every fog tile that are darkened
+	Uint8           transparent40ColorMap[256];                     ///< the color map returned by getTransparent40ColorMap()
+	SDL_Surface*    pTransparent40ColorMapScreen;                   ///< the screen surface transparent40ColorMap was calculated for
+	SDL_Color       transparent40ColorMapPalette[256];              ///< the palette of the screen transparent40ColorMap was calculated for
 };
 
 #endif // GFXMANAGER_H
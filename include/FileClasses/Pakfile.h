@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <SDL_rwops.h>
+#include <SDL_thread.h>
 #include <string>
 #include <vector>
 #include <inttypes.h>
@@ -29,7 +30,9 @@
 ///	A class for reading PAK-Files.
 /**
 	This class can be used to read PAK-Files. PAK-Files are archive files used by Dune2.
-	The files inside the PAK-File can an be read through SDL_RWops.
+	The files inside the PAK-File can an be read through SDL_RWops. If possible the PAK-File is mapped into memory and
+	opened files are read-only views of the mapped data. Otherwise all opened files share one file handle, so reading
+	from them is serialized and files of the same PAK-File can be read from different threads.
 */
 class Pakfile
 {
@@ -64,6 +67,8 @@ public:
 
 	SDL_RWops* openFile(std::string filename);
 
+	SDL_RWops* openFile(unsigned int index);
+
 	bool exists(std::string filename) const;
 
 	void addFile(SDL_RWops* rwop, std::string filename);
@@ -76,8 +81,13 @@ private:
 
 	void readIndex();
 
+	void mapFile();
+
 	bool write;
 	SDL_RWops * fPakFile;
+	SDL_mutex * fileMutex;          ///< guards the position of fPakFile while reading (only used when reading)
+	const char* pMappedData;        ///< the whole PAK-File mapped into memory (NULL if not mapped)
+	size_t mappedSize;              ///< the size of pMappedData
 	std::string filename;
 
 	char* writeOutData;
@@ -0,0 +1,111 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SPRITECACHE_H
+#define SPRITECACHE_H
+
+#include <SDL.h>
+
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+
+#define SPRITECACHEFILENAME "spritecache.bin"
+#define SPRITECACHEVERSION  1
+
+/**
+    The SpriteCache keeps decoded and scaled 8-bit pictures in a file in the user directory, so that they do not have to be
+    decoded again on the next start. Every picture is stored together with its palette under a numeric id.
+    The file is only used if it was written for the same key (e.g. the checksum of the game data and the used scaler); otherwise
+    it is ignored and rewritten. On startup the file is mapped into memory (or read completely on systems without mmap) and the
+    new pictures are written back when the cache is destroyed.
+*/
+class SpriteCache {
+public:
+    /**
+        Opens the cache file. If it does not exist, is damaged or was written for another key the cache starts empty.
+        \param  filename    the path of the cache file
+        \param  key         describes everything the cached pictures depend on
+    */
+    SpriteCache(const std::string& filename, const std::string& key);
+
+    /**
+        Writes the cache file if new pictures were added.
+    */
+    ~SpriteCache();
+
+    /**
+        Checks if a picture with this id is stored.
+        \param  id  the id of the picture
+        \return true if the picture is stored (it may be a stored NULL picture)
+    */
+    bool contains(Uint32 id) const;
+
+    /**
+        Creates a new surface with the picture stored for id.
+        \param  id  the id of the picture
+        \return the new surface (the caller has to free it) or NULL if the picture is not stored or NULL was stored
+    */
+    SDL_Surface* getSurface(Uint32 id) const;
+
+    /**
+        Stores a copy of pSurface as the picture with this id. Only 8-bit surfaces can be stored; other surfaces are ignored.
+        \param  id          the id of the picture
+        \param  pSurface    the picture to store (may be NULL)
+    */
+    void addSurface(Uint32 id, SDL_Surface* pSurface);
+
+    /**
+        Writes the cache file if new pictures were added since it was read or written the last time.
+    */
+    void save();
+
+private:
+    /// A picture inside the cache
+    struct Entry {
+        Uint16          w;              ///< the width of the picture
+        Uint16          h;              ///< the height of the picture (0 if NULL was stored)
+        Uint16          numColors;      ///< the number of palette entries
+        const Uint8*    pData;          ///< the palette (4 bytes per color) followed by w*h pixels
+    };
+
+    /**
+        Reads the index of the cache file from fileData.
+        \return true if the file is valid and was written for key
+    */
+    bool readIndex();
+
+    /**
+        Unmaps or frees the data of the cache file.
+    */
+    void closeFile();
+
+    std::string     filename;                       ///< the path of the cache file
+    std::string     key;                            ///< the key of this cache
+    bool            bModified;                      ///< were pictures added since the file was read or written?
+
+    const Uint8*    pFileData;                      ///< the content of the cache file (NULL if there is none)
+    size_t          fileSize;                       ///< the size of the cache file
+    bool            bFileMapped;                    ///< is pFileData mapped into memory (otherwise it is in fileBuffer)
+    std::vector<Uint8>  fileBuffer;                 ///< the content of the cache file if it could not be mapped
+
+    std::map<Uint32, Entry>             entries;    ///< all stored pictures
+    std::list< std::vector<Uint8> >     newData;    ///< the data of the pictures added since the file was read
+};
+
+#endif // SPRITECACHE_H
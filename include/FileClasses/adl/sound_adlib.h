@@ -46,8 +46,17 @@
 #include <inttypes.h>
 #include <vector>
 #include <SDL.h>
+#include <SDL_thread.h>
 #include <SDL_mixer.h>
 
+#include <misc/RingBuffer.h>
+
+/// the number of samples synthesized or converted at once
+#define ADLIB_CHUNKSIZE			512
+
+/// the number of samples the synthesis thread synthesizes ahead of playback (must be a power of two)
+#define ADLIB_RINGBUFFERSIZE	8192
+
 class AdlibDriver;
 
 /**
@@ -69,6 +78,15 @@ public:
 
 	static void callback(void *, Uint8 *, int);
 
+	/**
+	 * Starts a thread that synthesizes the music ahead of playback into a ring buffer.
+	 * Afterwards callback() only converts the buffered samples into the output format
+	 * and neither blocks nor allocates memory. Without this thread the music is
+	 * synthesized inside callback().
+	 * @return true on success, false if the thread cannot be started
+	 */
+	bool startSynthesisThread();
+
 	std::vector<int> getSubsongs();
 
 	bool init();
@@ -97,6 +115,27 @@ private:
 	void unk1();
 	void unk2();
 
+	/**
+	 * Stops the synthesis thread if it is running.
+	 */
+	void stopSynthesisThread();
+
+	/**
+	 * The main function of the synthesis thread.
+	 * @param data	the SoundAdlibPC
+	 * @return always 0
+	 */
+	static int synthesisThreadMain(void* data);
+
+	/**
+	 * Converts mono samples into the output format and applies the volume.
+	 * @param pSamples		the samples to convert
+	 * @param numSamples	the number of samples
+	 * @param pOutput		the converted samples are written here (numSamples*getsampsize() bytes)
+	 * @return false if the output format is not supported
+	 */
+	bool convertSamples(const Sint16* pSamples, int numSamples, Uint8* pOutput);
+
 	AdlibDriver *_driver;
 
 	uint8_t _trackEntries[500];
@@ -120,6 +159,13 @@ private:
 	bool bJustStartedPlaying;
 
 	int volume;
+
+	SDL_mutex* driverMutex;						///< protects _driver against concurrent use by the synthesis thread
+	SDL_Thread* synthesisThread;				///< the synthesis thread or NULL if the music is synthesized in callback()
+	volatile bool bStopSynthesis;				///< tells the synthesis thread to quit
+	RingBuffer<Sint16>* pRingBuffer;			///< the samples synthesized ahead of playback (only used with the synthesis thread)
+	Sint16 synthesisBuffer[ADLIB_CHUNKSIZE];	///< the samples synthesized by the synthesis thread before they are added to pRingBuffer
+	Sint16 callbackBuffer[ADLIB_CHUNKSIZE];		///< the samples callback() currently converts
 };
 
 #endif
@@ -19,12 +19,15 @@
 #define GAME_H
 
 #include <misc/Random.h>
-#include <misc/RobustList.h>
+#include <misc/DenseList.h>
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
 #include <ObjectData.h>
 #include <ObjectManager.h>
+#include <RenderList.h>
 #include <CommandManager.h>
+#include <SyncManager.h>
+#include <misc/WorkerPool.h>
 #include <GameInterface.h>
 #include <INIMap/INIMapLoader.h>
 #include <GameInitSettings.h>
@@ -51,6 +54,8 @@ class Explosion;
 
 #define END_WAIT_TIME				(6*1000)
 
+#define REPLAYKEYFRAMEINTERVAL		((60*1000)/GAMESPEED_DEFAULT)    ///< the number of game cycles between two keyframes in a replay
+
 #define GAME_NOTHING			-1
 #define	GAME_RETURN_TO_MENU		0
 #define GAME_NEXTMISSION		1
@@ -83,8 +88,9 @@ public:
 	/**
         Initializes a replay from the specified filename
         \param  filename    the file containing the replay
+        \param  startCycle  the game cycle to start the replay at. The replay is loaded from the closest keyframe before and the remaining cycles are skipped.
 	*/
-	void initReplay(const std::string& filename);
+	void initReplay(const std::string& filename, Uint32 startCycle = 0);
 
 
 
@@ -96,6 +102,12 @@ public:
     */
 	void processObjects();
 
+    /**
+        This method lets all players that want to think in this game tick think in parallel and then executes their actions
+        in the order of the houses and players. It should be executed exactly once per game tick before the houses are updated.
+    */
+	void thinkPlayers();
+
     /**
         This method draws a complete frame.
     */
@@ -134,7 +146,7 @@ public:
         Get the explosion list.
         \return the explosion list
 	*/
-	RobustList<Explosion*>& getExplosionList() { return explosionList; };
+	DenseList<Explosion*>& getExplosionList() { return explosionList; };
 
 	/**
         Returns the house with the id houseID
@@ -191,11 +203,40 @@ public:
     */
 	bool saveGame(std::string filename);
 
+    /**
+        This method saves the current running game.
+        \param stream the stream to save to
+        \return true on success, false on failure
+    */
+	bool saveGame(OutputStream& stream);
+
     /**
         This method starts the game. Will return when the game is finished or aborted.
     */
 	void runMainLoop();
 
+    /**
+        This method simulates the replay loaded with initReplay() as fast as possible. Nothing is drawn and no input is processed.
+        Afterwards the simulation speed, the time spent in every phase of a game cycle and the hash of the final game state
+        are printed to stdout.
+        \param  maxCycles   the maximum number of game cycles to simulate (0 = until the game is finished or the last recorded command is executed)
+        \return the hash of the final game state (see getGameStateHash())
+    */
+	std::string runBenchmark(Uint32 maxCycles);
+
+    /**
+        Computes a hash of the simulated game state (houses, map, objects, bullets, explosions, triggers and the random
+        generator). Settings that only concern the local player (e.g. the screen position or the selection) are not included.
+        \return the md5 hash of the game state as a hex string
+    */
+	std::string getGameStateHash() const;
+
+    /**
+        Returns the game cycle this replay shall be restarted at. The replay is quit when the player skips past the next keyframe.
+        \return the game cycle to pass to initReplay() for the next replay or 0 if the replay shall not be restarted
+    */
+	Uint32 getReplaySeekCycle() const { return replaySeekCycle; };
+
 	inline void quitGame() { bQuitGame = true;};
 
     /**
@@ -431,6 +472,18 @@ private:
     */
     void handleKeyInput(SDL_KeyboardEvent& keyboardEvent);
 
+    /**
+        Skips all game cycles until cycle. In a replay with a keyframe between the current game cycle and cycle the replay is
+        restarted from this keyframe instead (see getReplaySeekCycle()).
+        \param  cycle   the game cycle to skip to
+    */
+    void skipToCycle(Uint32 cycle);
+
+    /**
+        Applies the game options of the settings (e.g. the scroll speed or the volume) to this game.
+    */
+    void applyGameOptions();
+
     /**
         Performs a building placement
         \param  xPos    x-coordinate in map coordinates
@@ -525,6 +578,7 @@ private:
 	Uint32      gameCycleCount;
 
 	Uint32      skipToGameCycle;    ///< skip to this game cycle
+	Uint32      replaySeekCycle;    ///< restart the replay at this game cycle (0 = no restart)
 
 	SDL_Rect	powerIndicatorPos;  ///< position of the power indicator in the right game bar
 	SDL_Rect	spiceIndicatorPos;  ///< position of the spice indicator in the right game bar
@@ -540,7 +594,12 @@ private:
 
 	ObjectManager       objectManager;          ///< This manages all the object and maps object ids to the actual objects
 
+	RenderList          renderList;             ///< The tiles and objects visible in the current frame sorted by layer
+
 	CommandManager      cmdManager;			    ///< This is the manager for all the game commands (e.g. moving a unit)
+	SyncManager         syncManager;            ///< This checks in network games that all peers have the same game state
+
+	WorkerPool          thinkWorkerPool;        ///< The threads the players think on
 
 	TriggerManager      triggerManager;         ///< This is the manager for all the triggers the scenario has (e.g. reinforcements)
 
@@ -570,7 +629,7 @@ private:
 	bool    bSelectionChanged;                          ///< Has the selected list changed (and must be retransmitted to other plays in multiplayer games)
 	std::set<Uint32> selectedList;                      ///< A set of all selected units/structures
 	std::set<Uint32> selectedByOtherPlayerList;         ///< This is only used in multiplayer games where two players control one house
-    RobustList<Explosion*> explosionList;               ///< A list containing all the explosions that must be drawn
+    DenseList<Explosion*> explosionList;                ///< A list containing all the explosions that must be drawn
 
     std::vector<House*> house;                          ///< All the houses of this game, index by their houseID; has the size NUM_HOUSES; unused houses are NULL
 
@@ -19,6 +19,12 @@
 #define MAP_H
 
 #include <Tile.h>
+#include <AStarSearch.h>
+#include <PathClusterGraph.h>
+#include <SpatialObjectIndex.h>
+#include <RadarTileTracker.h>
+#include <BuildSiteGrid.h>
+#include <SpiceIndex.h>
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
 
@@ -35,7 +41,7 @@ public:
 	void save(OutputStream& stream) const;
 
 	void createSandRegions();
-	void damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Uint32 bulletID, float damage, int damageRadius, bool air);
+	void damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Uint32 bulletID, FixPoint damage, int damageRadius, bool air);
 	Coord getMapPos(int angle, const Coord& source) const;
 	void removeObjectFromMap(Uint32 objectID);
 	void spiceRemoved(const Coord& coord);
@@ -98,11 +104,97 @@ public:
 		return getTile(location.x, location.y);
 	}
 
+    /**
+        Returns the workspace that is reused by all path searches on this map.
+        \return the path search workspace
+    */
+    inline AStarSearch::Workspace& getAStarSearchWorkspace() {
+        return aStarSearchWorkspace;
+    }
+
+    /**
+        Returns the hierarchical graph used to speed up long path searches on this map.
+        \return the path cluster graph
+    */
+    inline PathClusterGraph& getPathClusterGraph() {
+        return pathClusterGraph;
+    }
+
+    /**
+        Returns the index of all objects on this map that is used to find close targets.
+        \return the spatial object index
+    */
+    inline SpatialObjectIndex& getSpatialObjectIndex() {
+        return spatialObjectIndex;
+    }
+
+    /**
+        Updates all tiles that have tracks or dead units that have to decay. This is called once every game cycle.
+        Tiles without tracks or dead units are not touched.
+    */
+    void updateTiles();
+
+    /**
+        Adds the tile at location to the tiles that are updated by updateTiles(). This is called by the tile when tracks or
+        dead units are added. The tile is removed automatically when all tracks and dead units have decayed.
+        \param location    the tile to update every game cycle
+    */
+    void addActiveTile(const Coord& location);
+
+    /**
+        Returns the tracker for the tiles whose radar color has changed.
+        \return the radar tile tracker
+    */
+    inline RadarTileTracker& getRadarTileTracker() {
+        return radarTileTracker;
+    }
+
+    /**
+        Returns the cached information about the places where structures can be built.
+        \return the build site grid
+    */
+    inline BuildSiteGrid& getBuildSiteGrid() {
+        return buildSiteGrid;
+    }
+
+    /**
+        Returns the cached information about the places where structures can be built.
+        \return the build site grid
+    */
+    inline const BuildSiteGrid& getBuildSiteGrid() const {
+        return buildSiteGrid;
+    }
+
+    /**
+        Returns the index of the spice tiles on this map.
+        \return the spice index
+    */
+    inline SpiceIndex& getSpiceIndex() {
+        return spiceIndex;
+    }
+
+    /**
+        Returns the index of the spice tiles on this map.
+        \return the spice index
+    */
+    inline const SpiceIndex& getSpiceIndex() const {
+        return spiceIndex;
+    }
+
 private:
 	Sint32	sizeX;                          ///< number of tiles this map is wide (read only)
 	Sint32  sizeY;                          ///< number of tiles this map is high (read only)
 	Tile*   tiles;                          ///< the 2d-array containing all the tiles of the map
 	ObjectBase* lastSinglySelectedObject;   ///< The last selected object. If selected again all units of the same type are selected
+
+	AStarSearch::Workspace aStarSearchWorkspace;    ///< memory reused by all path searches on this map
+	PathClusterGraph pathClusterGraph;              ///< the hierarchical graph for long path searches
+	SpatialObjectIndex spatialObjectIndex;          ///< the objects on this map sorted by their position
+	RadarTileTracker radarTileTracker;              ///< the tiles that have to be redrawn on the radar
+	BuildSiteGrid buildSiteGrid;                    ///< the build range of the houses and the nearest sand of every tile
+	SpiceIndex spiceIndex;                          ///< the tiles that have spice
+	std::vector<Tile*> activeTiles;                 ///< the tiles that have tracks or dead units that have to decay
+	std::vector<bool> activeTileFlags;              ///< for every tile if it is contained in activeTiles
 };
 
 
@@ -26,6 +26,11 @@
 #include <SDL.h>
 #include <vector>
 
+/**
+    A CommandList contains the commands of one player for the game cycles firstCycle to endCycle-1. Only cycles with commands
+    have an entry, all other cycles in this range are empty. Additionally it acknowledges to the receiver up to which cycle
+    the commands of the receiver have arrived.
+*/
 class CommandList {
 public:
     class CommandListEntry {
@@ -57,10 +62,15 @@ public:
         std::vector<Command> commands;
     };
 
-    CommandList() {
+    CommandList()
+     : firstCycle(0), endCycle(0), acknowledgedCycle(0) {
     }
 
     CommandList(InputStream& stream) {
+        firstCycle = stream.readUint32();
+        endCycle = stream.readUint32();
+        acknowledgedCycle = stream.readUint32();
+
         Uint32 numCommandListEntries = stream.readUint32();
         for(Uint32 i = 0; i < numCommandListEntries; i++) {
             commandList.push_back(CommandListEntry(stream));
@@ -72,6 +82,10 @@ public:
     }
 
     void save(OutputStream& stream) const {
+        stream.writeUint32(firstCycle);
+        stream.writeUint32(endCycle);
+        stream.writeUint32(acknowledgedCycle);
+
         stream.writeUint32((Uint32) commandList.size());
 
         std::vector<CommandListEntry>::const_iterator iter;
@@ -80,7 +94,10 @@ public:
         }
     }
 
-    std::vector<CommandListEntry> commandList;
+    Uint32 firstCycle;                          ///< the first cycle contained in this list
+    Uint32 endCycle;                            ///< the cycle after the last cycle contained in this list
+    Uint32 acknowledgedCycle;                   ///< the commands of the receiver of this list have arrived for all cycles before this cycle
+    std::vector<CommandListEntry> commandList;  ///< the cycles that contain commands (in ascending order)
 };
 
 #endif //COMMANDLIST_H
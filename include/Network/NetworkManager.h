@@ -32,6 +32,7 @@
 #include <SDL.h>
 #include <string>
 #include <list>
+#include <vector>
 #include <stdarg.h>
 
 #define NETWORKDISCONNECT_QUIT              1
@@ -50,6 +51,9 @@
 #define NETWORKPACKET_STARTGAME             8
 #define NETWORKPACKET_COMMANDLIST           9
 #define NETWORKPACKET_SELECTIONLIST         10
+#define NETWORKPACKET_SYNCCHECK             11
+#define NETWORKPACKET_SYNCREQUEST           12
+#define NETWORKPACKET_SYNCRESPONSE          13
 
 #define AWAITING_CONNECTION_TIMEOUT	    5000
 
@@ -79,10 +83,16 @@ public:
 
 	void sendStartGame(unsigned int timeLeft);
 
-	void sendCommandList(const CommandList& commandList);
+	void sendCommandList(const std::string& peerName, const CommandList& commandList);
 
     void sendSelectedList(const std::set<Uint32>& selectedList, int groupListIndex = -1);
 
+	void sendSyncCheck(Uint32 cycle, Uint32 hash);
+
+	void sendSyncRequest(const std::string& peerName, Uint32 cycle, Sint32 bucket);
+
+	void sendSyncResponse(const std::string& peerName, Uint32 cycle, Sint32 bucket, const std::vector<Uint32>& hashes);
+
 	std::list<std::string> getConnectedPeers() const {
         std::list<std::string> peerNameList;
 
@@ -173,6 +183,30 @@ public:
         this->pOnReceiveSelectionList = pOnReceiveSelectionList;
 	}
 
+	/**
+		Sets the function that should be called when the game state hash of a peer is received.
+		\param	pOnReceiveSyncCheck	function to call on receive
+	*/
+	inline void setOnReceiveSyncCheck(std::function<void (const std::string&, Uint32, Uint32)> pOnReceiveSyncCheck) {
+        this->pOnReceiveSyncCheck = pOnReceiveSyncCheck;
+	}
+
+	/**
+		Sets the function that should be called when a peer requests detailed game state hashes.
+		\param	pOnReceiveSyncRequest	function to call on receive
+	*/
+	inline void setOnReceiveSyncRequest(std::function<void (const std::string&, Uint32, Sint32)> pOnReceiveSyncRequest) {
+        this->pOnReceiveSyncRequest = pOnReceiveSyncRequest;
+	}
+
+	/**
+		Sets the function that should be called when detailed game state hashes of a peer are received.
+		\param	pOnReceiveSyncResponse	function to call on receive
+	*/
+	inline void setOnReceiveSyncResponse(std::function<void (const std::string&, Uint32, Sint32, const std::vector<Uint32>&)> pOnReceiveSyncResponse) {
+        this->pOnReceiveSyncResponse = pOnReceiveSyncResponse;
+	}
+
 private:
     static void debugNetwork(const char* fmt, ...);
 
@@ -232,6 +266,9 @@ private:
     std::function<void (unsigned int)>                              pOnStartGame;
     std::function<void (const std::string&, const CommandList&)>    pOnReceiveCommandList;
     std::function<void (std::string, std::set<Uint32>, int)>        pOnReceiveSelectionList;
+    std::function<void (const std::string&, Uint32, Uint32)>        pOnReceiveSyncCheck;
+    std::function<void (const std::string&, Uint32, Sint32)>        pOnReceiveSyncRequest;
+    std::function<void (const std::string&, Uint32, Sint32, const std::vector<Uint32>&)>    pOnReceiveSyncResponse;
 
 	LANGameFinderAndAnnouncer*	pLANGameFinderAndAnnouncer;
 	MetaServerClient*           pMetaServerClient;
@@ -25,6 +25,7 @@
 #include <mmath.h>
 
 #include <globals.h>
+#include <misc/DenseList.h>
 
 #include <algorithm>
 
@@ -43,7 +44,7 @@ template<class WidgetData> class Container;
 /*!
 	Class from which all structure and unit classes are derived
 */
-class ObjectBase
+class ObjectBase : public DenseListElement
 {
 public:
 
@@ -162,8 +163,8 @@ public:
     int getWeaponReloadTime() const;
     int getInfSpawnProp() const;
 
-	inline float getRealX() const { return realX; }
-	inline float getRealY() const { return realY; }
+	inline FixPoint getRealX() const { return realX; }
+	inline FixPoint getRealY() const { return realY; }
 	inline const Coord& getLocation() const { return location; }
 	inline const Coord& getDestination() const { return destination; }
 	inline ObjectBase* getTarget() { return target.getObjPointer(); }
@@ -204,8 +205,8 @@ protected:
     Coord   location;               ///< The current position of this object in tile coordinates
     Coord   oldLocation;            ///< The previous position of this object in tile coordinates (used when moving from one tile to the next tile)
     Coord   destination;            ///< The destination tile
-    float   realX;                  ///< The x-coordinate of this object in world coordinates
-    float   realY;                  ///< The y-coordinate of this object in world coordinates
+    FixPoint realX;                 ///< The x-coordinate of this object in world coordinates
+    FixPoint realY;                 ///< The y-coordinate of this object in world coordinates
 
     float   angle;                  ///< The current angle of this unit/structure
     Sint8   drawnAngle;             ///< The angle this unit/structure is drawn with. (e.g. 0 to 7)
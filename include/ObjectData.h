@@ -24,6 +24,7 @@
 #include <misc/OutputStream.h>
 #include <data.h>
 #include <DataTypes.h>
+#include <misc/FixPoint.h>
 
 #include <bitset>
 
@@ -94,7 +95,7 @@ public:
         Sint32 weapondamage;                                        ///< how much damage does the weapon of this unit/structure have?
         Sint32 weaponrange;                                         ///< how far can this unit/structure shoot?
         Sint32 weaponreloadtime;                                    ///< how many frames does it take to reload the weapon?
-        float  maxspeed;                                            ///< how fast can this unit move?
+        FixPoint maxspeed;                                          ///< how fast can this unit move? (a FixPoint because unit movement is synchronized between players)
         float  turnspeed;                                           ///< how fast can this unit turn around?
         Sint32 buildtime;                                           ///< how much time does the production of this structure/unit take?
         Sint32 infspawnprop;                                        ///< what is the probability (in percent) that a infantry soldier is spawn on destruction?
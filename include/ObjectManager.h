@@ -20,23 +20,40 @@
 
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
+#include <Definitions.h>
 
-#include <map>
+#include <vector>
+#include <deque>
 #include <SDL.h>
 
+/// The lower OBJECTSLOTBITS bits of an object id are the index of the slot that holds the object
+#define OBJECTSLOTBITS      20
+#define OBJECTSLOTMASK      ((((Uint32) 1) << OBJECTSLOTBITS) - 1)
+/// Slot 0 and the last slot are never used, so that no object gets the id 0 or NONE
+#define MAXOBJECTSLOTS      OBJECTSLOTMASK
+/// The generation is stored in the upper bits of an object id. A slot that has reached this generation is never reused.
+#define MAXOBJECTGENERATION (((Uint32) -1) >> OBJECTSLOTBITS)
+
 // forward declarations
 class ObjectBase;
 
-typedef std::map<Uint32,ObjectBase*> ObjectMap;
-
-/// This class holds all objects (structures and units) in the game.
+/**
+    This class holds all objects (structures and units) in the game.
+    The objects are stored in a dense array of slots. An object id consists of the slot index (the lower OBJECTSLOTBITS bits) and
+    the generation of the slot (the upper bits) which is incremented every time the slot is reused. Thus looking up an object is a
+    simple array access and an id of a removed object never refers to a new object in the same slot. To guarantee this a slot is
+    retired when its generation reaches MAXOBJECTGENERATION instead of letting the generation wrap around.
+    Free slots are reused in the order they were freed, so the ids handed out only depend on the order objects are added and removed.
+*/
 class ObjectManager{
 public:
 	/**
 		Default constructor
 	*/
-    ObjectManager() : nextFreeObjectID(1)
+    ObjectManager() : nextCreationNumber(1)
     {
+        // slot 0 is never used
+        slots.resize(1);
     }
 
     /**
@@ -60,7 +77,7 @@ public:
     /**
 		This method adds one object. The ObjectID is choosen automatically.
 		\param	pObject	A pointer to the object.
-		\return ObjectID of the added object.
+		\return ObjectID of the added object (NONE if there is no free slot left).
 	*/
     Uint32 addObject(ObjectBase* pObject);
 
@@ -70,13 +87,30 @@ public:
 		\return Pointer to this object (NULL if not found)
 	*/
 	inline ObjectBase* getObject(Uint32 objectID) const {
-	    ObjectMap::const_iterator iter = objectMap.find(objectID);
+	    Uint32 slotIndex = objectID & OBJECTSLOTMASK;
 
-	    if(iter == objectMap.end()) {
+	    if(slotIndex >= slots.size()) {
             return NULL;
-	    } else {
-            return iter->second;
 	    }
+
+	    const ObjectSlot& slot = slots[slotIndex];
+	    return (slot.objectID == objectID) ? slot.pObject : NULL;
+	}
+
+	/**
+		Returns the creation number of an object. Objects added later have a higher number, also after loading a savegame,
+		so comparing these numbers gives the order in which the objects were added to the unit and structure lists.
+		\param	objectID	ID of the object
+		\return the creation number (0 if there is no object with this ObjectID)
+	*/
+	inline Uint32 getCreationNumber(Uint32 objectID) const {
+	    Uint32 slotIndex = objectID & OBJECTSLOTMASK;
+
+	    if((slotIndex >= slots.size()) || (slots[slotIndex].objectID != objectID) || (slots[slotIndex].pObject == NULL)) {
+            return 0;
+	    }
+
+	    return slots[slotIndex].creationNumber;
 	}
 
 	/**
@@ -84,13 +118,28 @@ public:
 		\param	ObjectID		ID of the object to remove
 		\return false if there was no object with this ObjectID, true if it could be removed
 	*/
-	bool removeObject(Uint32 objectID) {
-	    return (bool) objectMap.erase(objectID);
-	}
+	bool removeObject(Uint32 objectID);
 
 private:
-    Uint32 nextFreeObjectID;
-    ObjectMap objectMap;
+    /// A slot that can hold one object
+    struct ObjectSlot {
+        ObjectSlot() : pObject(NULL), objectID(NONE), creationNumber(0) { ; }
+
+        ObjectBase* pObject;            ///< the object in this slot or NULL if the slot is free
+        Uint32      objectID;           ///< the id of the object in this slot (the id of the last object if the slot is free)
+        Uint32      creationNumber;     ///< objects are saved in the order of this number to keep the order they were added (see getCreationNumber())
+    };
+
+    /**
+		Returns the id the next object stored in the slot with index slotIndex will get.
+		\param	slotIndex   the index of the slot
+		\return the new id
+	*/
+    Uint32 getNextObjectID(Uint32 slotIndex) const;
+
+    Uint32 nextCreationNumber;              ///< the creation number of the next object added
+    std::vector<ObjectSlot> slots;          ///< all slots (slot 0 is never used)
+    std::deque<Uint32> freeSlots;           ///< the indices of the free slots in the order they were freed
 };
 
 #endif //OBJECTMANAGER_H
@@ -0,0 +1,167 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PATHCLUSTERGRAPH_H
+#define PATHCLUSTERGRAPH_H
+
+#include <DataTypes.h>
+
+#include <vector>
+
+#define PATHCLUSTERSIZE 16
+
+// forward declarations
+class Map;
+class UnitBase;
+
+/**
+    The PathClusterGraph is a hierarchical abstraction of the map that is used to speed up long path searches (similar to HPA*).
+    The map is divided into clusters of PATHCLUSTERSIZE x PATHCLUSTERSIZE tiles. For every movement class the passable transitions
+    (entrances) between neighbouring clusters and the costs for moving between two entrances of the same cluster are cached.
+    Only static obstacles (terrain and structures) are considered here. Units are dynamic and are handled by the AStarSearch that
+    refines the abstract path.
+    If the terrain or a structure on a tile changes the cluster of this tile is marked as dirty and is rebuild on the next search.
+*/
+class PathClusterGraph {
+public:
+
+    typedef enum {
+        MovementClass_Tracked,
+        MovementClass_Wheeled,
+        MovementClass_Infantry,
+        MovementClass_Sandworm,
+        MovementClass_Air,
+        NUM_MOVEMENTCLASSES
+    } MOVEMENTCLASS;
+
+    /**
+        Creates an empty graph for pMap. All clusters are dirty and are built on the first search.
+        \param  pMap    the map this graph belongs to
+    */
+    PathClusterGraph(Map* pMap);
+    ~PathClusterGraph();
+
+    /**
+        Returns the movement class of pUnit.
+        \param  pUnit   the unit to get the movement class for
+        \return the movement class of this unit
+    */
+    static MOVEMENTCLASS getMovementClass(const UnitBase* pUnit);
+
+    /**
+        This method must be called whenever the passability or the terrain type of a tile changes (e.g. the terrain changes
+        or a structure is placed/removed). It marks all clusters that are affected by the tile as dirty.
+        \param  x   the x coordinate of the tile
+        \param  y   the y coordinate of the tile
+    */
+    void invalidateTile(int x, int y);
+
+    inline void invalidateTile(const Coord& location) {
+        invalidateTile(location.x, location.y);
+    }
+
+    /**
+        Returns the index of the cluster containing location.
+        \param  location    the tile
+        \return the index of the cluster
+    */
+    inline int getClusterIndex(const Coord& location) const {
+        return (location.y / PATHCLUSTERSIZE) * numClustersX + (location.x / PATHCLUSTERSIZE);
+    }
+
+    /**
+        Searches an abstract path from start to destination for pUnit. The found path consists of entrance tiles
+        between clusters. Air units do not need an abstract path and always fail.
+        \param  pUnit       the unit to search the path for
+        \param  start       the start of the path
+        \param  destination the destination of the path
+        \param  waypoints   the found path (excluding start but including destination)
+        \return true if a path was found, false otherwise (start and destination in the same cluster or destination unreachable)
+    */
+    bool findAbstractPath(const UnitBase* pUnit, const Coord& start, const Coord& destination, std::vector<Coord>& waypoints);
+
+private:
+    /// An entrance is a tile at the border of a cluster through which a unit may move into the neighbour cluster
+    struct Entrance {
+        Coord   location;               ///< the tile inside the cluster
+        Coord   outside;                ///< the tile in the neighbour cluster
+    };
+
+    struct Cluster {
+        bool                    bDirty;         ///< Has this cluster to be rebuild before it can be used?
+        std::vector<Entrance>   entrances;      ///< all entrances of this cluster
+        std::vector<float>      distances;      ///< the costs between entrances (distances[i*entrances.size()+j] is the cost from entrance i to entrance j)
+    };
+
+    /**
+        Checks if the size of the map has changed (e.g. by loading) and reinitializes the graph if necessary.
+    */
+    void checkMapSize();
+
+    /**
+        Checks if a tile is passable for the specified movement class without considering units.
+        \param  movementClass   the movement class to check
+        \param  x               the x coordinate of the tile
+        \param  y               the y coordinate of the tile
+        \return true if passable, false otherwise
+    */
+    bool isStaticallyPassable(MOVEMENTCLASS movementClass, int x, int y) const;
+
+    /**
+        Rebuilds the entrances and the entrance distances of one cluster.
+        \param  pUnit           a unit of the movement class (used for the terrain difficulty)
+        \param  movementClass   the movement class to rebuild
+        \param  clusterIndex    the cluster to rebuild
+    */
+    void rebuildCluster(const UnitBase* pUnit, MOVEMENTCLASS movementClass, int clusterIndex);
+
+    /**
+        Adds the entrances along one border of a cluster.
+        \param  movementClass   the movement class
+        \param  cluster         the cluster to add the entrances to
+        \param  borderStart     the first tile of the border (inside the cluster)
+        \param  step            the direction to walk along the border
+        \param  outsideOffset   the offset from a border tile to the adjacent tile in the neighbour cluster
+        \param  length          the number of tiles of this border
+    */
+    void addBorderEntrances(MOVEMENTCLASS movementClass, Cluster& cluster, const Coord& borderStart, const Coord& step, const Coord& outsideOffset, int length);
+
+    /**
+        Calculates the costs from source to all tiles of the cluster containing source (Dijkstra). The source tile itself
+        is always treated as passable.
+        \param  pUnit           a unit of the movement class (used for the terrain difficulty)
+        \param  movementClass   the movement class
+        \param  source          the tile to start from
+        \param  costs           the calculated costs (indexed relative to the top left corner of the cluster; INFINITY if unreachable)
+    */
+    void calculateClusterCosts(const UnitBase* pUnit, MOVEMENTCLASS movementClass, const Coord& source, std::vector<float>& costs) const;
+
+    /**
+        Returns the index of the entrance of clusterIndex located at location.
+        \return the index of the entrance or INVALID if there is no such entrance
+    */
+    int findEntrance(MOVEMENTCLASS movementClass, int clusterIndex, const Coord& location) const;
+
+    Map*    pMap;                                           ///< the map this graph belongs to
+    int     mapSizeX;                                       ///< the width of the map when the graph was initialized
+    int     mapSizeY;                                       ///< the height of the map when the graph was initialized
+    int     numClustersX;                                   ///< number of clusters in x direction
+    int     numClustersY;                                   ///< number of clusters in y direction
+    std::vector<Cluster> clusters[NUM_MOVEMENTCLASSES];     ///< the clusters for every movement class
+};
+
+#endif // PATHCLUSTERGRAPH_H
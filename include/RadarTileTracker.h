@@ -0,0 +1,126 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RADARTILETRACKER_H
+#define RADARTILETRACKER_H
+
+#include <DataTypes.h>
+
+#include <vector>
+#include <queue>
+#include <functional>
+
+// forward declarations
+class Map;
+
+/**
+    The RadarTileTracker remembers which tiles of the map may have changed their radar color since the radar was drawn the last time.
+    Tiles are marked as dirty when their terrain, spice or the objects on them change, when they are explored or seen again by the
+    tracked house and when their fog of war has expired. The expiry of the fog is kept in a queue ordered by time so that not every tile
+    has to be checked every frame.
+    Tracking is started by the radar with startTracking(). Before that or after the map was loaded all tiles are dirty.
+*/
+class RadarTileTracker {
+public:
+    /**
+        Creates a tracker for pMap that does not track any house yet.
+        \param  pMap    the map to track
+    */
+    RadarTileTracker(Map* pMap);
+    ~RadarTileTracker();
+
+    /**
+        Stops tracking. All tiles are dirty until startTracking() is called again.
+    */
+    void reset();
+
+    /**
+        Starts tracking the tiles for the house houseID and marks all tiles as dirty.
+        \param  houseID the house the radar is drawn for
+    */
+    void startTracking(int houseID);
+
+    /**
+        Returns the house that is tracked.
+        \return the tracked house or INVALID if tracking is not started
+    */
+    inline int getHouseID() const {
+        return houseID;
+    }
+
+    /**
+        Marks the tile at location as dirty. Invalid locations are ignored.
+        \param  location    the tile that has changed
+    */
+    void setTileDirty(const Coord& location);
+
+    /**
+        This method must be called when the tracked house sees a tile. The tile is marked as dirty if it was not visible before and its fog of war
+        is scheduled to expire.
+        \param  location    the tile that is seen
+        \param  bWasHidden  true if the tile was unexplored or fogged before
+    */
+    void tileSeen(const Coord& location, bool bWasHidden);
+
+    /**
+        Marks all tiles whose fog of war has expired until gameCycle as dirty.
+        \param  gameCycle   the current game cycle
+    */
+    void updateFog(Uint32 gameCycle);
+
+    /**
+        Checks if all tiles are dirty (e.g. because tracking was just started).
+        \return true if all tiles have to be redrawn, false if only the tiles returned by getDirtyTiles() have to be redrawn
+    */
+    inline bool areAllTilesDirty() const {
+        return bAllTilesDirty;
+    }
+
+    /**
+        Returns all dirty tiles. Each tile is contained only once.
+        \return the dirty tiles
+    */
+    inline const std::vector<Coord>& getDirtyTiles() const {
+        return dirtyTiles;
+    }
+
+    /**
+        Marks all tiles as clean. This should be called after the radar has redrawn the dirty tiles.
+    */
+    void clearDirtyTiles();
+
+private:
+    typedef std::pair<Uint32, int> FogExpiry;     ///< the game cycle when the fog expires and the index of the tile
+
+    /**
+        Adds the tile with index tileIndex to the fog expiry queue if it is not already in it.
+        \param  tileIndex   the index of the tile
+    */
+    void scheduleFogExpiry(int tileIndex);
+
+    Map*    pMap;                                   ///< the map to track
+    int     houseID;                                ///< the house that is tracked (INVALID if not tracking)
+    bool    bAllTilesDirty;                         ///< all tiles have to be redrawn
+
+    std::vector<bool>   dirtyFlags;                 ///< for every tile if it is contained in dirtyTiles
+    std::vector<Coord>  dirtyTiles;                 ///< all dirty tiles
+
+    std::vector<bool>   fogScheduledFlags;          ///< for every tile if it is contained in fogExpiryQueue
+    std::priority_queue<FogExpiry, std::vector<FogExpiry>, std::greater<FogExpiry> > fogExpiryQueue;    ///< the tiles that will be fogged sorted by time
+};
+
+#endif // RADARTILETRACKER_H
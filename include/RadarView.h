@@ -90,8 +90,26 @@ public:
 
 private:
 
+    /**
+        Redraws all tiles of the radar surface that have changed since the last call.
+        \param mapSizeX    the width of the map
+        \param mapSizeY    the height of the map
+        \param scale       the number of pixels per tile
+        \param offsetX     the x offset of the map inside the radar surface
+        \param offsetY     the y offset of the map inside the radar surface
+    */
     void updateRadarSurface(int mapSizeX, int mapSizeY, int scale, int offsetX, int offsetY);
 
+    /**
+        Draws one tile to the radar surface. The radar surface must be locked.
+        \param x           the x coordinate of the tile
+        \param y           the y coordinate of the tile
+        \param scale       the number of pixels per tile
+        \param offsetX     the x offset of the map inside the radar surface
+        \param offsetY     the y offset of the map inside the radar surface
+    */
+    void drawRadarTile(int x, int y, int scale, int offsetX, int offsetY);
+
 	RadarViewMode currentRadarMode;         ///< the current mode of the radar
 
 	int animFrame;                          ///< the current animation frame
@@ -101,6 +119,10 @@ private:
     SDL_Surface* radarSurface;              ///< contains the image to be drawn when the radar is active
 	SDL_Surface* radarStaticAnimation;      ///< holds the animation graphic for radar static
 
+    bool bLastRadarOn;                      ///< was the radar of the local house on when radarSurface was drawn?
+    bool bLastDebug;                        ///< was debug mode on when radarSurface was drawn?
+    bool bLastFogOfWar;                     ///< was fog of war on when radarSurface was drawn?
+
 };
 
 #endif // RADARVIEW_H
@@ -0,0 +1,109 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RENDERLIST_H
+#define RENDERLIST_H
+
+#include <vector>
+#include <stddef.h>
+
+// forward declarations
+class Tile;
+class ObjectBase;
+
+/**
+    The RenderList collects everything that is visible on the screen in one pass over the visible tiles. The tiles and
+    objects are sorted into layers which are drawn one after another. Inside a layer the entries are kept in the order
+    they were added, which is the order the tiles are scanned (row by row).
+    The objects are resolved only once per frame and the memory of the layers is reused from frame to frame.
+*/
+class RenderList {
+public:
+    /// The layers in the order they are drawn
+    typedef enum {
+        RenderLayer_Ground,                 ///< the terrain, tracks and damage of a tile
+        RenderLayer_Structures,             ///< structures
+        RenderLayer_UndergroundUnits,       ///< sandworms
+        RenderLayer_DeadUnits,              ///< the dead units of a tile
+        RenderLayer_Infantry,               ///< infantry units
+        RenderLayer_NonInfantryGroundUnits, ///< other ground units
+        RenderLayer_AirUnits,               ///< air units
+        RenderLayer_SelectionRects,         ///< selection rectangles of all kinds of objects
+        NUM_RENDERLAYERS
+    } RENDERLAYER;
+
+    RenderList();
+    ~RenderList();
+
+    /**
+        Removes all entries from all layers.
+    */
+    void clear();
+
+    /**
+        Adds a tile to a layer. Only RenderLayer_Ground and RenderLayer_DeadUnits contain tiles.
+        \param  layer   the layer to add the tile to
+        \param  pTile   the tile to draw
+        \param  xPos    the x position of the left top corner of this tile on the screen
+        \param  yPos    the y position of the left top corner of this tile on the screen
+    */
+    inline void addTile(RENDERLAYER layer, Tile* pTile, int xPos, int yPos) {
+        RenderItem item;
+        item.pTile = pTile;
+        item.pObject = NULL;
+        item.xPos = xPos;
+        item.yPos = yPos;
+        item.bFogged = false;
+        layers[layer].push_back(item);
+    }
+
+    /**
+        Adds an object to a layer.
+        \param  layer   the layer to add the object to
+        \param  pObject the object to draw
+        \param  bFogged only for RenderLayer_Structures: true if the structure shall be drawn fogged
+    */
+    inline void addObject(RENDERLAYER layer, ObjectBase* pObject, bool bFogged = false) {
+        RenderItem item;
+        item.pTile = NULL;
+        item.pObject = pObject;
+        item.xPos = 0;
+        item.yPos = 0;
+        item.bFogged = bFogged;
+        layers[layer].push_back(item);
+    }
+
+    /**
+        Draws all entries of one layer to the screen.
+        \param  layer   the layer to draw
+    */
+    void draw(RENDERLAYER layer) const;
+
+private:
+    /// One tile or object to draw
+    struct RenderItem {
+        Tile*       pTile;      ///< the tile to draw (NULL for objects)
+        ObjectBase* pObject;    ///< the object to draw (NULL for tiles)
+        int         xPos;       ///< the x position of the tile on the screen
+        int         yPos;       ///< the y position of the tile on the screen
+        bool        bFogged;    ///< draw the structure fogged
+    };
+
+    std::vector<RenderItem> layers[NUM_RENDERLAYERS];     ///< the entries of every layer
+};
+
+#endif // RENDERLIST_H
@@ -262,6 +262,16 @@ public:
         return world2zoomedWorld(x - (float) topLeftCorner.x + (float) shakingOffset.x + (float) topLeftCornerOnScreen.x);
     }
 
+    /**
+        This method converts from world to screen coordinates.
+        \param x    the x position in world coordinates
+        \return the x-coordinate on the screen
+    */
+    inline int world2screenX(const FixPoint& x) const
+    {
+        return world2screenX(x.toFloat());
+    }
+
     /**
         This method converts from world to screen coordinates.
         \param y    the y position in world coordinates
@@ -282,6 +292,16 @@ public:
         return world2zoomedWorld(y - (float) topLeftCorner.y + (float) shakingOffset.y + (float) topLeftCornerOnScreen.y);
     }
 
+    /**
+        This method converts from world to screen coordinates.
+        \param y    the y position in world coordinates
+        \return the y-coordinate on the screen
+    */
+    inline int world2screenY(const FixPoint& y) const
+    {
+        return world2screenY(y.toFloat());
+    }
+
     /**
         This method converts from screen to world coordinates.
         \param x    the x coordinate on the screen
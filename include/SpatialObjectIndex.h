@@ -0,0 +1,131 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SPATIALOBJECTINDEX_H
+#define SPATIALOBJECTINDEX_H
+
+#include <DataTypes.h>
+
+#include <vector>
+
+#define SPATIALINDEXBUCKETSIZE 8
+
+// forward declarations
+class ObjectBase;
+
+/**
+    The SpatialObjectIndex divides the map into buckets of SPATIALINDEXBUCKETSIZE x SPATIALINDEXBUCKETSIZE tiles and
+    stores for every bucket which objects are assigned to tiles inside this bucket. It mirrors the object lists of the
+    tiles and is updated by the Tile::assign*() and Tile::unassign*() methods.
+    It is used to find the closest target of an object without scanning all units and structures.
+    Additionally it remembers for every object the tiles it is assigned to so that an object can be removed from the map
+    without checking every tile. These tiles are stored by the slot of the object id (see ObjectManager), so they are found
+    by a simple array access.
+*/
+class SpatialObjectIndex {
+public:
+
+    /// Flags to select which kind of objects shall be found by findClosestTarget()
+    typedef enum {
+        Search_Structures = 0x01,
+        Search_Units = 0x02,
+        Search_All = Search_Structures | Search_Units
+    } SEARCHFLAGS;
+
+    /**
+        Creates an empty index for a map of the specified size.
+        \param  mapSizeX    the width of the map
+        \param  mapSizeY    the height of the map
+    */
+    SpatialObjectIndex(int mapSizeX, int mapSizeY);
+    ~SpatialObjectIndex();
+
+    /**
+        Removes all objects from the index and resizes it to the specified map size.
+        \param  mapSizeX    the width of the map
+        \param  mapSizeY    the height of the map
+    */
+    void reset(int mapSizeX, int mapSizeY);
+
+    /**
+        Adds one assignment of objectID to the tile at location.
+        \param  location    the tile the object is assigned to
+        \param  objectID    the id of the object
+    */
+    void addObject(const Coord& location, Uint32 objectID);
+
+    /**
+        Removes count assignments of objectID from the tile at location.
+        \param  location    the tile the object was assigned to
+        \param  objectID    the id of the object
+        \param  count       the number of assignments to remove
+    */
+    void removeObject(const Coord& location, Uint32 objectID, int count = 1);
+
+    /**
+        Finds the closest object that pSearcher can attack. Walls are only considered if there is no other target.
+        On equal distance a structure is preferred over a unit and an object created earlier is preferred over one created
+        later. This is the same object a scan over the structure list and then the unit list would find, and the result does
+        not depend on the order of the objects inside the buckets.
+        \param  pSearcher   the object that is searching for a target
+        \param  searchFlags which kind of objects shall be considered (see SEARCHFLAGS)
+        \return the closest target or NULL if there is none
+    */
+    ObjectBase* findClosestTarget(const ObjectBase* pSearcher, int searchFlags) const;
+
+    /**
+        Returns all tiles objectID is assigned to. A tile is contained once for every assignment.
+        \param  objectID    the id of the object
+        \param  tiles       the found tiles are appended to this vector
+    */
+    void getObjectTiles(Uint32 objectID, std::vector<Coord>& tiles) const;
+
+private:
+    /// An object assigned to tiles inside a bucket
+    struct Entry {
+        Uint32  objectID;               ///< the id of the object
+        int     count;                  ///< the number of tile assignments of this object inside the bucket
+    };
+
+    /// The tiles an object is assigned to
+    struct ObjectTiles {
+        ObjectTiles();
+
+        Uint32              objectID;   ///< the id of the object (the slot may have been used by an older object before)
+        std::vector<Coord>  tiles;      ///< the tiles the object is assigned to (a tile is contained once for every assignment)
+    };
+
+    inline int getBucketIndex(const Coord& location) const {
+        return (location.y / SPATIALINDEXBUCKETSIZE) * numBucketsX + (location.x / SPATIALINDEXBUCKETSIZE);
+    }
+
+    /**
+        Returns the tiles of objectID.
+        \param  objectID    the id of the object
+        \return the tiles of the object or NULL if it is not assigned to any tile
+    */
+    const ObjectTiles* findObjectTiles(Uint32 objectID) const;
+
+    int     mapSizeX;                                   ///< the width of the map
+    int     mapSizeY;                                   ///< the height of the map
+    int     numBucketsX;                                ///< number of buckets in x direction
+    int     numBucketsY;                                ///< number of buckets in y direction
+    std::vector< std::vector<Entry> > buckets;          ///< the objects of every bucket
+    std::vector<ObjectTiles> objectTiles;               ///< the tiles of every object indexed by the slot of the object id
+};
+
+#endif // SPATIALOBJECTINDEX_H
@@ -0,0 +1,92 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SPICEINDEX_H
+#define SPICEINDEX_H
+
+#include <DataTypes.h>
+
+#include <vector>
+
+#define SPICEINDEXBUCKETSIZE 8
+
+// forward declarations
+class Map;
+
+/**
+    The SpiceIndex remembers which tiles of the map have spice and counts them for buckets of SPICEINDEXBUCKETSIZE x SPICEINDEXBUCKETSIZE tiles.
+    Buckets without spice are skipped when searching, so the nearest spice tile is found by looking at the buckets in growing rings
+    around the origin instead of probing random tiles. The index is informed about changes by Tile::setType() and Tile::setSpice(),
+    which are used by Map::spiceRemoved(), Map::createSpiceField() and when spice is harvested.
+*/
+class SpiceIndex {
+public:
+    /**
+        Creates an empty index for pMap. reset() must be called after the tiles of the map are initialized.
+        \param  pMap    the map to index the spice of
+    */
+    SpiceIndex(Map* pMap);
+    ~SpiceIndex();
+
+    /**
+        Rebuilds the whole index from the tiles of the map (e.g. after loading the map).
+    */
+    void reset();
+
+    /**
+        This method must be called when the terrain type of a tile might have changed.
+        \param  location    the tile that has changed
+    */
+    void onTerrainChanged(const Coord& location);
+
+    /**
+        Returns the number of tiles with spice on the whole map.
+        \return the number of spice tiles
+    */
+    inline int getNumSpiceTiles() const {
+        return numSpiceTiles;
+    }
+
+    /**
+        Finds the spice tile that is nearest to origin. The distance is measured as the number of tiles in x or y direction, whichever is bigger.
+        Between tiles of the same distance the one with the smallest tile index (y*sizeX + x) is chosen, so the result is the same on every
+        computer in a multiplayer game.
+        \param  origin          the tile to search from
+        \param  bFreeTilesOnly  if true, tiles with a ground object on them are ignored
+        \param  bExcludeOrigin  if true, origin itself is ignored
+        \return the nearest spice tile or Coord::Invalid() if there is none
+    */
+    Coord findNearestSpice(const Coord& origin, bool bFreeTilesOnly, bool bExcludeOrigin = false) const;
+
+private:
+    inline int getBucketIndex(int x, int y) const {
+        return (y / SPICEINDEXBUCKETSIZE) * numBucketsX + (x / SPICEINDEXBUCKETSIZE);
+    }
+
+    Map*    pMap;                       ///< the map the spice is indexed for
+    int     sizeX;                      ///< the width of the map
+    int     sizeY;                      ///< the height of the map
+    int     numBucketsX;                ///< number of buckets in x direction
+    int     numBucketsY;                ///< number of buckets in y direction
+    int     numSpiceTiles;              ///< the number of spice tiles on the whole map
+
+    std::vector<bool>   spiceFlags;     ///< for every tile if it has spice
+    std::vector<int>    bucketCounts;   ///< for every bucket the number of spice tiles inside it
+};
+
+#endif // SPICEINDEX_H
@@ -0,0 +1,114 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef SYNCMANAGER_H
+#define SYNCMANAGER_H
+
+#include <SDL.h>
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+
+#define SYNCCHECKINTERVAL       64      ///< the number of game cycles between two sync checks
+#define SYNCCHECKBUCKETS        64      ///< the number of buckets the objects are divided into by their object id (must be a power of two)
+#define SYNCCHECKMAXCHECKPOINTS 8       ///< the number of sync checks kept for comparing them with the peers
+
+/**
+    The SyncManager checks in network games that the game state of all peers is the same. Every SYNCCHECKINTERVAL game cycles
+    a hash of all units, structures, the credits of all houses and the random generator is computed and sent to all peers.
+    The objects are divided into SYNCCHECKBUCKETS buckets and the hash is computed over the hashes of these buckets. If the hash
+    of a peer differs, the hashes of the buckets and then the hashes of the objects in the differing buckets are requested from this
+    peer, so that the objects which are out of sync can be reported.
+*/
+class SyncManager {
+public:
+    SyncManager();
+    ~SyncManager();
+
+    /**
+        This method must be called at the beginning of every game cycle before the commands are executed. Every SYNCCHECKINTERVAL game cycles the
+        game state hash is computed and sent to all peers.
+        \param  gameCycle   the current game cycle
+    */
+    void update(Uint32 gameCycle);
+
+    /**
+        This method is called when the game state hash of a peer is received.
+        \param  peerName    the name of the peer
+        \param  cycle       the game cycle the hash was computed at
+        \param  hash        the hash of the game state
+    */
+    void onReceiveSyncCheck(const std::string& peerName, Uint32 cycle, Uint32 hash);
+
+    /**
+        This method is called when a peer requests detailed hashes because our game state hash differs from his one.
+        \param  peerName    the name of the peer
+        \param  cycle       the game cycle of the sync check
+        \param  bucket      the bucket to send the object hashes for or -1 for the bucket hashes
+    */
+    void onReceiveSyncRequest(const std::string& peerName, Uint32 cycle, Sint32 bucket);
+
+    /**
+        This method is called when the detailed hashes requested with onReceiveSyncRequest() are received.
+        \param  peerName    the name of the peer
+        \param  cycle       the game cycle of the sync check
+        \param  bucket      the bucket of the object hashes or -1 for the bucket hashes
+        \param  hashes      for bucket -1 the house hash followed by all bucket hashes, otherwise the object id and the hash of every object in the bucket
+    */
+    void onReceiveSyncResponse(const std::string& peerName, Uint32 cycle, Sint32 bucket, const std::vector<Uint32>& hashes);
+
+private:
+    /// The hashes computed at one sync check
+    struct Checkpoint {
+        Uint32  cycle;                                          ///< the game cycle
+        Uint32  hash;                                           ///< the hash of the whole game state
+        Uint32  houseHash;                                      ///< the hash of the houses and the random generator
+        Uint32  bucketHashes[SYNCCHECKBUCKETS];                 ///< the hash of the objects in every bucket
+        std::vector< std::pair<Uint32, Uint32> > objectHashes;  ///< the object id and the hash of every object sorted by object id
+    };
+
+    /**
+        Computes all hashes of the current game state.
+        \param  checkpoint  the checkpoint to fill
+    */
+    static void computeCheckpoint(Checkpoint& checkpoint);
+
+    /**
+        Returns the checkpoint for a game cycle.
+        \param  cycle   the game cycle
+        \return the checkpoint or NULL if there is none for this cycle (anymore)
+    */
+    const Checkpoint* getCheckpoint(Uint32 cycle) const;
+
+    /**
+        Compares the hash of a peer with our hash and starts requesting detailed hashes if they differ.
+        \param  peerName    the name of the peer
+        \param  checkpoint  our hashes
+        \param  hash        the hash of the peer
+    */
+    void compareHash(const std::string& peerName, const Checkpoint& checkpoint, Uint32 hash);
+
+    std::deque<Checkpoint> checkpoints;                             ///< the last SYNCCHECKMAXCHECKPOINTS sync checks
+    std::multimap<Uint32, std::pair<std::string, Uint32> > remoteHashes;    ///< the hashes of the peers received before we reached their game cycle (game cycle => peer name and hash)
+    bool    bDesync;                                                ///< a desync was detected; no further checks are done
+};
+
+#endif // SYNCMANAGER_H
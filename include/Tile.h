@@ -24,6 +24,7 @@
 
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
+#include <TileObjectList.h>
 
 #include <list>
 #include <vector>
@@ -38,6 +39,8 @@ class ObjectBase;
 class UnitBase;
 class AirUnit;
 class InfantryBase;
+class SpatialObjectIndex;
+class RenderList;
 
 
 enum deadUnitEnum {
@@ -96,6 +99,8 @@ enum destroyedStructureEnum {
 class Tile
 {
 public:
+    typedef TileObjectList<NUM_INFANTRY_PER_TILE>   InfantryList;   ///< a tile has room for NUM_INFANTRY_PER_TILE infantry units
+    typedef TileObjectList<2>                       ObjectList;     ///< usually not more than two objects (one leaving and one entering the tile)
 
     typedef enum {
         Terrain_RockDamage,
@@ -226,41 +231,34 @@ public:
 	void save(OutputStream& stream) const;
 
 	void assignAirUnit(Uint32 newObjectID);
-	void assignDeadUnit(Uint8 type, Uint8 house, const Coord& position) {
-        DEADUNITTYPE newDeadUnit;
-        newDeadUnit.type = type;
-        newDeadUnit.house = house;
-        newDeadUnit.onSand = isSand() || isDunes();
-        newDeadUnit.realPos = position;
-        newDeadUnit.timer = 2000;
-
-        deadUnits.push_back(newDeadUnit);
-	}
+	void assignDeadUnit(Uint8 type, Uint8 house, const Coord& position);
 
 	void assignNonInfantryGroundObject(Uint32 newObjectID);
 	int assignInfantry(Uint32 newObjectID, Sint8 currentPosition = INVALID_POS);
 	void assignUndergroundUnit(Uint32 newObjectID);
 
     /**
-        This method draws the terrain of this tile
-        \param xPos the x position of the left top corner of this tile on the screen
-        \param yPos the y position of the left top corner of this tile on the screen
+        Adds all objects assigned to this tile to index. This is needed after loading as the
+        object lists are read directly from the stream.
+        \param index   the index to add the objects to
     */
-	void blitGround(int xPos, int yPos);
+    void addObjectsToIndex(SpatialObjectIndex& index) const;
 
     /**
-        This method draws the structures.
+        This method draws the terrain of this tile
         \param xPos the x position of the left top corner of this tile on the screen
         \param yPos the y position of the left top corner of this tile on the screen
     */
-	void blitStructures(int xPos, int yPos);
+	void blitGround(int xPos, int yPos);
 
     /**
-        This method draws the underground units of this tile.
-        \param xPos the x position of the left top corner of this tile on the screen
-        \param yPos the y position of the left top corner of this tile on the screen
+        Adds everything visible on this tile to the layers of renderList: the ground, the structure (only once on the first
+        visible tile of the structure), the units and dead units and the selection rectangles.
+        \param renderList  the render list for the current frame
+        \param xPos        the x position of the left top corner of this tile on the screen
+        \param yPos        the y position of the left top corner of this tile on the screen
     */
-	void blitUndergroundUnits(int xPos, int yPos);
+	void addToRenderList(RenderList& renderList, int xPos, int yPos);
 
     /**
         This method draws the dead units of this tile.
@@ -269,51 +267,18 @@ public:
     */
 	void blitDeadUnits(int xPos, int yPos);
 
-    /**
-        This method draws the infantry units of this tile.
-        \param xPos the x position of the left top corner of this tile on the screen
-        \param yPos the y position of the left top corner of this tile on the screen
-    */
-    void blitInfantry(int xPos, int yPos);
-
-    /**
-        This method draws the ground units of this tile.
-        \param xPos the x position of the left top corner of this tile on the screen
-        \param yPos the y position of the left top corner of this tile on the screen
-    */
-	void blitNonInfantryGroundUnits(int xPos, int yPos);
-
-    /**
-        This method draws the air units of this tile.
-        \param xPos the x position of the left top corner of this tile on the screen
-        \param yPos the y position of the left top corner of this tile on the screen
-    */
-	void blitAirUnits(int xPos, int yPos);
 
     /**
-        This method draws the infantry units of this tile.
-        \param xPos the x position of the left top corner of this tile on the screen
-        \param yPos the y position of the left top corner of this tile on the screen
+        Lets the tracks and the dead units on this tile decay. This method is only called by Map::updateTiles() for tiles
+        that have tracks or dead units.
+        \return true if this tile still has tracks or dead units that have to decay, false otherwise
     */
-	void blitSelectionRects(int xPos, int yPos);
-
-
-	inline void update() {
-
-	    // Performance tweak because this function is called alot (every game cycle for every tile)
+	inline bool update() {
 	    bool bHasTracks = false;
         for(int i=0;i<NUM_ANGLES;i++) {
-            if(tracksCounter[i] != 0) {
-                bHasTracks = true;
-                break;
-            }
-        }
-
-        if(bHasTracks) {
-            for(int i=0;i<NUM_ANGLES;i++) {
-                if(tracksCounter[i] > 0) {
-                    tracksCounter[i]--;
-                }
+            if(tracksCounter[i] > 0) {
+                tracksCounter[i]--;
+                bHasTracks = bHasTracks || (tracksCounter[i] > 0);
             }
         }
 
@@ -325,16 +290,27 @@ public:
                 deadUnits[i].timer--;
             }
         }
+
+        return bHasTracks || !deadUnits.empty();
+    }
+
+    /**
+        Checks if this tile has tracks or dead units that have to decay.
+        \return true if update() has to be called for this tile, false otherwise
+    */
+    inline bool needsUpdate() const {
+        for(int i=0;i<NUM_ANGLES;i++) {
+            if(tracksCounter[i] > 0) {
+                return true;
+            }
+        }
+
+        return !deadUnits.empty();
     }
 
 	void clearTerrain();
 
-	inline void setTrack(Uint8 direction) {
-	    if(type == Terrain_Sand || type == Terrain_Dunes
-            || type == Terrain_Spice || type == Terrain_ThickSpice) {
-            tracksCounter[direction] = 5000;
-	    }
-    }
+	void setTrack(Uint8 direction);
 
 	void selectAllPlayersUnits(int houseID, ObjectBase** lastCheckedObject, ObjectBase** lastSelectedObject);
 	void selectAllPlayersUnitsOfType(int houseID, int itemID, ObjectBase** lastCheckedObject, ObjectBase** lastSelectedObject);
@@ -390,19 +366,19 @@ public:
 	ObjectBase* getObjectWithID(Uint32 objectID);
 
 
-    const std::list<Uint32>& getAirUnitList() const {
+    const ObjectList& getAirUnitList() const {
         return assignedAirUnitList;
     }
 
-	const std::list<Uint32>& getInfantryList() const {
+	const InfantryList& getInfantryList() const {
         return assignedInfantryList;
     }
 
-	const std::list<Uint32>& getUndergroundUnitList() const {
+	const ObjectList& getUndergroundUnitList() const {
         return assignedUndergroundUnitList;
     }
 
-	const std::list<Uint32>& getNonInfantryGroundObjectList() const {
+	const ObjectList& getNonInfantryGroundObjectList() const {
         return assignedNonInfantryGroundObjectList;
     }
 
@@ -428,7 +404,7 @@ public:
         explored[houseID] = true;
     }
 
-	inline void setOwner(int newOwner) { owner = newOwner; }
+	void setOwner(int newOwner);
 	inline void setSandRegion(int newSandRegion) { sandRegion = newSandRegion; }
 	inline void setDestroyedStructureTile(int newDestroyedStructureTile) { destroyedStructureTile = newDestroyedStructureTile; };
 
@@ -445,6 +421,13 @@ public:
 	inline bool isConcrete() const { return (type == Terrain_Slab); }
 	inline bool isExplored(int houseID) const {return explored[houseID];}
 
+    /**
+        Returns the game cycle when this tile was seen the last time by the house houseID.
+        \param  houseID the house
+        \return the game cycle of the last access
+    */
+	inline Uint32 getLastAccess(int houseID) const { return lastAccess[houseID]; }
+
 	bool isFogged(int houseID);
 	inline bool isMountain() const { return (type == Terrain_Mountain);}
 	inline bool isRock() const { return ((type == Terrain_Rock) || (type == Terrain_Slab) || (type == Terrain_Mountain));}
@@ -509,31 +492,44 @@ public:
 	Coord	location;   ///< location of this tile in map coordinates
 
 private:
+    /**
+        Removes objectID from objectList and updates the spatial object index of the map accordingly.
+        \param objectList  the list to remove the object from
+        \param objectID    the id of the object to remove
+    */
+    template<int N> void unassignFromList(TileObjectList<N>& objectList, Uint32 objectID);
 
-	Uint32  	type;   ///< the type of the tile (Terrain_Sand, Terrain_Rock, ...)
+    /**
+        Appends the ids of all objects on this tile to objectIDs (infantry, non-infantry ground objects, underground units and air units).
+        \param objectIDs   the vector to append the ids to
+    */
+    void getObjectIDs(std::vector<Uint32>& objectIDs) const;
 
-	Uint32      fogColor;       ///< remember last color (radar)
+    // the members that are needed by nearly every tile sweep are placed first
+
+	Uint32  	type;   ///< the type of the tile (Terrain_Sand, Terrain_Rock, ...)
 
 	Sint32      owner;          ///< house ID of the owner of this tile
 	Uint32      sandRegion;     ///< used by sandworms to check if can get to a unit
 
 	float       spice;          ///< how much spice on this particular tile is left
 
+	InfantryList    assignedInfantryList;                   ///< all infantry units on this tile
+	ObjectList      assignedNonInfantryGroundObjectList;    ///< all structures/vehicles on this tile
+	ObjectList      assignedAirUnitList;                    ///< all the air units on this tile
+	ObjectList      assignedUndergroundUnitList;            ///< all underground units on this tile
+
+	bool        explored[NUM_HOUSES];      ///< contains for every house if this tile is explored
+	Uint32      lastAccess[NUM_HOUSES];    ///< contains for every house when this tile was seen last by this house
+
+	Uint32      fogColor;       ///< remember last color (radar)
+
     Sint32                          destroyedStructureTile;     ///< the tile drawn for a destroyed structure
 	Sint16                          tracksCounter[NUM_ANGLES];  ///< Contains counters for the tracks on sand
 	std::vector<DAMAGETYPE>         damage;                     ///< damage positions
 	std::vector<DEADUNITTYPE>       deadUnits;                  ///< dead units
 
-	std::list<Uint32>	assignedAirUnitList;                    ///< all the air units on this tile
-	std::list<Uint32>	assignedInfantryList;                   ///< all infantry units on this tile
-	std::list<Uint32>	assignedUndergroundUnitList;            ///< all underground units on this tile
-	std::list<Uint32>	assignedNonInfantryGroundObjectList;    ///< all structures/vehicles on this tile
-
 	SDL_Surface**       sprite;    ///< the graphic to draw
-
-
-	Uint32      lastAccess[NUM_HOUSES];    ///< contains for every house when this tile was seen last by this house
-	bool        explored[NUM_HOUSES];      ///< contains for every house if this tile is explored
 };
 
 
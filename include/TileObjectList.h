@@ -0,0 +1,156 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TILEOBJECTLIST_H
+#define TILEOBJECTLIST_H
+
+#include <SDL.h>
+
+#include <list>
+#include <string.h>
+
+/**
+    A list of object ids as used by the tiles. Up to N ids are stored directly inside the list without allocating any memory.
+    Only if more ids are added all ids are moved to a memory block on the heap. The ids are kept in the order they were added.
+    N must be big enough that a pointer fits into the storage of N ids.
+*/
+template<int N>
+class TileObjectList {
+public:
+    typedef const Uint32* const_iterator;
+
+    TileObjectList() : numIDs(0), capacity(N) {
+    }
+
+    TileObjectList(const TileObjectList& list) : numIDs(0), capacity(N) {
+        *this = list;
+    }
+
+    ~TileObjectList() {
+        if(capacity > N) {
+            delete [] pOverflowIDs;
+        }
+    }
+
+    TileObjectList& operator=(const TileObjectList& list) {
+        if(this != &list) {
+            clear();
+            reserve(list.numIDs);
+            memcpy(getIDs(), list.getIDs(), list.numIDs*sizeof(Uint32));
+            numIDs = list.numIDs;
+        }
+        return *this;
+    }
+
+    TileObjectList& operator=(const std::list<Uint32>& list) {
+        clear();
+        reserve(list.size());
+        for(std::list<Uint32>::const_iterator iter = list.begin(); iter != list.end(); ++iter) {
+            push_back(*iter);
+        }
+        return *this;
+    }
+
+    /**
+        Returns all ids as a std::list (e.g. for saving).
+        \return the ids in this list
+    */
+    std::list<Uint32> toList() const {
+        return std::list<Uint32>(begin(), end());
+    }
+
+    inline const_iterator begin() const { return getIDs(); }
+    inline const_iterator end() const { return getIDs() + numIDs; }
+
+    inline bool empty() const { return (numIDs == 0); }
+    inline unsigned int size() const { return numIDs; }
+    inline Uint32 front() const { return getIDs()[0]; }
+
+    /**
+        Adds objectID to the end of this list.
+        \param  objectID    the id to add
+    */
+    void push_back(Uint32 objectID) {
+        if(numIDs >= capacity) {
+            reserve(2*capacity);
+        }
+        getIDs()[numIDs++] = objectID;
+    }
+
+    /**
+        Removes all occurrences of objectID from this list. The order of the remaining ids is kept.
+        \param  objectID    the id to remove
+        \return the number of removed ids
+    */
+    unsigned int remove(Uint32 objectID) {
+        Uint32* pIDs = getIDs();
+        unsigned int newNumIDs = 0;
+        for(unsigned int i = 0; i < numIDs; i++) {
+            if(pIDs[i] != objectID) {
+                pIDs[newNumIDs++] = pIDs[i];
+            }
+        }
+
+        unsigned int numRemoved = numIDs - newNumIDs;
+        numIDs = newNumIDs;
+        return numRemoved;
+    }
+
+    /**
+        Removes all ids and frees the heap memory if there is any.
+    */
+    void clear() {
+        if(capacity > N) {
+            delete [] pOverflowIDs;
+            capacity = N;
+        }
+        numIDs = 0;
+    }
+
+private:
+    inline Uint32* getIDs() { return (capacity > N) ? pOverflowIDs : inlineIDs; }
+    inline const Uint32* getIDs() const { return (capacity > N) ? pOverflowIDs : inlineIDs; }
+
+    /**
+        Makes sure this list can hold at least newCapacity ids.
+        \param  newCapacity the number of ids needed
+    */
+    void reserve(unsigned int newCapacity) {
+        if(newCapacity <= capacity) {
+            return;
+        }
+
+        Uint32* pNewIDs = new Uint32[newCapacity];
+        memcpy(pNewIDs, getIDs(), numIDs*sizeof(Uint32));
+
+        if(capacity > N) {
+            delete [] pOverflowIDs;
+        }
+
+        pOverflowIDs = pNewIDs;
+        capacity = newCapacity;
+    }
+
+    union {
+        Uint32  inlineIDs[N];       ///< the ids if not more than N ids are stored
+        Uint32* pOverflowIDs;       ///< the ids if more than N ids are stored (capacity > N)
+    };
+    Uint16  numIDs;                 ///< the number of ids in this list
+    Uint16  capacity;               ///< the number of ids that fit into the current storage
+};
+
+#endif // TILEOBJECTLIST_H
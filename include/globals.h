@@ -22,7 +22,7 @@
 #include <Definitions.h>
 #include <FileClasses/Palette.h>
 #include <data.h>
-#include <misc/RobustList.h>
+#include <misc/DenseList.h>
 #include <SDL.h>
 
 #define _(msgid) pTextManager->getLocalized(msgid)
@@ -81,9 +81,9 @@ EXTERN Map*                 currentGameMap;             ///< the map for the cur
 EXTERN House*		        pLocalHouse;                ///< the house of the human player that is playing the current running game on this computer
 EXTERN HumanPlayer*         pLocalPlayer;               ///< the player that is playing the current running game on this computer
 
-EXTERN RobustList<UnitBase*>       unitList;           ///< the list of all units
-EXTERN RobustList<StructureBase*>  structureList;      ///< the list of all structures
-EXTERN RobustList<Bullet*>     bulletList;         ///< the list of all bullets
+EXTERN DenseList<UnitBase*>        unitList;           ///< the list of all units
+EXTERN DenseList<StructureBase*>   structureList;      ///< the list of all structures
+EXTERN DenseList<Bullet*>      bulletList;         ///< the list of all bullets
 
 
 // misc
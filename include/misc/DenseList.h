@@ -0,0 +1,297 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef DENSELIST_H
+#define DENSELIST_H
+
+#include <SDL.h>
+
+#include <vector>
+#include <stdlib.h>
+
+template<typename T> class DenseList;
+
+/// the position of an element that is not stored in a DenseList
+#define DENSELIST_NOPOSITION	((size_t) -1)
+
+/**
+	Base class of all classes whose objects are stored in a DenseList. It stores the position of the object inside the list,
+	so that the object can be removed without searching and without any additional memory. Thus an object can only be stored in
+	one DenseList at a time.
+*/
+class DenseListElement {
+public:
+	DenseListElement() : denseListPosition(DENSELIST_NOPOSITION) {
+	}
+
+	/**
+		Copy constructor. The copy is not contained in any list.
+	*/
+	DenseListElement(const DenseListElement&) : denseListPosition(DENSELIST_NOPOSITION) {
+	}
+
+	/**
+		Assignment operator. The position inside the list is not copied.
+	*/
+	DenseListElement& operator=(const DenseListElement&) {
+		return *this;
+	}
+
+private:
+	template<typename T> friend class DenseList;
+
+	size_t denseListPosition;		///< the index into DenseList::elements or DENSELIST_NOPOSITION
+};
+
+/**
+	This iterator is designed for the dense list class. It only stores the list and an index into it and thus
+	does not need to register at the list. Removed elements are skipped and elements added while iterating
+	are visited at the end.
+*/
+template<typename T>
+class DenseListIterator {
+public:
+	/**
+		Default constructor. The iterator points to the end of every list.
+	*/
+	DenseListIterator<T>() : pList(NULL), index(0) {
+	}
+
+	/**
+		This constructor constructs an iterator that points at the first element at or after index in the list List.
+		\param	index	Index to start at
+		\param	List	this is the list to iterate over
+	*/
+	DenseListIterator<T>(size_t index, DenseList<T>* List) : pList(List), index(index) {
+		skipRemovedElements();
+	}
+
+	/**
+		This operator returns the element the iterator is currently pointing to
+		\return a reference to the element the iterator is currently pointing to
+	*/
+	T& operator*() const {
+		return pList->elements[index];
+	}
+
+	/**
+		This operator returns a pointer to the element the iterator is currently pointing to
+		\return a pointer to the element the iterator is currently pointing to
+	*/
+	T* operator->() const {
+		return &(pList->elements[index]);
+	}
+
+	/**
+		This operator advances to the next element in the list that is not removed.
+		\return A reference to this iterator
+	*/
+	DenseListIterator<T>& operator++() {
+		index++;
+		skipRemovedElements();
+		return *this;
+	}
+
+	/**
+		This operator advances to the next element in the list that is not removed.
+	*/
+	void operator++(int) {
+		operator++();
+	}
+
+	/**
+		This operator compares to iterators.
+		\param	x	the other iterator
+		\return	true if both iterators point to the same element or both are at the end, false otherwise
+	*/
+	bool operator==(const DenseListIterator<T>& x) const {
+		if(isAtEnd() || x.isAtEnd()) {
+			return (isAtEnd() && x.isAtEnd());
+		} else {
+			return (pList == x.pList) && (index == x.index);
+		}
+	}
+
+	/**
+		This operator compares to iterators.
+		\param	x	the other iterator
+		\return	false if both iterators point to the same element or both are at the end, true otherwise
+	*/
+	bool operator!=(const DenseListIterator<T>& x) const {
+		return !(operator==(x));
+	}
+
+private:
+	/**
+		Checks if this iterator is behind the last element of its list. Elements added to the list after this
+		iterator reached the end are not visited anymore.
+		\return	true if there is no more element, false otherwise
+	*/
+	inline bool isAtEnd() const {
+		return (pList == NULL) || (index >= pList->elements.size());
+	}
+
+	/**
+		Advances index until it points to an element that is not removed or to the end of the list.
+	*/
+	void skipRemovedElements() {
+		if(pList != NULL) {
+			while((index < pList->elements.size()) && (pList->elements[index] == NULL)) {
+				index++;
+			}
+		}
+	}
+
+	DenseList<T>* pList;
+	size_t index;
+};
+
+/**
+	A list of pointers that is stored in one contiguous block of memory. While iterating over the list it is allowed
+	to add and remove elements: Removing an element only marks its slot as removed (it is set to NULL) and iterators
+	skip removed slots. The removed slots are freed by compact() which must not be called while iterating over the list.
+	The order of the elements is the order in which they were added, also after compact().
+	T must be a pointer to a class derived from DenseListElement. An element must not be contained more than once and NULL cannot be stored.
+*/
+template<typename T>
+class DenseList {
+public:
+	typedef DenseListIterator<T> iterator;
+	typedef DenseListIterator<T> const_iterator;
+
+	/**
+		Default constructor
+	*/
+	DenseList() : numElements(0), modificationCount(0) {
+	}
+
+	/**
+		Returns the number of elements currently stored in the list (removed elements are not counted).
+		\return number of elements in the list
+	*/
+	int size() const {
+		return numElements;
+	}
+
+	/**
+		Checks whether this list is empty.
+		\returns true if the number of elements is zero, false otherwise.
+	*/
+	bool empty() const {
+		return (numElements == 0);
+	}
+
+	/**
+		Returns a counter that is incremented every time an element is added or removed. It can be used to check
+		if a copy of this list is still up to date. compact() does not change the counter as it keeps the elements and their order.
+		\return	the number of modifications of this list
+	*/
+	Uint32 getModificationCount() const {
+		return modificationCount;
+	}
+
+	/**
+		Adds the element x at the end of the list.
+		\param	x	Element to add
+	*/
+	void push_back(const T& x) {
+		x->denseListPosition = elements.size();
+		elements.push_back(x);
+		numElements++;
+		modificationCount++;
+	}
+
+	/**
+		Returns an iterator that references the beginning of the list.
+		\return	Iterator that points to the beginning of the list
+	*/
+	iterator begin() const {
+		return iterator(0, const_cast<DenseList<T>*>(this));
+	}
+
+	/**
+		Returns an iterator that references a position just past the last element in the list.
+		\return	Iterator that points to the end of the list
+	*/
+	iterator end() const {
+		return iterator();
+	}
+
+	/**
+		Erase all elements from this list.
+	*/
+	void clear() {
+		for(size_t i = 0; i < elements.size(); i++) {
+			if(elements[i] != NULL) {
+				elements[i]->denseListPosition = DENSELIST_NOPOSITION;
+			}
+		}
+
+		elements.clear();
+		numElements = 0;
+		modificationCount++;
+	}
+
+	/**
+		Removes value from the list. The slot of value is kept until the next call of compact(), so iterators
+		stay valid.
+		\param	value	value to remove
+	*/
+	void remove(const T& value) {
+		// value might be a reference into elements (e.g. *iter), so copy it before overwriting the slot
+		T element = value;
+		size_t position = element->denseListPosition;
+		if((position < elements.size()) && (elements[position] == element)) {
+			elements[position] = NULL;
+			element->denseListPosition = DENSELIST_NOPOSITION;
+			numElements--;
+			modificationCount++;
+		}
+	}
+
+	/**
+		Frees the slots of all removed elements. The order of the remaining elements is kept.
+		This method must not be called while iterating over this list.
+	*/
+	void compact() {
+		if((size_t) numElements == elements.size()) {
+			return;
+		}
+
+		size_t newSize = 0;
+		for(size_t i = 0; i < elements.size(); i++) {
+			if(elements[i] != NULL) {
+				if(newSize != i) {
+					elements[newSize] = elements[i];
+					elements[newSize]->denseListPosition = newSize;
+				}
+				newSize++;
+			}
+		}
+		elements.resize(newSize);
+	}
+
+private:
+	friend class DenseListIterator<T>;
+
+	int numElements;                                ///< the number of elements that are not removed
+	Uint32 modificationCount;                       ///< incremented on every change of the elements (see getModificationCount())
+	std::vector<T> elements;                        ///< all elements in the order they were added (removed elements are NULL)
+};
+
+#endif //DENSELIST_H
@@ -60,7 +60,7 @@ std::list<std::string> getFileNamesList(std::string directory, std::string exten
 	This function finds all the files in the specified directory with the specified
 	extension.
 	\param	directory	the directory name
-	\param	extension	the extension to search for
+	\param	extension	the extension to search for (an empty extension finds all files but no directories)
 	\param	IgnoreCase	true = extension comparison is case insensitive
 	\return	a list of all the files with the specified extension
 */
@@ -0,0 +1,174 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef FIXPOINT_H
+#define FIXPOINT_H
+
+#include <SDL.h>
+#include <math.h>
+
+#define FIXPOINT_FRACBITS   16
+#define FIXPOINT_ONE        (1 << FIXPOINT_FRACBITS)
+
+/**
+    A signed fixed point number with 16 integer and 16 fractional bits. All calculations are done with integer
+    arithmetic, so the results are the same on every platform and with every compiler flag. This type is used for
+    the simulation state that is synchronized between network players (e.g. the positions and speeds of units and bullets).
+    Angles are measured in 256th of a full circle (0 is right, 64 is up).
+    A FixPoint can be implicitly constructed from an int but there is no implicit conversion from or to float.
+*/
+class FixPoint {
+public:
+    /**
+        Default constructor. The value is 0.
+    */
+    FixPoint() : value(0) {
+    }
+
+    /**
+        Constructs a FixPoint from an integer.
+        \param  x   the integer value
+    */
+    FixPoint(int x) : value(x * FIXPOINT_ONE) {
+    }
+
+    /**
+        Constructs a FixPoint from its raw representation (the value multiplied by 65536).
+        \param  raw the raw value
+        \return the new FixPoint
+    */
+    static inline FixPoint fromRaw(Sint32 raw) {
+        FixPoint x;
+        x.value = raw;
+        return x;
+    }
+
+    /**
+        Converts a float to the nearest FixPoint. This should only be used for constants and values read from
+        the game data, as the float value itself must be the same on all platforms.
+        \param  x   the float value
+        \return the nearest FixPoint
+    */
+    static inline FixPoint fromFloat(float x) {
+        return fromRaw((Sint32) lroundf(x * (float) FIXPOINT_ONE));
+    }
+
+    /**
+        Returns the raw representation of this number (the value multiplied by 65536).
+        \return the raw value
+    */
+    inline Sint32 getRaw() const { return value; }
+
+    /**
+        Converts this number to float, e.g. for drawing.
+        \return the value as float
+    */
+    inline float toFloat() const { return (float) value / (float) FIXPOINT_ONE; }
+
+    /**
+        Converts this number to int by truncating the fractional part (like a cast from float to int).
+        \return the value rounded towards zero
+    */
+    inline int toInt() const {
+        return (value >= 0) ? (value / FIXPOINT_ONE) : (int) -((-(Sint64) value) / FIXPOINT_ONE);
+    }
+
+    /**
+        Rounds this number to the nearest int. Halfway cases are rounded away from zero (like lround()).
+        \return the nearest int
+    */
+    inline int roundToInt() const {
+        // calculated with 64 bit as adding one half overflows for values near the limits
+        return (value >= 0) ? (int) (((Sint64) value + FIXPOINT_ONE/2) / FIXPOINT_ONE) : (int) -((-(Sint64) value + FIXPOINT_ONE/2) / FIXPOINT_ONE);
+    }
+
+    inline FixPoint operator-() const { return fromRaw(-value); }
+
+    inline FixPoint& operator+=(const FixPoint& x) { value += x.value; return *this; }
+    inline FixPoint& operator-=(const FixPoint& x) { value -= x.value; return *this; }
+    inline FixPoint& operator*=(const FixPoint& x) { value = (Sint32) (((Sint64) value * (Sint64) x.value) >> FIXPOINT_FRACBITS); return *this; }
+    inline FixPoint& operator/=(const FixPoint& x) { value = (Sint32) (((Sint64) value * FIXPOINT_ONE) / x.value); return *this; }
+    inline FixPoint& operator*=(int x) { value *= x; return *this; }
+    inline FixPoint& operator/=(int x) { value /= x; return *this; }
+
+    inline friend FixPoint operator+(FixPoint a, const FixPoint& b) { return a += b; }
+    inline friend FixPoint operator-(FixPoint a, const FixPoint& b) { return a -= b; }
+    inline friend FixPoint operator*(FixPoint a, const FixPoint& b) { return a *= b; }
+    inline friend FixPoint operator/(FixPoint a, const FixPoint& b) { return a /= b; }
+    inline friend FixPoint operator*(FixPoint a, int b) { return a *= b; }
+    inline friend FixPoint operator*(int a, FixPoint b) { return b *= a; }
+    inline friend FixPoint operator/(FixPoint a, int b) { return a /= b; }
+
+    inline friend bool operator==(const FixPoint& a, const FixPoint& b) { return a.value == b.value; }
+    inline friend bool operator!=(const FixPoint& a, const FixPoint& b) { return a.value != b.value; }
+    inline friend bool operator<(const FixPoint& a, const FixPoint& b) { return a.value < b.value; }
+    inline friend bool operator<=(const FixPoint& a, const FixPoint& b) { return a.value <= b.value; }
+    inline friend bool operator>(const FixPoint& a, const FixPoint& b) { return a.value > b.value; }
+    inline friend bool operator>=(const FixPoint& a, const FixPoint& b) { return a.value >= b.value; }
+
+    /**
+        Returns the absolute value of x.
+        \param  x   the number
+        \return |x|
+    */
+    static inline FixPoint abs(const FixPoint& x) {
+        return (x.value < 0) ? -x : x;
+    }
+
+    /**
+        Calculates the square root of x.
+        \param  x   the number (must not be negative)
+        \return the square root of x rounded down
+    */
+    static FixPoint sqrt(const FixPoint& x);
+
+    /**
+        Calculates sqrt(x*x + y*y) without overflowing for large x and y.
+        \param  x   the first number
+        \param  y   the second number
+        \return the length of the vector (x,y) rounded down
+    */
+    static FixPoint hypot(const FixPoint& x, const FixPoint& y);
+
+    /**
+        Calculates the sine of angle. The result is interpolated from a table with one entry per angle step.
+        \param  angle   the angle in 256th of a full circle (any value is allowed)
+        \return the sine of angle
+    */
+    static FixPoint sin(const FixPoint& angle);
+
+    /**
+        Calculates the cosine of angle. The result is interpolated from a table with one entry per angle step.
+        \param  angle   the angle in 256th of a full circle (any value is allowed)
+        \return the cosine of angle
+    */
+    static FixPoint cos(const FixPoint& angle);
+
+    /**
+        Calculates the angle of the vector (x,y). In contrast to the C library the angle is measured in 256th of a full circle.
+        \param  y   the y component of the vector (positive is up)
+        \param  x   the x component of the vector (positive is right)
+        \return the angle in the range [0;256) or 0 if both x and y are 0
+    */
+    static FixPoint atan2(const FixPoint& y, const FixPoint& x);
+
+private:
+    Sint32 value;           ///< the value multiplied by 65536
+};
+
+#endif // FIXPOINT_H
@@ -32,6 +32,25 @@ public:
 	bool open(std::string filename);
 	void close();
 
+    /**
+        Returns the current read position inside the file.
+        \return the offset from the beginning of the file in bytes
+    */
+	Uint32 getPosition();
+
+    /**
+        Sets the read position inside the file.
+        \param  position    the offset from the beginning of the file in bytes
+        \return true on success, false otherwise
+    */
+	bool setPosition(Uint32 position);
+
+    /**
+        Returns the size of the file. The read position is not changed.
+        \return the size of the file in bytes
+    */
+	Uint32 getSize();
+
 	std::string readString();
 
 	Uint8 readUint8();
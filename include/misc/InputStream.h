@@ -18,6 +18,7 @@
 #ifndef INPUTSTREAM_H
 #define INPUTSTREAM_H
 
+#include <misc/FixPoint.h>
 
 #include <SDL.h>
 #include <string>
@@ -72,6 +73,14 @@ public:
         return *((Sint32*) &tmp);
 	}
 
+	/**
+        Reads in a FixPoint value.
+        \return the read value
+	*/
+	FixPoint readFixPoint() {
+        return FixPoint::fromRaw(readSint32());
+	}
+
 	/**
         Reads in a Sint64 value.
         \return the read value
@@ -34,6 +34,12 @@ public:
 
 	virtual void flush();
 
+    /**
+        Returns the current write position inside the file.
+        \return the offset from the beginning of the file in bytes
+    */
+	Uint32 getPosition();
+
 	// write operations
 
 	void writeString(const std::string& str);
@@ -18,6 +18,7 @@
 #ifndef OUTPUTSTREAM_H
 #define OUTPUTSTREAM_H
 
+#include <misc/FixPoint.h>
 
 #include <SDL.h>
 #include <string>
@@ -75,6 +76,14 @@ public:
         writeUint32(tmp);
 	}
 
+	/**
+        Writes out a FixPoint value.
+        \param x    the value to write out
+	*/
+	void writeFixPoint(const FixPoint& x) {
+        writeSint32(x.getRaw());
+	}
+
 	/**
         Writes out a Sint64 value.
         \param x    the value to write out
@@ -0,0 +1,140 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <SDL.h>
+
+#include <string.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+    Orders all memory accesses before this call before all memory accesses after it (for the compiler and the processor).
+*/
+inline void memoryBarrier() {
+#if defined(_MSC_VER)
+    // MSVC only targets x86 here where stores are not reordered with other stores and loads not with other loads
+    _ReadWriteBarrier();
+#elif defined(__GNUC__)
+    __sync_synchronize();
+#else
+    #error memoryBarrier() is not implemented for this compiler
+#endif
+}
+
+/**
+    A ring buffer for exactly one thread writing into it and exactly one other thread reading from it. No locks are
+    needed and neither write() nor read() allocate memory, so the reading side can be used inside an audio callback.
+    The capacity is fixed and must be a power of two. The read and write positions are only incremented (and wrap around
+    at 2^32), so a full buffer can be distinguished from an empty one.
+*/
+template<typename T>
+class RingBuffer {
+public:
+    /**
+        Creates an empty ring buffer.
+        \param  capacity    the number of elements the buffer can hold (must be a power of two)
+    */
+    RingBuffer(Uint32 capacity) : capacity(capacity), readPos(0), writePos(0) {
+        pData = new T[capacity];
+    }
+
+    ~RingBuffer() {
+        delete [] pData;
+    }
+
+    /**
+        Returns the number of elements that can be read. If this is called by another thread than the reading thread the
+        result may already be outdated when it is returned.
+        \return the number of readable elements
+    */
+    inline Uint32 getReadAvailable() const {
+        return writePos - readPos;
+    }
+
+    /**
+        Returns the number of elements that can be written. May only be called by the writing thread.
+        \return the number of writable elements
+    */
+    inline Uint32 getWriteAvailable() const {
+        return capacity - (writePos - readPos);
+    }
+
+    /**
+        Appends up to num elements to the buffer. May only be called by the writing thread.
+        \param  pSrc    the elements to write
+        \param  num     the number of elements to write
+        \return the number of elements written (less than num if the buffer is full)
+    */
+    Uint32 write(const T* pSrc, Uint32 num) {
+        Uint32 currentWritePos = writePos;
+        memoryBarrier();    // the reader must have finished reading the elements before we overwrite them
+        Uint32 numToWrite = capacity - (currentWritePos - readPos);
+        if(num < numToWrite) {
+            numToWrite = num;
+        }
+
+        Uint32 start = currentWritePos & (capacity - 1);
+        Uint32 numFirstPart = (capacity - start < numToWrite) ? (capacity - start) : numToWrite;
+        memcpy(pData + start, pSrc, numFirstPart*sizeof(T));
+        memcpy(pData, pSrc + numFirstPart, (numToWrite - numFirstPart)*sizeof(T));
+
+        memoryBarrier();    // the elements must be written before the reader sees the new write position
+        writePos = currentWritePos + numToWrite;
+        return numToWrite;
+    }
+
+    /**
+        Removes up to num elements from the buffer. May only be called by the reading thread.
+        \param  pDest   the read elements are stored here
+        \param  num     the number of elements to read
+        \return the number of elements read (less than num if the buffer is empty)
+    */
+    Uint32 read(T* pDest, Uint32 num) {
+        Uint32 currentReadPos = readPos;
+        Uint32 numToRead = writePos - currentReadPos;
+        memoryBarrier();    // the elements must not be read before the write position
+        if(num < numToRead) {
+            numToRead = num;
+        }
+
+        Uint32 start = currentReadPos & (capacity - 1);
+        Uint32 numFirstPart = (capacity - start < numToRead) ? (capacity - start) : numToRead;
+        memcpy(pDest, pData + start, numFirstPart*sizeof(T));
+        memcpy(pDest + numFirstPart, pData, (numToRead - numFirstPart)*sizeof(T));
+
+        memoryBarrier();    // the elements must be read before the writer may overwrite them
+        readPos = currentReadPos + numToRead;
+        return numToRead;
+    }
+
+private:
+    RingBuffer(const RingBuffer&);              ///< not copyable
+    RingBuffer& operator=(const RingBuffer&);   ///< not copyable
+
+    const Uint32    capacity;           ///< the number of elements in pData (a power of two)
+    T*              pData;              ///< the elements
+    volatile Uint32 readPos;            ///< the number of elements read so far (only changed by the reading thread)
+    volatile Uint32 writePos;           ///< the number of elements written so far (only changed by the writing thread)
+};
+
+#endif // RINGBUFFER_H
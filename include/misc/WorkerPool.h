@@ -0,0 +1,91 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <misc/functional.h>
+
+#include <SDL.h>
+#include <SDL_thread.h>
+
+#include <vector>
+#include <stddef.h>
+
+/**
+    The WorkerPool owns a fixed number of worker threads that are used to run independent tasks in parallel.
+    run() hands the tasks to the workers, takes part in running them on the calling thread and returns after all of them
+    are finished. The tasks are started in the order they are passed but may finish in any order, so they must not depend
+    on each other.
+*/
+class WorkerPool {
+public:
+    /**
+        Starts numThreads worker threads. With no worker threads all tasks are run on the calling thread.
+        \param  numThreads  the number of worker threads to start
+    */
+    WorkerPool(int numThreads);
+    ~WorkerPool();
+
+    /**
+        Returns the number of worker threads (not counting the thread that calls run()).
+        \return the number of worker threads
+    */
+    inline int getNumThreads() const {
+        return threads.size();
+    }
+
+    /**
+        Runs all tasks and waits until they are finished.
+        \param  tasks   the tasks to run
+    */
+    void run(const std::vector<std::function<void ()> >& tasks);
+
+    /**
+        Returns the number of processors that are available to this process.
+        \return the number of processors (at least 1)
+    */
+    static int getNumCPUs();
+
+private:
+    /**
+        The main function of the worker threads.
+        \param  data    the WorkerPool
+        \return always 0
+    */
+    static int threadMain(void* data);
+
+    /**
+        Runs tasks until no task is left to start. The mutex must be locked when calling this method; it is
+        unlocked while a task is running and locked again when the method returns.
+    */
+    void runTasks();
+
+    std::vector<SDL_Thread*>    threads;            ///< the worker threads
+
+    SDL_mutex*  mutex;                              ///< protects all following members
+    SDL_cond*   tasksAvailable;                     ///< signaled when new tasks are available or the workers shall quit
+    SDL_cond*   tasksFinished;                      ///< signaled when the last task is finished
+
+    const std::vector<std::function<void ()> >* pTasks; ///< the tasks currently run (NULL if none)
+    size_t      nextTask;                           ///< the index of the next task to start
+    size_t      numUnfinishedTasks;                 ///< the number of tasks that are not finished yet
+    bool        bQuit;                              ///< the workers shall quit
+};
+
+#endif // WORKERPOOL_H
@@ -20,6 +20,15 @@
 
 #include <SDL.h>
 
+#include <vector>
+
+/// A horizontal run of pixels inside a mask (see createMaskSpans())
+struct MaskSpan {
+    Uint16  x;          ///< the x coordinate of the first pixel (relative to the mask)
+    Uint16  y;          ///< the y coordinate of the run (relative to the mask)
+    Uint16  length;     ///< the number of pixels
+};
+
 /**
     Return the pixel value at (x, y) in surface
     NOTE: The surface must be locked before calling this!
@@ -42,6 +51,35 @@ void drawRect(SDL_Surface *surface, int x1, int y1, int x2, int y2, Uint32 color
 void replaceColor(SDL_Surface *surface, Uint32 oldColor, Uint32 newColor);
 void mapColor(SDL_Surface *surface, Uint8 colorMap[256]);
 
+/**
+    Collects all pixels inside rect of the 8-bit surface source that have the color maskColor and returns them as horizontal runs.
+    \param  source      the surface to create the mask from
+    \param  rect        the part of source to use (the returned spans are relative to the top left corner of rect)
+    \param  maskColor   the color of the pixels that belong to the mask
+    \return the spans of the mask
+*/
+std::vector<MaskSpan> createMaskSpans(SDL_Surface* source, const SDL_Rect& rect, Uint8 maskColor);
+
+/**
+    Maps all pixels of the 8-bit surface dest that are covered by spans through colorMap. The spans are placed with their
+    top left corner at (x,y) and are clipped against the clip rect of dest.
+    \param  dest        the surface to draw to
+    \param  x           the x coordinate of the mask on dest
+    \param  y           the y coordinate of the mask on dest
+    \param  spans       the mask
+    \param  colorMap    the new color for every color
+*/
+void mapColorMasked(SDL_Surface* dest, int x, int y, const std::vector<MaskSpan>& spans, const Uint8 colorMap[256]);
+
+/**
+    Calculates which color of the palette of the 8-bit surface dest results if pBlendSurface is blitted over a pixel of a certain color.
+    This can be used with mapColor() or mapColorMasked() instead of blitting pBlendSurface pixel by pixel.
+    \param  dest            the surface that provides the palette
+    \param  pBlendSurface   the surface to blend with (must be at least 1x1 pixel)
+    \param  colorMap        the resulting color for every color of the palette
+*/
+void createBlendColorMap(SDL_Surface* dest, SDL_Surface* pBlendSurface, Uint8 colorMap[256]);
+
 SDL_Surface*    copySurface(SDL_Surface* inSurface);
 
 SDL_Surface*    scaleSurface(SDL_Surface *surf, double ratio, bool freeSrcSurface = true);
@@ -0,0 +1,10 @@
+#ifndef UNORDERED_MAP_INCLUDED
+#define UNORDERED_MAP_INCLUDED
+
+#include <tr1/unordered_map>
+
+namespace std {
+	using std::tr1::unordered_map;
+}
+
+#endif //UNORDERED_MAP_INCLUDED
@@ -21,6 +21,8 @@
 // forward declaration
 class Coord;
 
+#include <misc/FixPoint.h>
+
 #include <cmath>
 
 float fixFloat(float number);
@@ -30,9 +32,29 @@ int getRandomOf(int numParam, ...);
 
 float destinationAngle(const Coord& p1, const Coord& p2);
 
+/**
+    Calculates the angle from (x,y) to (to_x,to_y) in world coordinates.
+    \param  x       the x-coordinate of the start point
+    \param  y       the y-coordinate of the start point
+    \param  to_x    the x-coordinate of the destination
+    \param  to_y    the y-coordinate of the destination
+    \return the angle in 256th of a full circle (0 is right, 64 is up)
+*/
+FixPoint destinationAngle(const FixPoint& x, const FixPoint& y, const FixPoint& to_x, const FixPoint& to_y);
+
 float distanceFrom(const Coord& p1, const Coord& p2);
 float distanceFrom(float x, float y, float to_x, float to_y);
 
+/**
+    Calculates the euclidean distance between (x,y) and (to_x,to_y).
+    \param  x       the x-coordinate of the start point
+    \param  y       the y-coordinate of the start point
+    \param  to_x    the x-coordinate of the destination
+    \param  to_y    the y-coordinate of the destination
+    \return the distance
+*/
+FixPoint distanceFrom(const FixPoint& x, const FixPoint& y, const FixPoint& to_x, const FixPoint& to_y);
+
 float blockDistance(const Coord& p1, const Coord& p2);
 
 int mirrorAngleHorizontal(int angle);
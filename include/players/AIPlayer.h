@@ -37,6 +37,8 @@ public:
 
     virtual void update();
 
+    virtual bool wantsToThink() const;
+
     virtual void onIncrementStructures(int itemID);
     virtual void onDecrementStructures(int itemID, const Coord& location);
     virtual void onDamage(const ObjectBase* pObject, int damage, Uint32 damagerID);
@@ -49,6 +51,9 @@ public:
         return new AIPlayer(stream, associatedHouse);
 	}
 
+protected:
+    virtual void onThink();
+
 private:
 	AIPlayer(House* associatedHouse, std::string playername, Uint8 difficulty);
 	AIPlayer(InputStream& stream, House* associatedHouse);
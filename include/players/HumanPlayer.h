@@ -62,6 +62,7 @@ public:
 
 public:
     Uint32 nextExpectedCommandsCycle;                       ///< The next cycle we expect commands for (using for network games)
+    Uint32 acknowledgedCommandsCycle;                       ///< This player has received our commands for all cycles before this cycle (using for network games)
 
     std::set<Uint32> selectedLists[NUMSELECTEDLISTS];       ///< Sets of all the different groups on key 1 to 9
 
@@ -37,6 +37,8 @@ public:
 
     virtual void update();
 
+    virtual bool wantsToThink() const;
+
     virtual void onIncrementStructures(int itemID);
     virtual void onDecrementStructures(int itemID, const Coord& location);
     virtual void onDamage(const ObjectBase* pObject, int damage, Uint32 damagerID);
@@ -53,6 +55,9 @@ public:
         return new OldAIPlayer(stream, associatedHouse);
 	}
 
+protected:
+    virtual void onThink();
+
 private:
 	OldAIPlayer(House* associatedHouse, std::string playername, Uint8 difficulty);
 	OldAIPlayer(InputStream& stream, House* associatedHouse);
@@ -21,10 +21,12 @@
 #include <DataTypes.h>
 #include <misc/InputStream.h>
 #include <misc/OutputStream.h>
-#include <misc/RobustList.h>
+#include <misc/Random.h>
+#include <misc/functional.h>
+
+#include <vector>
 
 class GameInitSettings;
-class Random;
 class Map;
 class House;
 class ObjectBase;
@@ -49,6 +51,30 @@ public:
 
     virtual void update() = 0;
 
+    /**
+        Checks if this player wants to think in the current game cycle. If so, think() is called before the houses are updated.
+        \return true if think() shall be called in this game cycle, false otherwise
+    */
+    virtual bool wantsToThink() const { return false; };
+
+    /**
+        Lets this player evaluate the game and plan its actions by calling onThink(). All do*() calls made while thinking are
+        only recorded and executed later by executeDeferredActions(). This method may be called on a worker thread while
+        other players are thinking as well (see Game::thinkPlayers()).
+    */
+    void think();
+
+    /**
+        Executes all actions recorded by think() in the order they were issued.
+    */
+    void executeDeferredActions();
+
+    /**
+        Copies the global unit and structure lists into the lists returned by getUnitList() and getStructureList(). This must be
+        called before the players start thinking, so that they can read these lists at the same time.
+    */
+    static void freezeObjectLists();
+
     virtual void onIncrementStructures(int itemID) { };
     virtual void onDecrementStructures(int itemID, const Coord& location) { };
 
@@ -70,6 +96,18 @@ public:
     void setPlayerclass(std::string playerclass) { this->playerclass = playerclass; };
 
 protected:
+    /**
+        Called by think(). Other players may think at the same time, so the game state may only be read here. Only the own members
+        and the own random generator may be changed, objects must be iterated with getUnitList() and getStructureList() and all actions
+        must be issued with the do*() methods.
+    */
+    virtual void onThink() { };
+
+    /**
+        Returns the random generator of this player. Every player has its own random generator, so players can think in parallel
+        without changing the random numbers of the game or of the other players.
+        \return the random generator of this player
+    */
     Random& getRandomGen() const;
     const GameInitSettings& getGameInitSettings() const;
     Uint32 getGameCylceCount() const;
@@ -77,8 +115,21 @@ protected:
     const Map& getMap() const;
     const ObjectBase* getObject(Uint32 objectID) const;
 
-    const RobustList<const StructureBase*>& getStructureList() const;
-    const RobustList<const UnitBase*>& getUnitList() const;
+    /**
+        Returns all structures. While thinking this is the list copied by freezeObjectLists(); otherwise the list is copied
+        again if structures were created or destroyed since it was copied, so the returned list must not be used after calling
+        this method again.
+        \return all structures of the game
+    */
+    const std::vector<const StructureBase*>& getStructureList() const;
+
+    /**
+        Returns all units. While thinking this is the list copied by freezeObjectLists(); otherwise the list is copied
+        again if units were created or destroyed since it was copied, so the returned list must not be used after calling
+        this method again.
+        \return all units of the game
+    */
+    const std::vector<const UnitBase*>& getUnitList() const;
 
     const House* getHouse(int houseID) const;
 
@@ -100,7 +151,7 @@ protected:
     /**
         Start upgrading pBuilder.
         \param  pBuilder  the structure to upgrade
-        \return true if upgrading was started, false if not possible or already upgrading
+        \return true if upgrading was started (or deferred because this player is thinking), false if not possible or already upgrading
     */
     bool doUpgrade(const BuilderBase* pBuilder);
 
@@ -143,7 +194,7 @@ protected:
         \param  pConstYard  the construction yard that has produced the structure
         \param  x           the x coordinate (in tile coordinates)
         \param  y           the y coordinate (in tile coordinates)
-        \return true if placement was successful, false otherwise
+        \return true if placement was successful (or deferred because this player is thinking), false otherwise
     */
     bool doPlaceStructure(const ConstructionYard* pConstYard, int x, int y);
 
@@ -231,7 +282,7 @@ protected:
 	/**
        Deploy MCV pMCV. If deploying was successful this unit does not exist anymore.
        \param  pMCV the MCV to deploy
-       \return true, if deploying was successful, false otherwise.
+       \return true, if deploying was successful (or deferred because this player is thinking), false otherwise.
 	*/
 	bool doDeploy(const MCV* pMCV);
 
@@ -239,10 +290,40 @@ protected:
 private:
     friend class House;
 
+    /// An action issued while thinking
+    struct DeferredAction {
+        std::function<void ()> action;      ///< the do*() call to execute
+        Uint32 objectIDs[2];                ///< the objects the action refers to (NONE if unused)
+    };
+
+    /**
+        Records action for executeDeferredActions(). The action is dropped if pObject1 or pObject2 does not exist anymore when
+        the action shall be executed (e.g. because an action of another player destroyed it).
+        \param  action      the do*() call
+        \param  pObject1    the first object the action refers to (may be NULL)
+        \param  pObject2    the second object the action refers to (may be NULL)
+    */
+    void deferAction(const std::function<void ()>& action, const ObjectBase* pObject1, const ObjectBase* pObject2 = NULL);
+
+    /// Copies the global structure list into frozenStructureList
+    static void freezeStructureList();
+
+    /// Copies the global unit list into frozenUnitList
+    static void freezeUnitList();
+
     House* pHouse;
     Uint8 playerID;
     std::string playername;
     std::string playerclass;
+
+    mutable Random randomGen;                                   ///< the random generator of this player
+    bool bThinking;                                             ///< true while think() is running
+    std::vector<DeferredAction> deferredActions;                ///< the actions issued while thinking
+
+    static std::vector<const StructureBase*> frozenStructureList;   ///< the structures copied by freezeObjectLists()
+    static std::vector<const UnitBase*> frozenUnitList;             ///< the units copied by freezeObjectLists()
+    static Uint32 frozenStructureListModificationCount;             ///< the modification count of structureList when frozenStructureList was copied
+    static Uint32 frozenUnitListModificationCount;                  ///< the modification count of unitList when frozenUnitList was copied
 };
 
 #endif // PLAYER_H
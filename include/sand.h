@@ -70,6 +70,7 @@ inline int missionNumberToLevelNumber(int missionNumber) {
 }
 
 void startReplay(std::string filename);
+std::string benchmarkReplay(std::string filename, Uint32 maxCycles);
 void startSinglePlayerGame(const GameInitSettings& init);
 void startMultiPlayerGame(const GameInitSettings& init);
 
@@ -198,7 +198,7 @@ public:
 
 	virtual int getCurrentAttackAngle() const;
 
-    virtual float getMaxSpeed() const;
+    virtual FixPoint getMaxSpeed() const;
 
 	inline void clearPath() {
         pathList.clear();
@@ -232,7 +232,7 @@ protected:
 	virtual void engageTarget();
 	virtual void move();
 
-    virtual void bumpyMovementOnRock(float fromDistanceX, float fromDistanceY, float toDistanceX, float toDistanceY);
+    virtual void bumpyMovementOnRock(FixPoint fromDistanceX, FixPoint fromDistanceY, FixPoint toDistanceX, FixPoint toDistanceY);
 
 	virtual void navigate();
 
@@ -243,6 +243,12 @@ protected:
 
 	virtual void setSpeeds();
 
+    /**
+        Sets xSpeed and ySpeed so that this unit moves with speed into the direction of drawnAngle.
+        \param  speed   the speed of this unit
+    */
+    void setSpeedsForDrawnAngle(FixPoint speed);
+
 	virtual void targeting();
 
 	virtual void turn();
@@ -272,10 +278,10 @@ protected:
     bool    moving;                 ///< Are we currently moving?
     bool    turning;                ///< Are we currently turning?
     bool    justStoppedMoving;      ///< Do we have just stopped moving?
-    float	xSpeed;                 ///< Speed in x direction
-    float	ySpeed;                 ///< Speed in y direction
-    float   bumpyOffsetX;           ///< The bumpy offset in x direction which is already included in realX
-    float   bumpyOffsetY;           ///< The bumpy offset in y direction which is already included in realY
+    FixPoint xSpeed;                ///< Speed in x direction
+    FixPoint ySpeed;                ///< Speed in y direction
+    FixPoint bumpyOffsetX;          ///< The bumpy offset in x direction which is already included in realX
+    FixPoint bumpyOffsetY;          ///< The bumpy offset in y direction which is already included in realY
 
     float	targetDistance;         ///< Distance to the destination
     Sint8   targetAngle;            ///< Angle to the destination
@@ -27,14 +27,52 @@
 
 #define MAX_NODES_CHECKED   (128*128)
 
-AStarSearch::AStarSearch(Map* pMap, UnitBase* pUnit, Coord start, Coord destination) {
+AStarSearch::Workspace::Workspace()
+ : sizeX(0), sizeY(0), currentGeneration(0), mapData(NULL) {
+}
+
+AStarSearch::Workspace::~Workspace() {
+    free(mapData);
+}
+
+void AStarSearch::Workspace::beginSearch(int sizeX, int sizeY) {
+    if((mapData == NULL) || (this->sizeX != sizeX) || (this->sizeY != sizeY)) {
+        free(mapData);
+        mapData = (TileData*) calloc(sizeX*sizeY, sizeof(TileData));
+        if(mapData == NULL) {
+            throw std::bad_alloc();
+        }
+
+        this->sizeX = sizeX;
+        this->sizeY = sizeY;
+        currentGeneration = 0;
+
+        openList.reserve(sizeX*sizeY);
+    }
+
+    currentGeneration++;
+    if(currentGeneration == 0) {
+        // the generation counter wrapped around => old tile data might look current again
+        for(int i = 0; i < sizeX*sizeY; i++) {
+            mapData[i].generation = 0;
+        }
+        currentGeneration = 1;
+    }
+
+    openList.clear();
+    depthCheckCount.assign(std::min(sizeX, sizeY), 0);
+}
+
+AStarSearch::AStarSearch(Map* pMap, UnitBase* pUnit, Coord start, Coord destination)
+ : openList(pMap->getAStarSearchWorkspace().openList) {
+    Workspace& workspace = pMap->getAStarSearchWorkspace();
+
     sizeX = pMap->getSizeX();
     sizeY = pMap->getSizeY();
 
-    mapData = (TileData*) calloc(sizeX*sizeY, sizeof(TileData));
-    if(mapData == NULL) {
-        throw std::bad_alloc();
-    }
+    workspace.beginSearch(sizeX, sizeY);
+    generation = workspace.currentGeneration;
+    mapData = workspace.mapData;
 
     float heuristic = blockDistance(start, destination);
     float smallestHeuristic = heuristic;
@@ -45,7 +83,7 @@ AStarSearch::AStarSearch(Map* pMap, UnitBase* pUnit, Coord start, Coord destinat
 
         putOnOpenListIfBetter(start, Coord::Invalid(), 0.0f, heuristic);
 
-        std::vector<short> depthCheckCount(std::min(sizeX, sizeY));
+        std::vector<short>& depthCheckCount = workspace.depthCheckCount;
 
         int numNodesChecked = 0;
         while(openList.empty() == false) {
@@ -153,6 +191,5 @@ AStarSearch::AStarSearch(Map* pMap, UnitBase* pUnit, Coord start, Coord destinat
 }
 
 AStarSearch::~AStarSearch() {
-    free(mapData);
 }
 
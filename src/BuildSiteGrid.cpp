@@ -0,0 +1,156 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <BuildSiteGrid.h>
+
+#include <Map.h>
+#include <Tile.h>
+#include <Definitions.h>
+
+#include <algorithm>
+
+BuildSiteGrid::BuildSiteGrid(Map* pMap)
+ : pMap(pMap), sizeX(0), sizeY(0), bSandChanged(false) {
+}
+
+BuildSiteGrid::~BuildSiteGrid() {
+}
+
+void BuildSiteGrid::reset() {
+    sizeX = pMap->getSizeX();
+    sizeY = pMap->getSizeY();
+
+    const int numTiles = sizeX*sizeY;
+
+    buildRangeCounts.clear();
+    buildRangeCounts.resize(NUM_HOUSES*numTiles, 0);
+
+    sandFlags.clear();
+    sandFlags.resize(numTiles, false);
+
+    for(int y = 0; y < sizeY; y++) {
+        for(int x = 0; x < sizeX; x++) {
+            const Tile* pTile = pMap->getTile(x,y);
+
+            onTileOwnerChanged(Coord(x,y), INVALID, pTile->getOwner());
+
+            sandFlags[y*sizeX + x] = !pTile->isRock();
+        }
+    }
+
+    bSandChanged = true;
+}
+
+void BuildSiteGrid::onTileOwnerChanged(const Coord& location, int oldOwner, int newOwner) {
+    if((oldOwner == newOwner) || buildRangeCounts.empty()) {
+        return;
+    }
+
+    const int numTiles = sizeX*sizeY;
+
+    for(int y = std::max(location.y - BUILDRANGE, 0); y <= std::min(location.y + BUILDRANGE, sizeY - 1); y++) {
+        for(int x = std::max(location.x - BUILDRANGE, 0); x <= std::min(location.x + BUILDRANGE, sizeX - 1); x++) {
+            if((oldOwner >= 0) && (oldOwner < NUM_HOUSES)) {
+                buildRangeCounts[oldOwner*numTiles + y*sizeX + x]--;
+            }
+
+            if((newOwner >= 0) && (newOwner < NUM_HOUSES)) {
+                buildRangeCounts[newOwner*numTiles + y*sizeX + x]++;
+            }
+        }
+    }
+}
+
+void BuildSiteGrid::onTerrainChanged(const Coord& location) {
+    if(!pMap->tileExists(location) || sandFlags.empty()) {
+        return;
+    }
+
+    const Tile* pTile = pMap->getTile(location);
+    const int tileIndex = location.y*sizeX + location.x;
+
+    if(sandFlags[tileIndex] != !pTile->isRock()) {
+        sandFlags[tileIndex] = !pTile->isRock();
+        bSandChanged = true;
+    }
+}
+
+void BuildSiteGrid::update() {
+    if(bSandChanged) {
+        computeNearestTiles(sandFlags, nearestSandTile);
+        bSandChanged = false;
+    }
+}
+
+bool BuildSiteGrid::isWithinBuildRange(int x, int y, int houseID) const {
+    if((x < 0) || (x >= sizeX) || (y < 0) || (y >= sizeY) || (houseID < 0) || (houseID >= NUM_HOUSES)) {
+        return false;
+    }
+
+    return (buildRangeCounts[houseID*sizeX*sizeY + y*sizeX + x] > 0);
+}
+
+Coord BuildSiteGrid::getNearestSand(const Coord& location) const {
+    if((location.x < 0) || (location.x >= sizeX) || (location.y < 0) || (location.y >= sizeY) || nearestSandTile.empty()) {
+        return Coord::Invalid();
+    }
+
+    return getTileLocation(nearestSandTile[location.y*sizeX + location.x]);
+}
+
+void BuildSiteGrid::computeNearestTiles(const std::vector<bool>& sourceFlags, std::vector<Sint32>& nearestTile) const {
+    const int numTiles = sizeX*sizeY;
+
+    nearestTile.clear();
+    nearestTile.resize(numTiles, -1);
+
+    std::vector<Sint32> queue;
+    queue.reserve(numTiles);
+
+    for(int i = 0; i < numTiles; i++) {
+        if(sourceFlags[i]) {
+            nearestTile[i] = i;
+            queue.push_back(i);
+        }
+    }
+
+    // every tile inherits the nearest tile of the neighbour it was reached from first
+    for(size_t head = 0; head < queue.size(); head++) {
+        const int tileIndex = queue[head];
+        const int x = tileIndex % sizeX;
+        const int y = tileIndex / sizeX;
+
+        for(int ny = std::max(y - 1, 0); ny <= std::min(y + 1, sizeY - 1); ny++) {
+            for(int nx = std::max(x - 1, 0); nx <= std::min(x + 1, sizeX - 1); nx++) {
+                const int neighbourIndex = ny*sizeX + nx;
+                if(nearestTile[neighbourIndex] == -1) {
+                    nearestTile[neighbourIndex] = nearestTile[tileIndex];
+                    queue.push_back(neighbourIndex);
+                }
+            }
+        }
+    }
+}
+
+Coord BuildSiteGrid::getTileLocation(Sint32 tileIndex) const {
+    if(tileIndex < 0) {
+        return Coord::Invalid();
+    }
+
+    return Coord(tileIndex % sizeX, tileIndex / sizeX);
+}
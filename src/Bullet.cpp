@@ -28,7 +28,6 @@
 #include <Explosion.h>
 
 #include <misc/draw_util.h>
-#include <misc/strictmath.h>
 
 #include <algorithm>
 
@@ -64,34 +63,33 @@ Bullet::Bullet(Uint32 shooterID, Coord* newRealLocation, Coord* newRealDestinati
 			diffY = weaponrange*TILESIZE;
 		}
 
-		float square_root = strictmath::sqrt((float)(diffX*diffX + diffY*diffY));
-		float ratio = (weaponrange*TILESIZE)/square_root;
-		destination.x = newRealLocation->x + (int)(((float)diffX)*ratio);
-		destination.y = newRealLocation->y + (int)(((float)diffY)*ratio);
+		FixPoint ratio = FixPoint(weaponrange*TILESIZE)/FixPoint::hypot(diffX, diffY);
+		destination.x = newRealLocation->x + (diffX*ratio).toInt();
+		destination.y = newRealLocation->y + (diffY*ratio).toInt();
 	} else if(bulletID == Bullet_Rocket || bulletID == Bullet_DRocket) {
-	    float distance = distanceFrom(*newRealLocation, *newRealDestination);
+	    FixPoint distance = distanceFrom(FixPoint(newRealLocation->x), FixPoint(newRealLocation->y), FixPoint(newRealDestination->x), FixPoint(newRealDestination->y));
 
 
-        float randAngle = 2.0f * strictmath::pi * currentGame->randomGen.randFloat();
-        int radius = currentGame->randomGen.rand(0,TILESIZE/2 + (distance/TILESIZE));
+        FixPoint randAngle = 256 * FixPoint::fromFloat(currentGame->randomGen.randFloat());
+        int radius = currentGame->randomGen.rand(0,TILESIZE/2 + (distance/TILESIZE).toInt());
 
-        destination.x += strictmath::cos(randAngle) * radius;
-        destination.y -= strictmath::sin(randAngle) * radius;
+        destination.x = (destination.x + FixPoint::cos(randAngle) * radius).toInt();
+        destination.y = (destination.y - FixPoint::sin(randAngle) * radius).toInt();
 
 	}
 
-	realX = (float)newRealLocation->x;
-	realY = (float)newRealLocation->y;
+	realX = newRealLocation->x;
+	realY = newRealLocation->y;
 	source.x = newRealLocation->x;
 	source.y = newRealLocation->y;
 	location.x = newRealLocation->x/TILESIZE;
 	location.y = newRealLocation->y/TILESIZE;
 
-	angle = destinationAngle(*newRealLocation, *newRealDestination);
-	drawnAngle = (int)((float)numFrames*angle/256.0);
+	angle = destinationAngle(newRealLocation->x, newRealLocation->y, newRealDestination->x, newRealDestination->y);
+	drawnAngle = (numFrames*angle/256).toInt();
 
-    xSpeed = speed * strictmath::cos(angle * conv2char);
-	ySpeed = speed * -strictmath::sin(angle * conv2char);
+    xSpeed = speed * FixPoint::cos(angle);
+	ySpeed = speed * -FixPoint::sin(angle);
 }
 
 Bullet::Bullet(InputStream& stream)
@@ -115,14 +113,14 @@ Bullet::Bullet(InputStream& stream)
 	destination.y = stream.readSint32();
     location.x = stream.readSint32();
 	location.y = stream.readSint32();
-	realX = stream.readFloat();
-	realY = stream.readFloat();
+	realX = stream.readFixPoint();
+	realY = stream.readFixPoint();
 
-    xSpeed = stream.readFloat();
-	ySpeed = stream.readFloat();
+    xSpeed = stream.readFixPoint();
+	ySpeed = stream.readFixPoint();
 
 	drawnAngle = stream.readSint8();
-    angle = stream.readFloat();
+    angle = stream.readFixPoint();
 
 	Bullet::init();
 
@@ -138,7 +136,7 @@ void Bullet::init()
 	switch(bulletID) {
         case Bullet_DRocket: {
             damageRadius = TILESIZE/2;
-            speed = 20.0f;
+            speed = 20;
             detonationTimer = 19;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_MediumRocket, houseID);
@@ -146,7 +144,7 @@ void Bullet::init()
 
         case Bullet_LargeRocket: {
             damageRadius = TILESIZE;
-            speed = 20.0f;
+            speed = 20;
             detonationTimer = -1;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_LargeRocket, houseID);
@@ -154,7 +152,7 @@ void Bullet::init()
 
         case Bullet_Rocket: {
             damageRadius = TILESIZE/2;
-            speed = 17.5f;
+            speed = FixPoint::fromFloat(17.5f);
             detonationTimer = 22;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_MediumRocket, houseID);
@@ -162,7 +160,7 @@ void Bullet::init()
 
         case Bullet_TurretRocket: {
             damageRadius = TILESIZE/2;
-            speed = 20.0f;
+            speed = 20;
             detonationTimer = -1;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_MediumRocket, houseID);
@@ -171,7 +169,7 @@ void Bullet::init()
         case Bullet_ShellSmall: {
             damageRadius = TILESIZE/2;
             explodesAtGroundObjects = true;
-            speed = 20.0f;
+            speed = 20;
             detonationTimer = -1;
             numFrames = 1;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_Small, houseID);
@@ -180,7 +178,7 @@ void Bullet::init()
         case Bullet_ShellMedium: {
             damageRadius = TILESIZE/2;
             explodesAtGroundObjects = true;
-            speed = 20.0f;
+            speed = 20;
             detonationTimer = -1;
             numFrames = 1;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_Medium, houseID);
@@ -189,7 +187,7 @@ void Bullet::init()
         case Bullet_ShellLarge: {
             damageRadius = TILESIZE/2;
             explodesAtGroundObjects = true;
-            speed = 20.0f;
+            speed = 20;
             detonationTimer = -1;
             numFrames = 1;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_Large, houseID);
@@ -197,7 +195,7 @@ void Bullet::init()
 
         case Bullet_SmallRocket: {
             damageRadius = TILESIZE/2;
-            speed = 20.0f;
+            speed = 20;
             detonationTimer = 7;
             numFrames = 16;
             graphic = pGFXManager->getObjPic(ObjPic_Bullet_SmallRocket, houseID);
@@ -205,7 +203,7 @@ void Bullet::init()
 
         case Bullet_Sonic: {
             damageRadius = (TILESIZE*3)/4;
-            speed = 9.0f;
+            speed = 9;
             numFrames = 1;
             detonationTimer = 28;
             SDL_Surface** tmpSurfaceStack = pGFXManager->getObjPic(ObjPic_Bullet_Sonic, houseID);
@@ -255,14 +253,14 @@ void Bullet::save(OutputStream& stream) const
 	stream.writeSint32(destination.y);
     stream.writeSint32(location.x);
 	stream.writeSint32(location.y);
-	stream.writeFloat(realX);
-	stream.writeFloat(realY);
+	stream.writeFixPoint(realX);
+	stream.writeFixPoint(realY);
 
-    stream.writeFloat(xSpeed);
-	stream.writeFloat(ySpeed);
+    stream.writeFixPoint(xSpeed);
+	stream.writeFixPoint(ySpeed);
 
 	stream.writeSint8(drawnAngle);
-    stream.writeFloat(angle);
+    stream.writeFixPoint(angle);
 
     stream.writeSint8(detonationTimer);
 }
@@ -273,7 +271,7 @@ void Bullet::blitToScreen()
     int imageW = graphic[currentZoomlevel]->w/numFrames;
     int imageH = graphic[currentZoomlevel]->h;
 
-	if(screenborder->isInsideScreen( Coord(lround(realX), lround(realY)), Coord(imageW, imageH)) == false) {
+	if(screenborder->isInsideScreen( Coord(realX.roundToInt(), realY.roundToInt()), Coord(imageW, imageH)) == false) {
         return;
 	}
 
@@ -353,16 +351,16 @@ void Bullet::update()
 {
 	if(bulletID == Bullet_Rocket || bulletID == Bullet_DRocket) {
 
-        float angleToDestination = destinationAngle(Coord(realX, realY), destination);
+        FixPoint angleToDestination = destinationAngle(realX, realY, destination.x, destination.y);
 
-        float angleDiff = angleToDestination - angle;
-        if(angleDiff > 128.0f) {
-            angleDiff -= 256.0f;
-        } else if(angleDiff < -128.0f) {
-            angleDiff += 256.0f;
+        FixPoint angleDiff = angleToDestination - angle;
+        if(angleDiff > 128) {
+            angleDiff -= 256;
+        } else if(angleDiff < -128) {
+            angleDiff += 256;
         }
 
-        static const float turnSpeed = 4.5f;
+        static const FixPoint turnSpeed = FixPoint::fromFloat(4.5f);
 
         if(angleDiff >= turnSpeed) {
             angleDiff = turnSpeed;
@@ -372,25 +370,25 @@ void Bullet::update()
 
         angle += angleDiff;
 
-        if(angle < 0.0f) {
-            angle += 256.0f;
-        } else if(angle >= 256.0f) {
-            angle -= 256.0f;
+        if(angle < 0) {
+            angle += 256;
+        } else if(angle >= 256) {
+            angle -= 256;
         }
 
-        xSpeed = speed * strictmath::cos(angle * conv2char);
-        ySpeed = speed * -strictmath::sin(angle * conv2char);
+        xSpeed = speed * FixPoint::cos(angle);
+        ySpeed = speed * -FixPoint::sin(angle);
 
-        drawnAngle = (int)((float)numFrames*angle/256.0);
+        drawnAngle = (numFrames*angle/256).toInt();
     }
 
 
-	float oldDistanceToDestination = distanceFrom(realX, realY, destination.x, destination.y);
+	FixPoint oldDistanceToDestination = distanceFrom(realX, realY, destination.x, destination.y);
 
 	realX += xSpeed;  //keep the bullet moving by its current speeds
 	realY += ySpeed;
-	location.x = (int)(realX/TILESIZE);
-	location.y = (int)(realY/TILESIZE);
+	location.x = (realX/TILESIZE).toInt();
+	location.y = (realY/TILESIZE).toInt();
 
 	if((location.x < -5) || (location.x >= currentGameMap->getSizeX() + 5) || (location.y < -5) || (location.y >= currentGameMap->getSizeY() + 5)) {
         // it's off the map => delete it
@@ -398,7 +396,7 @@ void Bullet::update()
         delete this;
         return;
 	} else {
-        float newDistanceToDestination = distanceFrom(realX, realY, destination.x, destination.y);
+        FixPoint newDistanceToDestination = distanceFrom(realX, realY, destination.x, destination.y);
 
         if(detonationTimer > 0) {
             detonationTimer--;
@@ -411,24 +409,24 @@ void Bullet::update()
                 return;
             }
 
-            float weaponDamage = currentGame->objectData.data[Unit_SonicTank][(owner == NULL) ? HOUSE_ATREIDES : owner->getHouseID()].weapondamage;
+            int weaponDamage = currentGame->objectData.data[Unit_SonicTank][(owner == NULL) ? HOUSE_ATREIDES : owner->getHouseID()].weapondamage;
 
-	        float startDamage = (weaponDamage / 4.0f + 1.0f) / 3.0f;
-	        float endDamage = ((weaponDamage-9) / 4.0f + 1.0f) / 3.0f;
+	        FixPoint startDamage = (FixPoint(weaponDamage) / 4 + 1) / 3;
+	        FixPoint endDamage = (FixPoint(weaponDamage-9) / 4 + 1) / 3;
 
-		    float damageDecrease = - (startDamage-endDamage)/(30.0f * 2.0f * speed);
-		    float dist = distanceFrom(source.x, source.y, realX, realY);
+		    FixPoint damageDecrease = - (startDamage-endDamage)/(30 * 2 * speed);
+		    FixPoint dist = distanceFrom(source.x, source.y, realX, realY);
 
-		    float currentDamage = dist*damageDecrease + startDamage;
+		    FixPoint currentDamage = dist*damageDecrease + startDamage;
 
-            Coord realPos = Coord(lround(realX), lround(realY));
-            currentGameMap->damage(shooterID, owner, realPos, bulletID, currentDamage/2.0f, damageRadius, false);
+            Coord realPos = Coord(realX.roundToInt(), realY.roundToInt());
+            currentGameMap->damage(shooterID, owner, realPos, bulletID, currentDamage/2, damageRadius, false);
 
             realX += xSpeed;  //keep the bullet moving by its current speeds
             realY += ySpeed;
 
-            realPos = Coord(lround(realX), lround(realY));
-            currentGameMap->damage(shooterID, owner, realPos, bulletID, currentDamage/2.0f, damageRadius, false);
+            realPos = Coord(realX.roundToInt(), realY.roundToInt());
+            currentGameMap->damage(shooterID, owner, realPos, bulletID, currentDamage/2, damageRadius, false);
 		} else if( explodesAtGroundObjects
                     && currentGameMap->tileExists(location)
                     && currentGameMap->getTile(location)->hasAGroundObject()
@@ -455,7 +453,7 @@ void Bullet::update()
 
 void Bullet::destroy()
 {
-    Coord position = Coord(lround(realX), lround(realY));
+    Coord position = Coord(realX.roundToInt(), realY.roundToInt());
 
     int houseID = (owner == NULL) ? HOUSE_HARKONNEN : owner->getHouseID();
 
@@ -472,8 +470,8 @@ void Bullet::destroy()
             for(int i = 0; i < 5; i++) {
                 for(int j = 0; j < 5; j++) {
                     if (((i != 0) && (i != 4)) || ((j != 0) && (j != 4))) {
-                        position.x = lround(realX) + (i - 2)*TILESIZE;
-                        position.y = lround(realY) + (j - 2)*TILESIZE;
+                        position.x = realX.roundToInt() + (i - 2)*TILESIZE;
+                        position.y = realY.roundToInt() + (j - 2)*TILESIZE;
 
                         currentGameMap->damage(shooterID, owner, position, bulletID, damage, damageRadius, airAttack);
 
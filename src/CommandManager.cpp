@@ -20,18 +20,34 @@
 #include <Network/NetworkManager.h>
 #include <players/HumanPlayer.h>
 
+#include <misc/OFileStream.h>
+
 #include <globals.h>
 
 #include <Game.h>
 
 #include <algorithm>
 
+/// the initial number of cycles the ring buffer can hold (must be a power of two)
+#define INITIALTIMESLOTS    256
+
+/// commands of a replay are read this many cycles in advance. The commands in a replay are not strictly ordered by cycle when commands of other peers were received late.
+#define REPLAYREADAHEAD     1024
+
 bool compareCommands(Command cmd1, Command cmd2) {
     return (cmd1.getPlayerID() < cmd2.getPlayerID());
 }
 
 CommandManager::CommandManager() {
+	timeslot.resize(INITIALTIMESLOTS);
+	firstCycle = 0;
+	endCycle = 0;
+	firstKeptCycle = 0;
+	firstUnacknowledgedCycle = 0;
 	pStream = NULL;
+	pReplayStream = NULL;
+	pNextReplayCommand = NULL;
+	nextReplayCommandCycle = 0;
 	bReadOnly = false;
 	networkCycleBuffer = 0;
 }
@@ -39,6 +55,20 @@ CommandManager::CommandManager() {
 CommandManager::~CommandManager() {
     delete pStream;
     pStream = NULL;
+
+    delete pReplayStream;
+    pReplayStream = NULL;
+
+    delete pNextReplayCommand;
+    pNextReplayCommand = NULL;
+}
+
+void CommandManager::setReplayStream(InputStream* pReplayStream) {
+    delete this->pReplayStream;
+    this->pReplayStream = pReplayStream;
+
+    delete pNextReplayCommand;
+    pNextReplayCommand = NULL;
 }
 
 void CommandManager::addCommand(Command cmd) {
@@ -50,9 +80,111 @@ void CommandManager::addCommand(Command cmd) {
 	addCommand(cmd, CycleNumber);
 }
 
+void CommandManager::addKeyframe(Uint32 CycleNumber, const std::string& keyframe) {
+    OFileStream* pFileStream = dynamic_cast<OFileStream*>(pStream);
+    if(pFileStream == NULL) {
+        return;
+    }
+
+    keyframeIndex.push_back(std::make_pair(CycleNumber, pFileStream->getPosition()));
+
+    pStream->writeUint32(REPLAYKEYFRAME);
+    pStream->writeUint32(CycleNumber);
+    pStream->writeString(keyframe);
+}
+
+void CommandManager::writeKeyframeIndex() {
+    OFileStream* pFileStream = dynamic_cast<OFileStream*>(pStream);
+    if(pFileStream == NULL) {
+        return;
+    }
+
+    Uint32 indexPosition = pFileStream->getPosition();
+
+    pStream->writeUint32(REPLAYKEYFRAMEINDEX);
+    pStream->writeUint32(keyframeIndex.size());
+    std::vector< std::pair<Uint32, Uint32> >::const_iterator iter;
+    for(iter = keyframeIndex.begin(); iter != keyframeIndex.end(); ++iter) {
+        pStream->writeUint32(iter->first);
+        pStream->writeUint32(iter->second);
+    }
+    pStream->writeUint32(indexPosition);
+    pStream->writeUint32(REPLAYKEYFRAMEMAGIC);
+
+    pStream->flush();
+}
+
+void CommandManager::readKeyframeIndex(IFileStream& stream) {
+    keyframeIndex.clear();
+
+    Uint32 oldPosition = stream.getPosition();
+    Uint32 size = stream.getSize();
+
+    try {
+        if((size >= 2*sizeof(Uint32)) && stream.setPosition(size - 2*sizeof(Uint32))) {
+            Uint32 indexPosition = stream.readUint32();
+
+            if((stream.readUint32() == REPLAYKEYFRAMEMAGIC) && stream.setPosition(indexPosition) && (stream.readUint32() == REPLAYKEYFRAMEINDEX)) {
+                Uint32 numKeyframes = stream.readUint32();
+                for(Uint32 i = 0; i < numKeyframes; i++) {
+                    Uint32 cycle = stream.readUint32();
+                    Uint32 position = stream.readUint32();
+                    keyframeIndex.push_back(std::make_pair(cycle, position));
+                }
+            }
+        }
+    } catch (InputStream::exception&) {
+        fprintf(stderr, "CommandManager::readKeyframeIndex(): The keyframe index of the replay is damaged!\n");
+        keyframeIndex.clear();
+    }
+
+    stream.setPosition(oldPosition);
+}
+
+Uint32 CommandManager::getKeyframeCycle(Uint32 CycleNumber) const {
+    Uint32 keyframeCycle = 0;
+
+    std::vector< std::pair<Uint32, Uint32> >::const_iterator iter;
+    for(iter = keyframeIndex.begin(); (iter != keyframeIndex.end()) && (iter->first <= CycleNumber); ++iter) {
+        keyframeCycle = iter->first;
+    }
+
+    return keyframeCycle;
+}
+
+bool CommandManager::loadKeyframe(IFileStream& stream, Uint32 CycleNumber, std::string& keyframe) {
+    Uint32 keyframeCycle = getKeyframeCycle(CycleNumber);
+    if(keyframeCycle == 0) {
+        return false;
+    }
+
+    Uint32 keyframePosition = 0;
+    std::vector< std::pair<Uint32, Uint32> >::const_iterator iter;
+    for(iter = keyframeIndex.begin(); iter != keyframeIndex.end(); ++iter) {
+        if(iter->first == keyframeCycle) {
+            keyframePosition = iter->second;
+        }
+    }
+
+    Uint32 oldPosition = stream.getPosition();
+
+    try {
+        if(stream.setPosition(keyframePosition) && (stream.readUint32() == REPLAYKEYFRAME) && (stream.readUint32() == keyframeCycle)) {
+            keyframe = stream.readString();
+            return true;
+        }
+    } catch (InputStream::exception&) {
+        ;
+    }
+
+    fprintf(stderr, "CommandManager::loadKeyframe(): Cannot read the keyframe at cycle %d!\n", keyframeCycle);
+    stream.setPosition(oldPosition);
+    return false;
+}
+
 void CommandManager::save(OutputStream& stream) const {
-	for(unsigned int i=0;i<timeslot.size();i++) {
-		const std::vector<Command>& cmdlist = timeslot[i];
+	for(Uint32 i = firstCycle; i < endCycle; i++) {
+		const std::vector<Command>& cmdlist = *getTimeslot(i);
 		std::vector<Command>::const_iterator iter;
 
 		for(iter = cmdlist.begin(); iter != cmdlist.end(); ++iter) {
@@ -75,23 +207,45 @@ void CommandManager::load(InputStream& stream) {
 
 void CommandManager::update() {
     if(pNetworkManager != NULL) {
-        CommandList commandList;
-        for(Uint32 i = std::max((int) currentGame->getGameCycleCount() - MILLI2CYCLES(2500), 0); i < currentGame->getGameCycleCount() + networkCycleBuffer; i++) {
-            std::vector<Command> commands;
+        Uint32 endCycle = currentGame->getGameCycleCount() + networkCycleBuffer;
+
+        // the commands of all cycles not acknowledged by every peer have to be kept for resending
+        firstUnacknowledgedCycle = endCycle;
+
+        std::list<std::string> peerList = pNetworkManager->getConnectedPeers();
+        std::list<std::string>::const_iterator peerIter;
+        for(peerIter = peerList.begin(); peerIter != peerList.end(); ++peerIter) {
+            HumanPlayer* pPlayer = dynamic_cast<HumanPlayer*>(currentGame->getPlayerByName(*peerIter));
+            if(pPlayer == NULL) {
+                continue;
+            }
+
+            firstUnacknowledgedCycle = std::min(firstUnacknowledgedCycle, pPlayer->acknowledgedCommandsCycle);
+
+            // only send the cycles the peer has not acknowledged yet; empty cycles are not sent at all
+            CommandList commandList;
+            commandList.firstCycle = std::min(pPlayer->acknowledgedCommandsCycle, endCycle);
+            commandList.endCycle = endCycle;
+            commandList.acknowledgedCycle = pPlayer->nextExpectedCommandsCycle;
+
+            for(Uint32 i = std::max(commandList.firstCycle, firstCycle); (i < endCycle) && (i < this->endCycle); i++) {
+                const std::vector<Command>& cmdlist = *getTimeslot(i);
+                std::vector<Command> commands;
 
-            if(i < timeslot.size()) {
                 std::vector<Command>::const_iterator iter;
-                for(iter = timeslot[i].begin(); iter != timeslot[i].end(); ++iter) {
+                for(iter = cmdlist.begin(); iter != cmdlist.end(); ++iter) {
                     if(iter->getPlayerID() == pLocalPlayer->getPlayerID()) {
                         commands.push_back(*iter);
                     }
                 }
+
+                if(commands.empty() == false) {
+                    commandList.commandList.push_back(CommandList::CommandListEntry(i, commands));
+                }
             }
 
-            commandList.commandList.push_back(CommandList::CommandListEntry(i, commands));
+            pNetworkManager->sendCommandList(*peerIter, commandList);
         }
-
-        pNetworkManager->sendCommandList(commandList);
     }
 }
 
@@ -101,6 +255,13 @@ void CommandManager::addCommandList(const std::string& playername, const Command
         return;
     }
 
+    pPlayer->acknowledgedCommandsCycle = std::max(pPlayer->acknowledgedCommandsCycle, commandList.acknowledgedCycle);
+
+    if(commandList.firstCycle > pPlayer->nextExpectedCommandsCycle) {
+        // some cycles before this list are missing; they will be sent again as we have not acknowledged them
+        return;
+    }
+
     std::vector<CommandList::CommandListEntry>::const_iterator iter;
     for(iter = commandList.commandList.begin(); iter != commandList.commandList.end(); ++iter) {
         if(pPlayer->nextExpectedCommandsCycle > iter->cycle) {
@@ -116,19 +277,16 @@ void CommandManager::addCommandList(const std::string& playername, const Command
             addCommand(*iter2, iter->cycle);
         }
 
-        pPlayer->nextExpectedCommandsCycle = std::max(pPlayer->nextExpectedCommandsCycle, iter->cycle+1);
     }
+
+    // the cycles without an entry are empty
+    pPlayer->nextExpectedCommandsCycle = std::max(pPlayer->nextExpectedCommandsCycle, commandList.endCycle);
 }
 
 void CommandManager::addCommand(Command cmd, Uint32 CycleNumber) {
 	if(bReadOnly == false) {
 
-		if(CycleNumber >= timeslot.size()) {
-			timeslot.resize(CycleNumber+1);
-		}
-
-		timeslot[CycleNumber].push_back(cmd);
-		std::stable_sort(timeslot[CycleNumber].begin(), timeslot[CycleNumber].end(), compareCommands);
+		insertCommand(cmd, CycleNumber);
 
 		if(pStream != NULL) {
 			pStream->writeUint32(CycleNumber);
@@ -137,15 +295,18 @@ void CommandManager::addCommand(Command cmd, Uint32 CycleNumber) {
 	}
 }
 
-void CommandManager::executeCommands(Uint32 CycleNumber) const {
-	if(CycleNumber >= timeslot.size()) {
+void CommandManager::executeCommands(Uint32 CycleNumber) {
+	readReplayCommands(CycleNumber);
+
+	const std::vector<Command>* pCmdlist = getTimeslot(CycleNumber);
+	if(pCmdlist == NULL) {
+		dropExecutedTimeslots(CycleNumber);
 		return;
 	}
 
-	const std::vector<Command>& cmdlist = timeslot[CycleNumber];
 	std::vector<Command>::const_iterator iter;
 
-	for(iter = cmdlist.begin(); iter != cmdlist.end(); ++iter) {
+	for(iter = pCmdlist->begin(); iter != pCmdlist->end(); ++iter) {
 
 	    /*
         fprintf(stderr, "Executing Command (GameCycle %d): PlayerID=%d, Cmd=%d, Params=", CycleNumber, iter->getPlayerID(), iter->getCommandID());
@@ -159,5 +320,112 @@ void CommandManager::executeCommands(Uint32 CycleNumber) const {
 
 		iter->executeCommand();
 	}
+
+	dropExecutedTimeslots(CycleNumber);
+}
+
+void CommandManager::dropExecutedTimeslots(Uint32 CycleNumber) {
+	Uint32 firstNeededCycle = CycleNumber + 1;
+	if(pNetworkManager != NULL) {
+        // we might have to send our commands again
+        firstNeededCycle = std::min(firstNeededCycle, firstUnacknowledgedCycle);
+	}
+
+	dropTimeslots(firstNeededCycle);
+}
+
+void CommandManager::insertCommand(const Command& cmd, Uint32 CycleNumber) {
+	if(CycleNumber < firstKeptCycle) {
+        fprintf(stderr, "CommandManager::insertCommand(): Cannot add a command for cycle %d as all cycles before %d are already executed!\n", CycleNumber, firstKeptCycle);
+        return;
+	}
+
+	if(firstCycle == endCycle) {
+        // no commands stored => the ring buffer can start at any cycle
+        firstCycle = endCycle = CycleNumber;
+	}
+
+	resizeTimeslots(std::min(firstCycle, CycleNumber), std::max(endCycle, CycleNumber + 1));
+
+	std::vector<Command>& cmdlist = timeslot[CycleNumber & (timeslot.size() - 1)];
+	cmdlist.push_back(cmd);
+	std::stable_sort(cmdlist.begin(), cmdlist.end(), compareCommands);
+}
+
+void CommandManager::resizeTimeslots(Uint32 newFirstCycle, Uint32 newEndCycle) {
+	size_t newSize = timeslot.size();
+	while(newSize < newEndCycle - newFirstCycle) {
+        newSize *= 2;
+	}
+
+	if(newSize != timeslot.size()) {
+        // the cycles are mapped to other indices now; the slots outside of the window are always empty
+        std::vector< std::vector<Command> > newTimeslot(newSize);
+        for(Uint32 i = firstCycle; i < endCycle; i++) {
+            newTimeslot[i & (newSize - 1)].swap(timeslot[i & (timeslot.size() - 1)]);
+        }
+        timeslot.swap(newTimeslot);
+	}
+
+	firstCycle = newFirstCycle;
+	endCycle = newEndCycle;
+}
+
+void CommandManager::dropTimeslots(Uint32 CycleNumber) {
+	if(CycleNumber <= firstKeptCycle) {
+        return;
+	}
+
+	firstKeptCycle = CycleNumber;
+
+	// clear the slots for reusing them
+	for(Uint32 i = firstCycle; (i < CycleNumber) && (i < endCycle); i++) {
+        timeslot[i & (timeslot.size() - 1)].clear();
+	}
+
+	firstCycle = std::max(firstCycle, CycleNumber);
+	endCycle = std::max(endCycle, firstCycle);
+}
+
+void CommandManager::readReplayCommands(Uint32 CycleNumber) {
+	while(true) {
+        if(pNextReplayCommand == NULL) {
+            if(pReplayStream == NULL) {
+                return;
+            }
+
+            try {
+                Uint32 cycle = pReplayStream->readUint32();
+
+                if(cycle == REPLAYKEYFRAME) {
+                    // keyframes are only needed for starting the replay at a later game cycle
+                    pReplayStream->readUint32();
+                    pReplayStream->readString();
+                    continue;
+                } else if(cycle == REPLAYKEYFRAMEINDEX) {
+                    // the index is behind the last command
+                    delete pReplayStream;
+                    pReplayStream = NULL;
+                    return;
+                }
+
+                pNextReplayCommand = new Command(*pReplayStream);
+                nextReplayCommandCycle = cycle;
+            } catch (InputStream::exception&) {
+                // end of replay
+                delete pReplayStream;
+                pReplayStream = NULL;
+                return;
+            }
+        }
+
+        if(nextReplayCommandCycle > CycleNumber + REPLAYREADAHEAD) {
+            return;
+        }
+
+        insertCommand(*pNextReplayCommand, nextReplayCommandCycle);
+        delete pNextReplayCommand;
+        pNextReplayCommand = NULL;
+	}
 }
 
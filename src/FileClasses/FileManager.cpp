@@ -40,6 +40,7 @@ FileManager::FileManager(bool saveMode) {
 
     std::vector<std::string> searchPath = getSearchPath();
     std::vector<std::string> FileList = getNeededFiles();
+    std::string pakChecksums;
 
     std::vector<std::string>::const_iterator filenameIter;
     for(filenameIter = FileList.begin(); filenameIter != FileList.end(); ++filenameIter) {
@@ -49,8 +50,10 @@ FileManager::FileManager(bool saveMode) {
             std::string filepath = *searchPathIter + "/" + *filenameIter;
             if(getCaseInsensitiveFilename(filepath) == true) {
                 try {
-                    fprintf(stderr,"%s  %s\n", md5FromFilename(filepath).c_str(), filepath.c_str());
+                    std::string md5 = md5FromFilename(filepath);
+                    fprintf(stderr,"%s  %s\n", md5.c_str(), filepath.c_str());
                     pakFiles.push_back(new Pakfile(filepath));
+                    pakChecksums += md5;
                 } catch (std::exception &e) {
                     if(saveMode == false) {
                         while(pakFiles.empty()) {
@@ -70,6 +73,9 @@ FileManager::FileManager(bool saveMode) {
     }
 
     fprintf(stderr,"\n");
+
+    calculateDataChecksum(pakChecksums);
+    buildFileIndex();
 }
 
 FileManager::~FileManager() {
@@ -152,56 +158,97 @@ std::vector<std::string> FileManager::getMissingFiles() {
 SDL_RWops* FileManager::openFile(std::string filename) {
 	SDL_RWops* ret;
 
-    // try loading external file
-    std::vector<std::string> searchPath = getSearchPath();
-    std::vector<std::string>::const_iterator searchPathIter;
-    for(searchPathIter = searchPath.begin(); searchPathIter != searchPath.end(); ++searchPathIter) {
-
-        std::string externalFilename = *searchPathIter + "/" + filename;
-        if(getCaseInsensitiveFilename(externalFilename) == true) {
-            if((ret = SDL_RWFromFile(externalFilename.c_str(), "rb")) != NULL) {
+    std::unordered_map<std::string, FileLocation>::const_iterator iter = fileIndex.find(strToLower(filename));
+    if(iter != fileIndex.end()) {
+        // try loading external file
+        if(!iter->second.externalFilepath.empty()) {
+            if((ret = SDL_RWFromFile(iter->second.externalFilepath.c_str(), "rb")) != NULL) {
                 return ret;
             }
         }
-    }
 
-    // now try loading from pak file
-    std::vector<Pakfile*>::const_iterator iter;
-    for(iter = pakFiles.begin(); iter != pakFiles.end(); ++iter) {
-        ret = (*iter)->openFile(filename);
-		if(ret != NULL) {
-			return ret;
-		}
+        // now try loading from pak file
+        if(iter->second.pPakfile != NULL) {
+            if((ret = iter->second.pPakfile->openFile(iter->second.pakIndex)) != NULL) {
+                return ret;
+            }
+        }
     }
 
     throw std::runtime_error("FileManager::OpenFile(): Cannot find " + filename + "!");
 }
 
 bool FileManager::exists(std::string filename) const {
+    return (fileIndex.find(strToLower(filename)) != fileIndex.end());
+}
+
+void FileManager::buildFileIndex() {
+    fileIndex.clear();
 
-    // try finding external file
+    // the first directory in the search path containing a file wins
     std::vector<std::string> searchPath = getSearchPath();
     std::vector<std::string>::const_iterator searchPathIter;
     for(searchPathIter = searchPath.begin(); searchPathIter != searchPath.end(); ++searchPathIter) {
+        std::list<FileInfo> files = getFileList(*searchPathIter, "");
 
-        std::string externalFilename = *searchPathIter + "/" + filename;
-        if(getCaseInsensitiveFilename(externalFilename) == true) {
-            return true;
+        std::list<FileInfo>::const_iterator iter;
+        for(iter = files.begin(); iter != files.end(); ++iter) {
+            FileLocation& location = fileIndex[strToLower(iter->name)];
+            if(location.externalFilepath.empty()) {
+                location.externalFilepath = *searchPathIter + "/" + iter->name;
+            }
         }
     }
 
-    // now try finding in one pak file
+    // the first PAK-File containing a file wins
     std::vector<Pakfile*>::const_iterator iter;
     for(iter = pakFiles.begin(); iter != pakFiles.end(); ++iter) {
-        if((*iter)->exists(filename) == true) {
-            return true;
+        for(int i = 0; i < (*iter)->getNumFiles(); i++) {
+            FileLocation& location = fileIndex[strToLower((*iter)->getFilename(i))];
+            if(location.pPakfile == NULL) {
+                location.pPakfile = *iter;
+                location.pakIndex = i;
+            }
         }
     }
-
-    return false;
 }
 
 
+void FileManager::calculateDataChecksum(const std::string& pakChecksums) {
+    md5_context ctx;
+    md5_starts(&ctx);
+    md5_update(&ctx, (const unsigned char*) pakChecksums.c_str(), pakChecksums.length());
+
+    // the data files in the search path are preferred over the ones in the PAK-Files
+    const char* dataFileExtensions[] = { "pak", "shp", "icn", "map", "wsa", "cps", "pal", "bmp" };
+
+    std::vector<std::string> searchPath = getSearchPath();
+    std::vector<std::string>::const_iterator searchPathIter;
+    for(searchPathIter = searchPath.begin(); searchPathIter != searchPath.end(); ++searchPathIter) {
+        for(unsigned int i = 0; i < sizeof(dataFileExtensions)/sizeof(dataFileExtensions[0]); i++) {
+            std::list<FileInfo> files = getFileList(*searchPathIter, dataFileExtensions[i], true, FileListOrder_Name_Asc);
+
+            std::list<FileInfo>::const_iterator iter;
+            for(iter = files.begin(); iter != files.end(); ++iter) {
+                std::stringstream fileInfo;
+                fileInfo << *searchPathIter << "/" << iter->name << ":" << iter->size << ":" << iter->modifydate << ";";
+                std::string fileInfoString = fileInfo.str();
+                md5_update(&ctx, (const unsigned char*) fileInfoString.c_str(), fileInfoString.length());
+            }
+        }
+    }
+
+    unsigned char md5sum[16];
+    md5_finish(&ctx, md5sum);
+
+    std::stringstream stream;
+    stream << std::setfill('0') << std::hex;
+    for(int i=0;i<16;i++) {
+        stream << std::setw(2) << (int) md5sum[i];
+    }
+    dataChecksum = stream.str();
+}
+
 std::string FileManager::md5FromFilename(std::string filename) {
 	unsigned char md5sum[16];
 
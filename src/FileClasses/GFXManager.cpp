@@ -27,14 +27,68 @@
 #include <FileClasses/Icnfile.h>
 #include <FileClasses/Wsafile.h>
 #include <FileClasses/Palfile.h>
+#include <FileClasses/SpriteCache.h>
 
 #include <misc/draw_util.h>
 #include <misc/Scaler.h>
+#include <misc/fnkdat.h>
+#include <misc/string_util.h>
+
+#include <config.h>
 
 #include <stdexcept>
+#include <algorithm>
+#include <string.h>
 
 using std::shared_ptr;
 
+/// Increment this whenever the cached object pictures change without a change of the game version (e.g. decodeObjPic() or the ObjPic ids)
+#define OBJPICCACHEVERSION  1
+
+namespace {
+
+/// Locks a mutex for the lifetime of this object (so that it is also unlocked if a picture cannot be loaded)
+class MutexLock {
+public:
+    MutexLock(SDL_mutex* pMutex) : pMutex(pMutex) {
+        SDL_LockMutex(pMutex);
+    }
+
+    ~MutexLock() {
+        SDL_UnlockMutex(pMutex);
+    }
+
+private:
+    SDL_mutex* pMutex;
+};
+
+/// the ui graphics needed by the menus; they are prepared first by the prewarm thread
+const unsigned int menuUIGraphics[] = {
+    UI_MenuBackground, UI_MenuButtonBorder, UI_DuneLegacy, UI_CursorNormal, UI_Background, UI_MessageBox,
+    UI_OptionsMenu, UI_LoadSaveWindow, UI_NewMapWindow, UI_PlanetBackground, UI_HouseSelect,
+    UI_Herald_ArrowLeft, UI_Herald_ArrowLeftHighlight, UI_Herald_ArrowRight, UI_Herald_ArrowRightHighlight,
+    UI_Minus, UI_Minus_Pressed, UI_Plus, UI_Plus_Pressed, UI_CustomGamePlayersArrow, UI_CustomGamePlayersArrowNeutral,
+    UI_MentatBackground, UI_MentatYes, UI_MentatYes_Pressed, UI_MentatNo, UI_MentatNo_Pressed,
+    UI_MentatExit, UI_MentatExit_Pressed, UI_MentatProcced, UI_MentatProcced_Pressed, UI_MentatRepeat, UI_MentatRepeat_Pressed,
+    UI_MapChoiceScreen, UI_MapChoicePlanet, UI_MapChoiceMapOnly, UI_MapChoiceMap, UI_MapChoiceClickMap
+};
+
+/// the ui graphics needed in a game; they are prepared by the prewarm thread after the object pictures
+const unsigned int gameUIGraphics[] = {
+    UI_SideBar, UI_TopBar, UI_GameMenu, UI_RadarAnimation, UI_CursorUp, UI_CursorRight, UI_CursorDown, UI_CursorLeft,
+    UI_CursorMove_Zoomlevel0, UI_CursorCapture_Zoomlevel0, UI_ReturnIcon, UI_DeployIcon, UI_DestructIcon,
+    UI_CreditsDigits, UI_Indicator,
+    UI_InvalidPlace_Zoomlevel0, UI_InvalidPlace_Zoomlevel1, UI_InvalidPlace_Zoomlevel2,
+    UI_ValidPlace_Zoomlevel0, UI_ValidPlace_Zoomlevel1, UI_ValidPlace_Zoomlevel2,
+    UI_GreyPlace_Zoomlevel0, UI_GreyPlace_Zoomlevel1, UI_GreyPlace_Zoomlevel2,
+    UI_SelectionBox_Zoomlevel0, UI_OtherPlayerSelectionBox_Zoomlevel0,
+    UI_ButtonUp, UI_ButtonUp_Pressed, UI_ButtonDown, UI_ButtonDown_Pressed, UI_BuilderListUpperCap, UI_BuilderListLowerCap,
+    UI_Mentat, UI_Upgrade, UI_Upgrade_Pressed, UI_Repair, UI_Repair_Pressed, UI_StructureSizeLattice, UI_StructureSizeConcrete,
+    UI_GameStatsBackground
+};
+
+}
+
 GFXManager::GFXManager() {
 	// init whole ObjPic array
 	for(int i = 0; i < NUM_OBJPICS; i++) {
@@ -43,11 +97,13 @@ GFXManager::GFXManager() {
                 objPic[i][j][z] = NULL;
 		    }
 		}
+		objPicState[i] = AssetState_NotLoaded;
 	}
 
 	// init whole SmallDetailPics array
 	for(int i = 0; i < NUM_SMALLDETAILPICS; i++) {
 		smallDetailPic[i] = NULL;
+		smallDetailPicState[i] = AssetState_NotLoaded;
 	}
 
 	// init whole UIGraphic array
@@ -55,6 +111,7 @@ GFXManager::GFXManager() {
 		for(int j = 0; j < (int) NUM_HOUSES; j++) {
 			uiGraphic[i][j] = NULL;
 		}
+		uiGraphicState[i] = AssetState_NotLoaded;
 	}
 
 	// init whole MapChoicePieces array
@@ -68,889 +125,60 @@ GFXManager::GFXManager() {
 	for(int i = 0; i < NUM_MAPCHOICEARROWS; i++) {
 		mapChoiceArrows[i] = NULL;
 	}
+	bMapChoiceGraphicsLoaded = false;
 
 	// init whole Anim array
 	for(int i = 0; i < NUM_ANIMATION; i++) {
 		animation[i] = NULL;
 	}
 
-	// open all shp files
-	shared_ptr<Shpfile> units = loadShpfile("UNITS.SHP");
-	shared_ptr<Shpfile> units1 = loadShpfile("UNITS1.SHP");
-	shared_ptr<Shpfile> units2 = loadShpfile("UNITS2.SHP");
-	shared_ptr<Shpfile> mouse = loadShpfile("MOUSE.SHP");
-	shared_ptr<Shpfile> shapes = loadShpfile("SHAPES.SHP");
-	shared_ptr<Shpfile> menshpa = loadShpfile("MENSHPA.SHP");
-	shared_ptr<Shpfile> menshph = loadShpfile("MENSHPH.SHP");
-	shared_ptr<Shpfile> menshpo = loadShpfile("MENSHPO.SHP");
-	shared_ptr<Shpfile> menshpm = loadShpfile("MENSHPM.SHP");
-
-	shared_ptr<Shpfile> choam;
-    if(pFileManager->exists("CHOAM." + _("LanguageFileExtension"))) {
-        choam = loadShpfile("CHOAM." + _("LanguageFileExtension"));
-    } else if(pFileManager->exists("CHOAMSHP.SHP")) {
-        choam = loadShpfile("CHOAMSHP.SHP");
-    } else {
-        throw std::runtime_error("GFXManager::GFXManager(): Cannot open CHOAMSHP.SHP or CHOAM."+_("LanguageFileExtension")+"!");
-    }
-
-	shared_ptr<Shpfile> bttn;
-    if(pFileManager->exists("BTTN." + _("LanguageFileExtension"))) {
-        bttn = loadShpfile("BTTN." + _("LanguageFileExtension"));
-    } else {
-        // The US-Version has the buttons in SHAPES.SHP
-        // => bttn == NULL
-    }
-
-	shared_ptr<Shpfile> mentat;
-    if(pFileManager->exists("MENTAT." + _("LanguageFileExtension"))) {
-        mentat = loadShpfile("MENTAT." + _("LanguageFileExtension"));
-    } else {
-        mentat = loadShpfile("MENTAT.SHP");
-    }
-
-	shared_ptr<Shpfile> pieces = loadShpfile("PIECES.SHP");
-	shared_ptr<Shpfile> arrows = loadShpfile("ARROWS.SHP");
-
-    // Load icon file
-    shared_ptr<Icnfile> icon = shared_ptr<Icnfile>(new Icnfile(pFileManager->openFile("ICON.ICN"),pFileManager->openFile("ICON.MAP"), true));
-
-    // Load radar static
-    shared_ptr<Wsafile> radar = loadWsafile("STATIC.WSA");
-
 	// open bene palette
-	Palette benePalette = LoadPalette_RW(pFileManager->openFile("BENE.PAL"), true);
-
-	//create PictureFactory
-	shared_ptr<PictureFactory> PicFactory = shared_ptr<PictureFactory>(new PictureFactory());
-
-
-
-	// load Object pics
-	objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0] = units2->getPictureArray(8,1,GROUNDUNIT_ROW(0));
-	objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0], 8, 1, false);
-	objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][0] = units2->getPictureArray(8,1,GROUNDUNIT_ROW(5));
-	objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-	objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][0] = units2->getPictureArray(8,1,GROUNDUNIT_ROW(10));
-	objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][0], 8, 1, false);
-	objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][0] = units2->getPictureArray(8,1,GROUNDUNIT_ROW(15));
-	objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-	objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][0] = units2->getPictureArray(8,1,GROUNDUNIT_ROW(20));
-	objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][0], 8, 1, false);
-	objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][0] = units2->getPictureArray(8,1,GROUNDUNIT_ROW(25));
-	objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][0] = units2->getPictureArray(8,1,GROUNDUNIT_ROW(30));
-    objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][0] = units2->getPictureArray(8,1,GROUNDUNIT_ROW(35));
-    objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Quad][HOUSE_HARKONNEN][0] = units->getPictureArray(8,1,GROUNDUNIT_ROW(0));
-    objPic[ObjPic_Quad][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Quad][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_Quad][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Quad][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Trike][HOUSE_HARKONNEN][0] = units->getPictureArray(8,1,GROUNDUNIT_ROW(5));
-    objPic[ObjPic_Trike][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Trike][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_Trike][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Trike][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Harvester][HOUSE_HARKONNEN][0] = units->getPictureArray(8,1,GROUNDUNIT_ROW(10));
-    objPic[ObjPic_Harvester][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Harvester][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_Harvester][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Harvester][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][0] = units1->getPictureArray(8,3,HARVESTERSAND_ROW(72),HARVESTERSAND_ROW(73),HARVESTERSAND_ROW(74));
-    objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][0], 8, 3, false);
-    objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][0], 8, 3, false);
-
-	objPic[ObjPic_MCV][HOUSE_HARKONNEN][0] = units->getPictureArray(8,1,GROUNDUNIT_ROW(15));
-    objPic[ObjPic_MCV][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_MCV][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_MCV][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_MCV][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Carryall][HOUSE_HARKONNEN][0] = units->getPictureArray(8,2,AIRUNIT_ROW(45),AIRUNIT_ROW(48));
-    objPic[ObjPic_Carryall][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Carryall][HOUSE_HARKONNEN][0], 8, 2, false);
-    objPic[ObjPic_Carryall][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Carryall][HOUSE_HARKONNEN][0], 8, 2, false);
-
-	objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][0] = createShadowSurface(objPic[ObjPic_Carryall][HOUSE_HARKONNEN][0]);
-    objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][0], 8, 2, false);
-    objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][0], 8, 2, false);
-
-	objPic[ObjPic_Frigate][HOUSE_HARKONNEN][0] = units->getPictureArray(8,1,AIRUNIT_ROW(60));
-    objPic[ObjPic_Frigate][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Frigate][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_Frigate][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Frigate][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][0] = createShadowSurface(objPic[ObjPic_Frigate][HOUSE_HARKONNEN][0]);
-    objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][0] = units->getPictureArray(8,3,ORNITHOPTER_ROW(51),ORNITHOPTER_ROW(52),ORNITHOPTER_ROW(53));
-    objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][0], 8, 3, false);
-    objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][0], 8, 3, false);
-
-	objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][0] = createShadowSurface(objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][0]);
-    objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][0], 8, 3, false);
-    objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][0], 8, 3, false);
-
-	objPic[ObjPic_Trooper][HOUSE_HARKONNEN][0] = units->getPictureArray(4,3,INFANTRY_ROW(82),INFANTRY_ROW(83),INFANTRY_ROW(84));
-    objPic[ObjPic_Trooper][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Trooper][HOUSE_HARKONNEN][0], 4, 3, false);
-    objPic[ObjPic_Trooper][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Trooper][HOUSE_HARKONNEN][0], 4, 3, false);
-
-	objPic[ObjPic_Troopers][HOUSE_HARKONNEN][0] = units->getPictureArray(4,4,MULTIINFANTRY_ROW(103),MULTIINFANTRY_ROW(104),MULTIINFANTRY_ROW(105),MULTIINFANTRY_ROW(106));
-    objPic[ObjPic_Troopers][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Troopers][HOUSE_HARKONNEN][0], 4, 3, false);
-    objPic[ObjPic_Troopers][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Troopers][HOUSE_HARKONNEN][0], 4, 3, false);
-
-	objPic[ObjPic_Soldier][HOUSE_HARKONNEN][0] = units->getPictureArray(4,3,INFANTRY_ROW(73),INFANTRY_ROW(74),INFANTRY_ROW(75));
-    objPic[ObjPic_Soldier][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Soldier][HOUSE_HARKONNEN][0], 4, 3, false);
-    objPic[ObjPic_Soldier][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Soldier][HOUSE_HARKONNEN][0], 4, 3, false);
-
-	objPic[ObjPic_Infantry][HOUSE_HARKONNEN][0] = units->getPictureArray(4,4,MULTIINFANTRY_ROW(91),MULTIINFANTRY_ROW(92),MULTIINFANTRY_ROW(93),MULTIINFANTRY_ROW(94));
-    objPic[ObjPic_Infantry][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Infantry][HOUSE_HARKONNEN][0], 4, 3, false);
-    objPic[ObjPic_Infantry][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Infantry][HOUSE_HARKONNEN][0], 4, 3, false);
-
-	objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][0] = units->getPictureArray(4,3,INFANTRY_ROW(63),INFANTRY_ROW(64),INFANTRY_ROW(65));
-    objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][0], 4, 3, false);
-    objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][0], 4, 3, false);
-
-	objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][0] = units1->getPictureArray(1,9,71|TILE_NORMAL,70|TILE_NORMAL,69|TILE_NORMAL,68|TILE_NORMAL,67|TILE_NORMAL,68|TILE_NORMAL,69|TILE_NORMAL,70|TILE_NORMAL,71|TILE_NORMAL);
-    objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][0], 1, 9, false);
-    objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][0], 1, 9, false);
-
-	objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][0] = icon->getPictureArray(17);
-    objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][0], 4, 1, false);
-    objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][0], 4, 1, false);
-
-	objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][0] = icon->getPictureArray(19);
-    objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][0], 4, 1, false);
-    objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][0], 4, 1, false);
-
-	objPic[ObjPic_Refinery][HOUSE_HARKONNEN][0] = icon->getPictureArray(21);
-    objPic[ObjPic_Refinery][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Refinery][HOUSE_HARKONNEN][0], 10, 1, false);
-    objPic[ObjPic_Refinery][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Refinery][HOUSE_HARKONNEN][0], 10, 1, false);
-
-	objPic[ObjPic_Barracks][HOUSE_HARKONNEN][0] = icon->getPictureArray(18);
-    objPic[ObjPic_Barracks][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Barracks][HOUSE_HARKONNEN][0], 4, 1, false);
-    objPic[ObjPic_Barracks][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Barracks][HOUSE_HARKONNEN][0], 4, 1, false);
-
-	objPic[ObjPic_WOR][HOUSE_HARKONNEN][0] = icon->getPictureArray(16);
-    objPic[ObjPic_WOR][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_WOR][HOUSE_HARKONNEN][0], 4, 1, false);
-    objPic[ObjPic_WOR][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_WOR][HOUSE_HARKONNEN][0], 4, 1, false);
-
-	objPic[ObjPic_Radar][HOUSE_HARKONNEN][0] = icon->getPictureArray(26);
-    objPic[ObjPic_Radar][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Radar][HOUSE_HARKONNEN][0], 4, 1, false);
-    objPic[ObjPic_Radar][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Radar][HOUSE_HARKONNEN][0], 4, 1, false);
-
-	objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][0] = icon->getPictureArray(12);
-    objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][0], 6, 1, false);
-    objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][0], 6, 1, false);
-
-	objPic[ObjPic_Silo][HOUSE_HARKONNEN][0] = icon->getPictureArray(25);
-    objPic[ObjPic_Silo][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Silo][HOUSE_HARKONNEN][0], 4, 1, false);
-    objPic[ObjPic_Silo][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Silo][HOUSE_HARKONNEN][0], 4, 1, false);
-
-	objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][0] = icon->getPictureArray(13);
-    objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][0] = icon->getPictureArray(14);
-    objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][0], 8, 1, false);
-
-	objPic[ObjPic_IX][HOUSE_HARKONNEN][0] = icon->getPictureArray(15);
-    objPic[ObjPic_IX][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_IX][HOUSE_HARKONNEN][0], 4, 1, false);
-    objPic[ObjPic_IX][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_IX][HOUSE_HARKONNEN][0], 4, 1, false);
-
-	objPic[ObjPic_Palace][HOUSE_HARKONNEN][0] = icon->getPictureArray(11);
-    objPic[ObjPic_Palace][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Palace][HOUSE_HARKONNEN][0], 4, 1, false);
-    objPic[ObjPic_Palace][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Palace][HOUSE_HARKONNEN][0], 4, 1, false);
-
-	objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][0] = icon->getPictureArray(22);
-    objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][0], 10, 1, false);
-    objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][0], 10, 1, false);
-
-	objPic[ObjPic_Starport][HOUSE_HARKONNEN][0] = icon->getPictureArray(20);
-    objPic[ObjPic_Starport][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Starport][HOUSE_HARKONNEN][0], 10, 1, false);
-    objPic[ObjPic_Starport][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Starport][HOUSE_HARKONNEN][0], 10, 1, false);
-
-	objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][0] = icon->getPictureArray(23);
-    objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][0], 10, 1, false);
-    objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][0], 10, 1, false);
-
-	objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][0] = icon->getPictureArray(24);
-    objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][0], 10, 1, false);
-    objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][0], 10, 1, false);
-
-	objPic[ObjPic_Wall][HOUSE_HARKONNEN][0] = icon->getPictureArray(6,1,1,75);
-    objPic[ObjPic_Wall][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Wall][HOUSE_HARKONNEN][0], 75, 1, false);
-    objPic[ObjPic_Wall][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Wall][HOUSE_HARKONNEN][0], 75, 1, false);
-
-	objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][0] = units->getPictureArray(16,1,ROCKET_ROW(35));
-    objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][0], 16, 1, false);
-    objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][0], 16, 1, false);
-
-	objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][0] = units->getPictureArray(16,1,ROCKET_ROW(20));
-    objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][0], 16, 1, false);
-    objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][0], 16, 1, false);
-
-	objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][0] = units->getPictureArray(16,1,ROCKET_ROW(40));
-    objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][0], 16, 1, false);
-    objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][0], 16, 1, false);
-
-	objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][0] = units1->getPicture(23);
-    objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][0], 1, 1, false);
-    objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][0], 1, 1, false);
-
-	objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][0] = units1->getPicture(24);
-    objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][0], 1, 1, false);
-    objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][0], 1, 1, false);
-
-	objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][0] = units1->getPicture(25);
-    objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][0], 1, 1, false);
-    objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][0], 1, 1, false);
-
-	objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][0] = units1->getPicture(10);
-    objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][0], 1, 1, false);
-    objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][0], 1, 1, false);
-
-	objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][0] = units1->getPictureArray(5,1,57|TILE_NORMAL,58|TILE_NORMAL,59|TILE_NORMAL,60|TILE_NORMAL,61|TILE_NORMAL);
-    objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][0], 5, 1, false);
-    objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][0], 5, 1, false);
-
-	objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][0] = mapSurfaceColorRange(objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][0], COLOR_ORDOS, COLOR_HARKONNEN);
-    objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][0], 5, 1, false);
-    objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][0], 5, 1, false);
-
-	objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][0] = units1->getPicture(2);
-    objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][0], 1, 1, false);
-    objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][0], 1, 1, false);
-
-	objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][0] = units1->getPicture(3);
-    objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][0], 1, 1, false);
-    objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][0], 1, 1, false);
-
-	objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][0] = units1->getPicture(4);
-    objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][0], 1, 1, false);
-    objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][0], 1, 1, false);
-
-	objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][0] = units1->getPictureArray(5,1,32|TILE_NORMAL,33|TILE_NORMAL,34|TILE_NORMAL,35|TILE_NORMAL,36|TILE_NORMAL);
-    objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][0], 5, 1, false);
-    objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][0], 5, 1, false);
-
-	objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][0] = units1->getPictureArray(5,1,47|TILE_NORMAL,48|TILE_NORMAL,49|TILE_NORMAL,50|TILE_NORMAL,51|TILE_NORMAL);
-    objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][0], 5, 1, false);
-    objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][0], 5, 1, false);
-
-	objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][0] = units1->getPictureArray(5,1,52|TILE_NORMAL,53|TILE_NORMAL,54|TILE_NORMAL,55|TILE_NORMAL,56|TILE_NORMAL);
-    objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][0], 5, 1, false);
-    objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][0], 5, 1, false);
-
-	objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][0] = units1->getPictureArray(5,1,37|TILE_NORMAL,38|TILE_NORMAL,39|TILE_NORMAL,40|TILE_NORMAL,41|TILE_NORMAL);
-    objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][0], 5, 1, false);
-    objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][0], 5, 1, false);
+	benePalette = LoadPalette_RW(pFileManager->openFile("BENE.PAL"), true);
 
-	objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][0] = units1->getPictureArray(5,1,42|TILE_NORMAL,43|TILE_NORMAL,44|TILE_NORMAL,45|TILE_NORMAL,46|TILE_NORMAL);
-    objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][0], 5, 1, false);
-    objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][0], 5, 1, false);
+	languageFileExtension = _("LanguageFileExtension");
 
-	objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][0] = units1->getPictureArray(2,1,0|TILE_NORMAL,1|TILE_NORMAL);
-    objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][0], 2, 1, false);
-    objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][0], 2, 1, false);
+	// the cached object pictures depend on the game data, the scaler used for the bigger zoom levels and on how they are decoded and numbered
+	char tmp[FILENAME_MAX];
+	fnkdat(SPRITECACHEFILENAME, tmp, FILENAME_MAX, FNKDAT_USER | FNKDAT_CREAT);
+	std::string spriteCacheKey = pFileManager->getDataChecksum() + ":" + settings.video.scaler
+                                    + ":" + VERSION + ":" + stringify(OBJPICCACHEVERSION) + ":" + stringify((int) NUM_OBJPICS) + ":" + stringify(NUM_ZOOMLEVEL);
+	pSpriteCache = new SpriteCache(tmp, spriteCacheKey);
 
-	objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][0] = units1->getPictureArray(21,1,	11|TILE_NORMAL,12|TILE_NORMAL,13|TILE_NORMAL,17|TILE_NORMAL,18|TILE_NORMAL,19|TILE_NORMAL,17|TILE_NORMAL,
-																					18|TILE_NORMAL,19|TILE_NORMAL,17|TILE_NORMAL,18|TILE_NORMAL,19|TILE_NORMAL,17|TILE_NORMAL,18|TILE_NORMAL,
-																					19|TILE_NORMAL,17|TILE_NORMAL,18|TILE_NORMAL,19|TILE_NORMAL,20|TILE_NORMAL,21|TILE_NORMAL,22|TILE_NORMAL);
-    objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][0], 21, 1, false);
-    objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][0], 21, 1, false);
-
-    objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][0] = units1->getPictureArray(3,1,7|TILE_NORMAL,6|TILE_NORMAL,5|TILE_NORMAL);
-    objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][0], 3, 1, false);
-    objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][0], 3, 1, false);
-
-	objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][0] = icon->getPictureArray(4,1,1,6);
-    objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][0], 6, 1, false);
-    objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][0], 6, 1, false);
-
-	objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][0] = icon->getPictureArray(3,1,1,6);
-    objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][0], 6, 1, false);
-    objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][0], 6, 1, false);
-
-	objPic[ObjPic_Smoke][HOUSE_HARKONNEN][0] = units1->getPictureArray(3,1,29|TILE_NORMAL,30|TILE_NORMAL,31|TILE_NORMAL);
-    objPic[ObjPic_Smoke][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Smoke][HOUSE_HARKONNEN][0], 3, 1, false);
-    objPic[ObjPic_Smoke][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Smoke][HOUSE_HARKONNEN][0], 3, 1, false);
-
-	objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][0] = units1->getPicture(10);
-    objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][0], 1, 1, false);
-    objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][0], 1, 1, false);
-
-	objPic[ObjPic_Terrain][HOUSE_HARKONNEN][0] = icon->getPictureRow(124,209);
-    objPic[ObjPic_Terrain][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Terrain][HOUSE_HARKONNEN][0], 86, 1, false);
-    objPic[ObjPic_Terrain][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Terrain][HOUSE_HARKONNEN][0], 86, 1, false);
-
-	objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][0] = icon->getPictureRow2(14, 33, 125, 213, 214, 215, 223, 224, 225, 232, 233, 234, 240, 246, 247);
-    objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][0], 14, 1, false);
-    objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][0], 14, 1, false);
-
-	objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][0] = icon->getPictureRow(1,6);
-    objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][0], 6, 1, false);
-    objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][0], 6, 1, false);
-
-	objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][0] = icon->getPictureRow(7,12);
-    objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][0], 3, 1, false);
-    objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][0], 3, 1, false);
-
-	objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][0] = icon->getPictureRow(108,123);
-    objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][0], 16, 1, false);
-    objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][0], 16, 1, false);
-
-	objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][0] = icon->getPictureRow(108,123);
-    objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][0], 16, 1, false);
-    objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][0], 16, 1, false);
-
-	objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][0] = icon->getPictureRow(25,32);
-    objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][0], 8, 1, false);
-    objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][0], 8, 1, false);
-
-    objPic[ObjPic_Star][HOUSE_HARKONNEN][0] = SDL_LoadBMP_RW(pFileManager->openFile("Star5x5.bmp"),true);
-    objPic[ObjPic_Star][HOUSE_HARKONNEN][1] = SDL_LoadBMP_RW(pFileManager->openFile("Star7x7.bmp"),true);
-    objPic[ObjPic_Star][HOUSE_HARKONNEN][2] = SDL_LoadBMP_RW(pFileManager->openFile("Star11x11.bmp"),true);
-
-    for(int i = 0; i < NUM_OBJPICS; i++) {
-		for(int j = 0; j < (int) NUM_HOUSES; j++) {
-		    for(int z=0; z < NUM_ZOOMLEVEL; z++) {
-                if(objPic[i][j][z] != NULL) {
-                    SDL_SetColorKey(objPic[i][j][z], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-                    SDL_Surface* tmp;
-                    tmp = objPic[i][j][z];
-                    if((objPic[i][j][z] = SDL_DisplayFormat(tmp)) == NULL) {
-                        fprintf(stderr,"GFXManager: SDL_DisplayFormat() failed!\n");
-                        exit(EXIT_FAILURE);
-                    }
-                    SDL_FreeSurface(tmp);
-                }
-		    }
-		}
-	}
-
-
-
-	// load small detail pics
-	smallDetailPic[Picture_Barracks] = extractSmallDetailPic("BARRAC.WSA");
-	smallDetailPic[Picture_ConstructionYard] = extractSmallDetailPic("CONSTRUC.WSA");
-	smallDetailPic[Picture_Carryall] = extractSmallDetailPic("CARRYALL.WSA");
-	smallDetailPic[Picture_Devastator] = extractSmallDetailPic("HARKTANK.WSA");
-	smallDetailPic[Picture_Deviator] = extractSmallDetailPic("ORDRTANK.WSA");
-	smallDetailPic[Picture_DeathHand] = extractSmallDetailPic("GOLD-BB.WSA");
-	smallDetailPic[Picture_Fremen] = extractSmallDetailPic("FREMEN.WSA");
-	if(pFileManager->exists("FRIGATE.WSA")) {
-        smallDetailPic[Picture_Frigate] = extractSmallDetailPic("FRIGATE.WSA");
-	} else {
-	    // US-Version 1.07 does not contain FRIGATE.WSA
-        // We replace it with the starport
-        smallDetailPic[Picture_Frigate] = extractSmallDetailPic("STARPORT.WSA");
-	}
-	smallDetailPic[Picture_GunTurret] = extractSmallDetailPic("TURRET.WSA");
-	smallDetailPic[Picture_Harvester] = extractSmallDetailPic("HARVEST.WSA");
-	smallDetailPic[Picture_HeavyFactory] = extractSmallDetailPic("HVYFTRY.WSA");
-	smallDetailPic[Picture_HighTechFactory] = extractSmallDetailPic("HITCFTRY.WSA");
-	smallDetailPic[Picture_Soldier] = extractSmallDetailPic("INFANTRY.WSA");
-	smallDetailPic[Picture_IX] = extractSmallDetailPic("IX.WSA");
-	smallDetailPic[Picture_Launcher] = extractSmallDetailPic("RTANK.WSA");
-	smallDetailPic[Picture_LightFactory] = extractSmallDetailPic("LITEFTRY.WSA");
-	smallDetailPic[Picture_MCV] = extractSmallDetailPic("MCV.WSA");
-	smallDetailPic[Picture_Ornithopter] = extractSmallDetailPic("ORNI.WSA");
-	smallDetailPic[Picture_Palace] = extractSmallDetailPic("PALACE.WSA");
-	smallDetailPic[Picture_Quad] = extractSmallDetailPic("QUAD.WSA");
-	smallDetailPic[Picture_Radar] = extractSmallDetailPic("HEADQRTS.WSA");
-	smallDetailPic[Picture_RaiderTrike] = extractSmallDetailPic("OTRIKE.WSA");
-	smallDetailPic[Picture_Refinery] = extractSmallDetailPic("REFINERY.WSA");
-	smallDetailPic[Picture_RepairYard] = extractSmallDetailPic("REPAIR.WSA");
-	smallDetailPic[Picture_RocketTurret] = extractSmallDetailPic("RTURRET.WSA");
-	smallDetailPic[Picture_Saboteur] = extractSmallDetailPic("SABOTURE.WSA");
-	smallDetailPic[Picture_Sandworm] = extractSmallDetailPic("WORM.WSA");
-	smallDetailPic[Picture_Sardaukar] = extractSmallDetailPic("SARDUKAR.WSA");
-	smallDetailPic[Picture_SiegeTank] = extractSmallDetailPic("HTANK.WSA");
-	smallDetailPic[Picture_Silo] = extractSmallDetailPic("STORAGE.WSA");
-	smallDetailPic[Picture_Slab1] = extractSmallDetailPic("SLAB.WSA");
-	smallDetailPic[Picture_Slab4] = extractSmallDetailPic("4SLAB.WSA");
-	smallDetailPic[Picture_SonicTank] = extractSmallDetailPic("STANK.WSA");
-    smallDetailPic[Picture_Special]	= NULL;
-	smallDetailPic[Picture_StarPort] = extractSmallDetailPic("STARPORT.WSA");
-	smallDetailPic[Picture_Tank] = extractSmallDetailPic("LTANK.WSA");
-	smallDetailPic[Picture_Trike] = extractSmallDetailPic("TRIKE.WSA");
-	smallDetailPic[Picture_Trooper] = extractSmallDetailPic("HYINFY.WSA");
-	smallDetailPic[Picture_Wall] = extractSmallDetailPic("WALL.WSA");
-	smallDetailPic[Picture_WindTrap] = extractSmallDetailPic("WINDTRAP.WSA");
-	smallDetailPic[Picture_WOR] = extractSmallDetailPic("WOR.WSA");
-	// unused: FARTR.WSA, FHARK.WSA, FORDOS.WSA
-
-	for(int i = 0; i < NUM_SMALLDETAILPICS; i++) {
-		if(smallDetailPic[i] != NULL) {
-			SDL_Surface* tmp;
-			tmp = smallDetailPic[i];
-			if((smallDetailPic[i] = SDL_DisplayFormat(tmp)) == NULL) {
-				fprintf(stderr,"GFXManager: SDL_DisplayFormat() failed!\n");
-				exit(EXIT_FAILURE);
-			}
-			SDL_FreeSurface(tmp);
-		}
-	}
+	// Create alpha blending surfaces (128x128 pixel)
+	pTransparent40Surface = SDL_CreateRGBSurface(SDL_HWSURFACE,128,128,32,0,0,0,0);
+    SDL_SetAlpha(pTransparent40Surface, SDL_SRCALPHA, 40);
 
+	pTransparent150Surface = SDL_CreateRGBSurface(SDL_HWSURFACE,128,128,32,0,0,0,0);
+    SDL_SetAlpha(pTransparent150Surface, SDL_SRCALPHA, 150);
 
-	// load UI graphics
-	uiGraphic[UI_RadarAnimation][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(radar->getAnimationAsPictureRow());
-
-	uiGraphic[UI_CursorNormal][HOUSE_HARKONNEN] = mouse->getPicture(0);
-	SDL_SetColorKey(uiGraphic[UI_CursorNormal][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorUp][HOUSE_HARKONNEN] = mouse->getPicture(1);
-	SDL_SetColorKey(uiGraphic[UI_CursorUp][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorRight][HOUSE_HARKONNEN] = mouse->getPicture(2);
-	SDL_SetColorKey(uiGraphic[UI_CursorRight][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorDown][HOUSE_HARKONNEN] = mouse->getPicture(3);
-	SDL_SetColorKey(uiGraphic[UI_CursorDown][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorLeft][HOUSE_HARKONNEN] = mouse->getPicture(4);
-	SDL_SetColorKey(uiGraphic[UI_CursorLeft][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-    uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN] = mouse->getPicture(5);
-	SDL_SetColorKey(uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorMove_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_CursorMove_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorMove_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_CursorMove_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-	uiGraphic[UI_CursorAttack_Zoomlevel0][HOUSE_HARKONNEN] = mapSurfaceColorRange(uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN], 232, COLOR_HARKONNEN);
-	SDL_SetColorKey(uiGraphic[UI_CursorAttack_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorAttack_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_CursorAttack_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_CursorAttack_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorAttack_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_CursorAttack_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_CursorAttack_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-	uiGraphic[UI_CursorCapture_Zoomlevel0][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Capture.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_CursorCapture_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorCapture_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_CursorCapture_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_CursorCapture_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_CursorCapture_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_CursorCapture_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_CursorCapture_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-	uiGraphic[UI_ReturnIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Return.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_ReturnIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-	uiGraphic[UI_DeployIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Deploy.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_DeployIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-	uiGraphic[UI_DestructIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Destruct.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_DestructIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-	uiGraphic[UI_CreditsDigits][HOUSE_HARKONNEN] = shapes->getPictureArray(10,1,2|TILE_NORMAL,3|TILE_NORMAL,4|TILE_NORMAL,5|TILE_NORMAL,6|TILE_NORMAL,
-																				7|TILE_NORMAL,8|TILE_NORMAL,9|TILE_NORMAL,10|TILE_NORMAL,11|TILE_NORMAL);
-	uiGraphic[UI_SideBar][HOUSE_HARKONNEN] = PicFactory->createSideBar(false);
-	uiGraphic[UI_Indicator][HOUSE_HARKONNEN] = units1->getPictureArray(3,1,8|TILE_NORMAL,9|TILE_NORMAL,10|TILE_NORMAL);
-	SDL_SetColorKey(uiGraphic[UI_Indicator][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_InvalidPlace_Zoomlevel0][HOUSE_HARKONNEN] = PicFactory->createPlacingGrid(16, COLOR_LIGHTRED);
-	uiGraphic[UI_InvalidPlace_Zoomlevel1][HOUSE_HARKONNEN] = PicFactory->createPlacingGrid(32, COLOR_LIGHTRED);
-    uiGraphic[UI_InvalidPlace_Zoomlevel2][HOUSE_HARKONNEN] = PicFactory->createPlacingGrid(48, COLOR_LIGHTRED);
-	uiGraphic[UI_ValidPlace_Zoomlevel0][HOUSE_HARKONNEN] = PicFactory->createPlacingGrid(16, COLOR_LIGHTGREEN);
-	uiGraphic[UI_ValidPlace_Zoomlevel1][HOUSE_HARKONNEN] = PicFactory->createPlacingGrid(32, COLOR_LIGHTGREEN);
-    uiGraphic[UI_ValidPlace_Zoomlevel2][HOUSE_HARKONNEN] = PicFactory->createPlacingGrid(48, COLOR_LIGHTGREEN);
-	uiGraphic[UI_GreyPlace_Zoomlevel0][HOUSE_HARKONNEN] = PicFactory->createPlacingGrid(16, COLOR_LIGHTGREY);
-	uiGraphic[UI_GreyPlace_Zoomlevel1][HOUSE_HARKONNEN] = PicFactory->createPlacingGrid(32, COLOR_LIGHTGREY);
-    uiGraphic[UI_GreyPlace_Zoomlevel2][HOUSE_HARKONNEN] = PicFactory->createPlacingGrid(48, COLOR_LIGHTGREY);
-	uiGraphic[UI_MenuBackground][HOUSE_HARKONNEN] = PicFactory->createMainBackground();
-	uiGraphic[UI_Background][HOUSE_HARKONNEN] = PicFactory->createBackground();
-	uiGraphic[UI_GameStatsBackground][HOUSE_HARKONNEN] = PicFactory->createGameStatsBackground(HOUSE_HARKONNEN);
-    uiGraphic[UI_GameStatsBackground][HOUSE_ATREIDES] = PicFactory->createGameStatsBackground(HOUSE_ATREIDES);
-    uiGraphic[UI_GameStatsBackground][HOUSE_ORDOS] = PicFactory->createGameStatsBackground(HOUSE_ORDOS);
-    uiGraphic[UI_GameStatsBackground][HOUSE_FREMEN] = PicFactory->createGameStatsBackground(HOUSE_FREMEN);
-    uiGraphic[UI_GameStatsBackground][HOUSE_SARDAUKAR] = PicFactory->createGameStatsBackground(HOUSE_SARDAUKAR);
-    uiGraphic[UI_GameStatsBackground][HOUSE_MERCENARY] = PicFactory->createGameStatsBackground(HOUSE_MERCENARY);
-	uiGraphic[UI_SelectionBox_Zoomlevel0][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("UI_SelectionBox.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_SelectionBox_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_SelectionBox_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_SelectionBox_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_SelectionBox_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_SelectionBox_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_SelectionBox_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_SelectionBox_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel0][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("UI_OtherPlayerSelectionBox.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
-	SDL_SetColorKey(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_TopBar][HOUSE_HARKONNEN] = PicFactory->createTopBar();
-	uiGraphic[UI_ButtonUp][HOUSE_HARKONNEN] = choam->getPicture(0);
-	uiGraphic[UI_ButtonUp_Pressed][HOUSE_HARKONNEN] = choam->getPicture(1);
-	uiGraphic[UI_ButtonDown][HOUSE_HARKONNEN] = choam->getPicture(2);
-	uiGraphic[UI_ButtonDown_Pressed][HOUSE_HARKONNEN] = choam->getPicture(3);
-	uiGraphic[UI_BuilderListUpperCap][HOUSE_HARKONNEN] = PicFactory->createBuilderListUpperCap();
-	uiGraphic[UI_BuilderListLowerCap][HOUSE_HARKONNEN] = PicFactory->createBuilderListLowerCap();
-	uiGraphic[UI_CustomGamePlayersArrow][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("CustomGamePlayers_Arrow.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_CustomGamePlayersArrow][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_CustomGamePlayersArrowNeutral][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("CustomGamePlayers_ArrowNeutral.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_CustomGamePlayersArrowNeutral][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_MessageBox][HOUSE_HARKONNEN] = PicFactory->createMessageBoxBorder();
-
-	if(bttn.get() != NULL) {
-        uiGraphic[UI_Mentat][HOUSE_HARKONNEN] = bttn->getPicture(0);
-        uiGraphic[UI_Mentat_Pressed][HOUSE_HARKONNEN] = bttn->getPicture(1);
-        uiGraphic[UI_Options][HOUSE_HARKONNEN] = bttn->getPicture(2);
-        uiGraphic[UI_Options_Pressed][HOUSE_HARKONNEN] = bttn->getPicture(3);
-	} else {
-        uiGraphic[UI_Mentat][HOUSE_HARKONNEN] = shapes->getPicture(94);
-        uiGraphic[UI_Mentat_Pressed][HOUSE_HARKONNEN] = shapes->getPicture(95);
-        uiGraphic[UI_Options][HOUSE_HARKONNEN] = shapes->getPicture(96);
-        uiGraphic[UI_Options_Pressed][HOUSE_HARKONNEN] = shapes->getPicture(97);
-	}
+    pTransparent40ColorMapScreen = NULL;
 
-	uiGraphic[UI_Upgrade][HOUSE_HARKONNEN] = choam->getPicture(4);
-	SDL_SetColorKey(uiGraphic[UI_Upgrade][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_Upgrade_Pressed][HOUSE_HARKONNEN] = choam->getPicture(5);
-	SDL_SetColorKey(uiGraphic[UI_Upgrade_Pressed][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_Repair][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_Repair.bmp"),true);
-	uiGraphic[UI_Repair_Pressed][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_RepairPushed.bmp"),true);
-	uiGraphic[UI_Minus][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_Minus.bmp"),true);
-	uiGraphic[UI_Minus_Pressed][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_MinusPushed.bmp"),true);
-	uiGraphic[UI_Plus][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_Plus.bmp"),true);
-	uiGraphic[UI_Plus_Pressed][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_PlusPushed.bmp"),true);
-	uiGraphic[UI_MissionSelect][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Menu_MissionSelect.bmp"),true);
-	PicFactory->drawFrame(uiGraphic[UI_MissionSelect][HOUSE_HARKONNEN],PictureFactory::SimpleFrame,NULL);
-	SDL_SetColorKey(uiGraphic[UI_MissionSelect][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_OptionsMenu][HOUSE_HARKONNEN] = PicFactory->createOptionsMenu();
-	uiGraphic[UI_LoadSaveWindow][HOUSE_HARKONNEN] = PicFactory->createMenu(280,228);
-	uiGraphic[UI_NewMapWindow][HOUSE_HARKONNEN] = PicFactory->createMenu(600,440);
-	uiGraphic[UI_DuneLegacy][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("DuneLegacy.bmp"),true);
-	uiGraphic[UI_GameMenu][HOUSE_HARKONNEN] = PicFactory->createMenu(uiGraphic[UI_DuneLegacy][HOUSE_HARKONNEN],158);
-	PicFactory->drawFrame(uiGraphic[UI_DuneLegacy][HOUSE_HARKONNEN],PictureFactory::SimpleFrame);
-
-	uiGraphic[UI_PlanetBackground][HOUSE_HARKONNEN] = LoadCPS_RW(pFileManager->openFile("BIGPLAN.CPS"),true);
-	PicFactory->drawFrame(uiGraphic[UI_PlanetBackground][HOUSE_HARKONNEN],PictureFactory::SimpleFrame);
-	uiGraphic[UI_MenuButtonBorder][HOUSE_HARKONNEN] = PicFactory->createFrame(PictureFactory::DecorationFrame1,190,123,false);
-
-	PicFactory->drawFrame(uiGraphic[UI_DuneLegacy][HOUSE_HARKONNEN],PictureFactory::SimpleFrame);
-
-	uiGraphic[UI_MentatBackground][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(LoadCPS_RW(pFileManager->openFile("MENTATH.CPS"),true),true);
-	uiGraphic[UI_MentatBackground][HOUSE_ATREIDES] = Scaler::defaultDoubleSurface(LoadCPS_RW(pFileManager->openFile("MENTATA.CPS"),true),true);
-	uiGraphic[UI_MentatBackground][HOUSE_ORDOS] = Scaler::defaultDoubleSurface(LoadCPS_RW(pFileManager->openFile("MENTATO.CPS"),true),true);
-	uiGraphic[UI_MentatBackground][HOUSE_FREMEN] = PictureFactory::mapMentatSurfaceToFremen(uiGraphic[UI_MentatBackground][HOUSE_ATREIDES]);
-	uiGraphic[UI_MentatBackground][HOUSE_SARDAUKAR] = PictureFactory::mapMentatSurfaceToSardaukar(uiGraphic[UI_MentatBackground][HOUSE_HARKONNEN]);
-	uiGraphic[UI_MentatBackground][HOUSE_MERCENARY] = PictureFactory::mapMentatSurfaceToMercenary(uiGraphic[UI_MentatBackground][HOUSE_ORDOS]);
-
-	uiGraphic[UI_MentatBackgroundBene][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(LoadCPS_RW(pFileManager->openFile("MENTATM.CPS"),true),true);
-	if(uiGraphic[UI_MentatBackgroundBene][HOUSE_HARKONNEN] != NULL) {
-	    benePalette.applyToSurface(uiGraphic[UI_MentatBackgroundBene][HOUSE_HARKONNEN]);
+	assetMutex = SDL_CreateMutex();
+	if(assetMutex == NULL) {
+		throw std::runtime_error("GFXManager::GFXManager(): Unable to create mutex");
 	}
 
-    uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_HARKONNEN] = PicFactory->createMentatHouseChoiceQuestion(HOUSE_HARKONNEN, benePalette);
-    uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_ATREIDES] = PicFactory->createMentatHouseChoiceQuestion(HOUSE_ATREIDES, benePalette);
-    uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_ORDOS] = PicFactory->createMentatHouseChoiceQuestion(HOUSE_ORDOS, benePalette);
-    uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_SARDAUKAR] = PicFactory->createMentatHouseChoiceQuestion(HOUSE_SARDAUKAR, benePalette);
-    uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_FREMEN] = PicFactory->createMentatHouseChoiceQuestion(HOUSE_FREMEN, benePalette);
-    uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_MERCENARY] = PicFactory->createMentatHouseChoiceQuestion(HOUSE_MERCENARY, benePalette);
-
-	uiGraphic[UI_MentatYes][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(0),true);
-	uiGraphic[UI_MentatYes_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(1),true);
-	uiGraphic[UI_MentatNo][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(2),true);
-	uiGraphic[UI_MentatNo_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(3),true);
-	uiGraphic[UI_MentatExit][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(4),true);
-	uiGraphic[UI_MentatExit_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(5),true);
-	uiGraphic[UI_MentatProcced][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(6),true);
-	uiGraphic[UI_MentatProcced_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(7),true);
-	uiGraphic[UI_MentatRepeat][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(8),true);
-	uiGraphic[UI_MentatRepeat_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(mentat->getPicture(9),true);
-
-    SDL_Surface* pHouseChoiceBackground;
-    if(pFileManager->exists("HERALD." + _("LanguageFileExtension"))) {
-        pHouseChoiceBackground = LoadCPS_RW(pFileManager->openFile("HERALD." + _("LanguageFileExtension")),true);
-    } else {
-        pHouseChoiceBackground = LoadCPS_RW(pFileManager->openFile("HERALD.CPS"),true);
-    }
-
-	uiGraphic[UI_HouseSelect][HOUSE_HARKONNEN] = PicFactory->createHouseSelect(pHouseChoiceBackground);
-	uiGraphic[UI_SelectYourHouseLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getSubPicture(pHouseChoiceBackground, 0, 0, 320, 50), true);
-	uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES] = getSubPicture(pHouseChoiceBackground,20,54,83,91);
-	uiGraphic[UI_Herald_ColoredLarge][HOUSE_ATREIDES] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES], false);
-	uiGraphic[UI_Herald_Colored][HOUSE_ORDOS] = getSubPicture(pHouseChoiceBackground,117,54,83,91);
-	uiGraphic[UI_Herald_ColoredLarge][HOUSE_ORDOS] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_ORDOS], false);
-	uiGraphic[UI_Herald_Colored][HOUSE_HARKONNEN] = getSubPicture(pHouseChoiceBackground,215,54,83,91);
-	uiGraphic[UI_Herald_ColoredLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_HARKONNEN], false);
-	uiGraphic[UI_Herald_Colored][HOUSE_FREMEN] = PicFactory->createHeraldFre(uiGraphic[UI_Herald_Colored][HOUSE_HARKONNEN]);
-	uiGraphic[UI_Herald_ColoredLarge][HOUSE_FREMEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_FREMEN], false);
-	uiGraphic[UI_Herald_Colored][HOUSE_SARDAUKAR] = PicFactory->createHeraldSard(uiGraphic[UI_Herald_Colored][HOUSE_ORDOS], uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES]);
-	uiGraphic[UI_Herald_ColoredLarge][HOUSE_SARDAUKAR] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_SARDAUKAR], false);
-	uiGraphic[UI_Herald_Colored][HOUSE_MERCENARY] = PicFactory->createHeraldMerc(uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES], uiGraphic[UI_Herald_Colored][HOUSE_ORDOS]);
-	uiGraphic[UI_Herald_ColoredLarge][HOUSE_MERCENARY] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_MERCENARY], false);
-
-    SDL_FreeSurface(pHouseChoiceBackground);
-
-	uiGraphic[UI_Herald_Grey][HOUSE_HARKONNEN] = PicFactory->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_HARKONNEN]);
-	uiGraphic[UI_Herald_Grey][HOUSE_ATREIDES] = PicFactory->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES]);
-	uiGraphic[UI_Herald_Grey][HOUSE_ORDOS] = PicFactory->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_ORDOS]);
-	uiGraphic[UI_Herald_Grey][HOUSE_FREMEN] = PicFactory->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_FREMEN]);
-	uiGraphic[UI_Herald_Grey][HOUSE_SARDAUKAR] = PicFactory->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_SARDAUKAR]);
-	uiGraphic[UI_Herald_Grey][HOUSE_MERCENARY] = PicFactory->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_MERCENARY]);
-
-	uiGraphic[UI_Herald_ArrowLeft][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("ArrowLeft.bmp"),true);
-	uiGraphic[UI_Herald_ArrowLeftLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_ArrowLeft][HOUSE_HARKONNEN], false);
-    uiGraphic[UI_Herald_ArrowLeftHighlight][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("ArrowLeftHighlight.bmp"),true);
-	uiGraphic[UI_Herald_ArrowLeftHighlightLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_ArrowLeftHighlight][HOUSE_HARKONNEN], false);
-	uiGraphic[UI_Herald_ArrowRight][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("ArrowRight.bmp"),true);
-	uiGraphic[UI_Herald_ArrowRightLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_ArrowRight][HOUSE_HARKONNEN], false);
-    uiGraphic[UI_Herald_ArrowRightHighlight][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("ArrowRightHighlight.bmp"),true);
-	uiGraphic[UI_Herald_ArrowRightHighlightLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_ArrowRightHighlight][HOUSE_HARKONNEN], false);
-
-	uiGraphic[UI_MapChoiceScreen][HOUSE_HARKONNEN] = PicFactory->createMapChoiceScreen(HOUSE_HARKONNEN);
-	uiGraphic[UI_MapChoiceScreen][HOUSE_ATREIDES] = PicFactory->createMapChoiceScreen(HOUSE_ATREIDES);
-	uiGraphic[UI_MapChoiceScreen][HOUSE_ORDOS] = PicFactory->createMapChoiceScreen(HOUSE_ORDOS);
-	uiGraphic[UI_MapChoiceScreen][HOUSE_FREMEN] = PicFactory->createMapChoiceScreen(HOUSE_FREMEN);
-	uiGraphic[UI_MapChoiceScreen][HOUSE_SARDAUKAR] = PicFactory->createMapChoiceScreen(HOUSE_SARDAUKAR);
-	uiGraphic[UI_MapChoiceScreen][HOUSE_MERCENARY] = PicFactory->createMapChoiceScreen(HOUSE_MERCENARY);
-	uiGraphic[UI_MapChoicePlanet][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(LoadCPS_RW(pFileManager->openFile("PLANET.CPS"),true));
-	SDL_SetColorKey(uiGraphic[UI_MapChoicePlanet][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_MapChoiceMapOnly][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(LoadCPS_RW(pFileManager->openFile("DUNEMAP.CPS"),true));
-	SDL_SetColorKey(uiGraphic[UI_MapChoiceMapOnly][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(LoadCPS_RW(pFileManager->openFile("DUNERGN.CPS"),true));
-	SDL_SetColorKey(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-	// make black lines inside the map non-transparent
-	if(!SDL_MUSTLOCK(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN]) || (SDL_LockSurface(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN]) == 0)) {
-        for(int y = 48; y < 48+240; y++) {
-            for(int x = 16; x < 16 + 608; x++) {
-                if(getPixel(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN], x, y) == 0) {
-                    putPixel(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN], x, y, 12);
-                }
-            }
+	// Hardware surfaces may only be touched by the main thread. Then everything is loaded on demand.
+	bStopPrewarming = false;
+	prewarmThread = NULL;
+	if((screen != NULL) && ((screen->flags & SDL_HWSURFACE) == 0)) {
+        prewarmThread = SDL_CreateThread(prewarmThreadMain, (void*) this);
+        if(prewarmThread == NULL) {
+            fprintf(stderr,"GFXManager::GFXManager(): Unable to create thread; graphics are loaded on demand\n");
         }
-
-        if(SDL_MUSTLOCK(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN])) {
-			SDL_UnlockSurface(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN]);
-		}
-	}
-
-	uiGraphic[UI_MapChoiceClickMap][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(LoadCPS_RW(pFileManager->openFile("RGNCLK.CPS"),true));
-
-	uiGraphic[UI_StructureSizeLattice][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("StructureSizeLattice.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_StructureSizeLattice][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_StructureSizeConcrete][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("StructureSizeConcrete.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_StructureSizeConcrete][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-    uiGraphic[UI_MapEditor_SideBar][HOUSE_HARKONNEN] = PicFactory->createSideBar(true);
-    uiGraphic[UI_MapEditor_BottomBar][HOUSE_HARKONNEN] = PicFactory->createBottomBar();
-
-    uiGraphic[UI_MapEditor_ExitIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorExitIcon.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_ExitIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_NewIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorNewIcon.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_NewIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_LoadIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorLoadIcon.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_LoadIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_SaveIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorSaveIcon.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_SaveIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_UndoIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorUndoIcon.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_UndoIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_RedoIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorRedoIcon.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_RedoIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_PlayerIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPlayerIcon.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_PlayerIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_MapSettingsIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMapSettingsIcon.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_MapSettingsIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_ChoamIcon][HOUSE_HARKONNEN] = scaleSurface(getSubFrame(objPic[ObjPic_Frigate][HOUSE_HARKONNEN][0],1,0,8,1), 0.5);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_ChoamIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_ReinforcementsIcon][HOUSE_HARKONNEN] = scaleSurface(getSubFrame(objPic[ObjPic_Carryall][HOUSE_HARKONNEN][0],1,0,8,2), 0.66667);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_ReinforcementsIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_TeamsIcon][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Troopers][HOUSE_HARKONNEN][0],0,0,4,4);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_TeamsIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_MirrorNoneIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorNone.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorNoneIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_MirrorHorizontalIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorHorizontal.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorHorizontalIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_MirrorVerticalIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorVertical.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorVerticalIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_MirrorBothIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorBoth.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorBothIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_MirrorPointIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorPoint.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorPointIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_ArrowUp][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorArrowUp.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_ArrowUp][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_ArrowDown][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorArrowDown.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_ArrowDown][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_Plus][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPlus.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_Plus][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_Minus][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMinus.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_Minus][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_RotateLeftIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorRotateLeft.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_RotateLeftIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_RotateLeftHighlightIcon][HOUSE_HARKONNEN] = mapSurfaceColorRange(uiGraphic[UI_MapEditor_RotateLeftIcon][HOUSE_HARKONNEN], COLOR_HARKONNEN, COLOR_HARKONNEN-3);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_RotateLeftHighlightIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_RotateRightIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorRotateRight.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_RotateRightIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	uiGraphic[UI_MapEditor_RotateRightHighlightIcon][HOUSE_HARKONNEN] = mapSurfaceColorRange(uiGraphic[UI_MapEditor_RotateRightIcon][HOUSE_HARKONNEN], COLOR_HARKONNEN, COLOR_HARKONNEN-3);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_RotateRightHighlightIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-	uiGraphic[UI_MapEditor_Sand][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(icon->getPicture(127),true);
-	uiGraphic[UI_MapEditor_Dunes][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(icon->getPicture(159),true);
-	uiGraphic[UI_MapEditor_SpecialBloom][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(icon->getPicture(209),true);
-	uiGraphic[UI_MapEditor_Spice][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(icon->getPicture(191),true);
-	uiGraphic[UI_MapEditor_ThickSpice][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(icon->getPicture(207),true);
-	uiGraphic[UI_MapEditor_SpiceBloom][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(icon->getPicture(208),true);
-	uiGraphic[UI_MapEditor_Slab][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(icon->getPicture(126),true);
-	uiGraphic[UI_MapEditor_Rock][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(icon->getPicture(143),true);
-	uiGraphic[UI_MapEditor_Mountain][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(icon->getPicture(175),true);
-
-    uiGraphic[UI_MapEditor_Slab1][HOUSE_HARKONNEN] = icon->getPicture(126);
-	uiGraphic[UI_MapEditor_Wall][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_Wall][HOUSE_HARKONNEN][0],2*D2_TILESIZE,0,D2_TILESIZE,D2_TILESIZE);
-	uiGraphic[UI_MapEditor_GunTurret][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][0],2*D2_TILESIZE,0,D2_TILESIZE,D2_TILESIZE);
-	uiGraphic[UI_MapEditor_RocketTurret][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][0],2*D2_TILESIZE,0,D2_TILESIZE,D2_TILESIZE);
-	uiGraphic[UI_MapEditor_ConstructionYard][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_Windtrap][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_Radar][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_Radar][HOUSE_HARKONNEN][0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_Silo][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_Silo][HOUSE_HARKONNEN][0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_IX][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_IX][HOUSE_HARKONNEN][0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_Barracks][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_Barracks][HOUSE_HARKONNEN][0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_WOR][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_WOR][HOUSE_HARKONNEN][0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_LightFactory][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_Refinery][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_Refinery][HOUSE_HARKONNEN][0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_HighTechFactory][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_HeavyFactory][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_RepairYard][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,2*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_Starport][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_Starport][HOUSE_HARKONNEN][0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,3*D2_TILESIZE);
-	uiGraphic[UI_MapEditor_Palace][HOUSE_HARKONNEN] = getSubPicture(objPic[ObjPic_Palace][HOUSE_HARKONNEN][0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,3*D2_TILESIZE);
-
-    uiGraphic[UI_MapEditor_Soldier][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Soldier][HOUSE_HARKONNEN][0],0,0,4,3);
-    uiGraphic[UI_MapEditor_Trooper][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Trooper][HOUSE_HARKONNEN][0],0,0,4,3);
-    uiGraphic[UI_MapEditor_Harvester][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Harvester][HOUSE_HARKONNEN][0],0,0,8,1);
-    uiGraphic[UI_MapEditor_Infantry][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Infantry][HOUSE_HARKONNEN][0],0,0,4,4);
-    uiGraphic[UI_MapEditor_Troopers][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Troopers][HOUSE_HARKONNEN][0],0,0,4,4);
-    uiGraphic[UI_MapEditor_MCV][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_MCV][HOUSE_HARKONNEN][0],0,0,8,1);
-    uiGraphic[UI_MapEditor_Trike][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Trike][HOUSE_HARKONNEN][0],0,0,8,1);
-    uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Trike][HOUSE_HARKONNEN][0],0,0,8,1);
-    uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN] = combinePictures(uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN], objPic[ObjPic_Star][HOUSE_HARKONNEN][1],
-                                                                      uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN]->w - objPic[ObjPic_Star][HOUSE_HARKONNEN][1]->w,
-                                                                      uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN]->h - objPic[ObjPic_Star][HOUSE_HARKONNEN][1]->h,
-                                                                      true, false);
-    uiGraphic[UI_MapEditor_Quad][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Quad][HOUSE_HARKONNEN][0],0,0,8,1);
-    uiGraphic[UI_MapEditor_Tank][HOUSE_HARKONNEN] = combinePictures(getSubFrame(objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0],0,0,8,1), getSubFrame(objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][0],0,0,8,1), 0, 0);
-    uiGraphic[UI_MapEditor_SiegeTank][HOUSE_HARKONNEN] = combinePictures(getSubFrame(objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][0],0,0,8,1), getSubFrame(objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][0],0,0,8,1), 2, -4);
-    uiGraphic[UI_MapEditor_Launcher][HOUSE_HARKONNEN] = combinePictures(getSubFrame(objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0],0,0,8,1), getSubFrame(objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][0],0,0,8,1), 3, 0);
-    uiGraphic[UI_MapEditor_Devastator][HOUSE_HARKONNEN] = combinePictures(getSubFrame(objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][0],0,0,8,1), getSubFrame(objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][0],0,0,8,1), 2, -4);
-    uiGraphic[UI_MapEditor_SonicTank][HOUSE_HARKONNEN] = combinePictures(getSubFrame(objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0],0,0,8,1), getSubFrame(objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][0],0,0,8,1), 3, 1);
-    uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN] = combinePictures(getSubFrame(objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0],0,0,8,1), getSubFrame(objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][0],0,0,8,1), 3, 0);
-    uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN] = combinePictures(uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN], objPic[ObjPic_Star][HOUSE_HARKONNEN][1],
-                                                                  uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN]->w - objPic[ObjPic_Star][HOUSE_HARKONNEN][1]->w,
-                                                                  uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN]->h - objPic[ObjPic_Star][HOUSE_HARKONNEN][1]->h,
-                                                                  true, false);
-    uiGraphic[UI_MapEditor_Saboteur][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][0],0,0,4,3);
-    uiGraphic[UI_MapEditor_Sandworm][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][0],0,5,1,9);
-    uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN] = combinePictures(getSubFrame(objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][0],0,0,8,1), getSubFrame(objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][0],0,0,8,1), 2, -4);
-    uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN] = combinePictures(uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN], objPic[ObjPic_Star][HOUSE_HARKONNEN][1],
-                                                                  uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN]->w - objPic[ObjPic_Star][HOUSE_HARKONNEN][1]->w,
-                                                                  uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN]->h - objPic[ObjPic_Star][HOUSE_HARKONNEN][1]->h,
-                                                                  true, false);
-    uiGraphic[UI_MapEditor_Carryall][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Carryall][HOUSE_HARKONNEN][0],0,0,8,2);
-    uiGraphic[UI_MapEditor_Ornithopter][HOUSE_HARKONNEN] = getSubFrame(objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][0],0,0,8,3);
-
-    uiGraphic[UI_MapEditor_Pen1x1][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPen1x1.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_Pen1x1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_Pen3x3][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPen3x3.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_Pen3x3][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-    uiGraphic[UI_MapEditor_Pen5x5][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPen5x5.bmp"),true);
-	SDL_SetColorKey(uiGraphic[UI_MapEditor_Pen5x5][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-
-	for(int i = 0; i < NUM_UIGRAPHICS; i++) {
-		for(int j = 0; j < (int) NUM_HOUSES; j++) {
-			if(uiGraphic[i][j] != NULL) {
-				SDL_Surface* tmp;
-				tmp = uiGraphic[i][j];
-				if((uiGraphic[i][j] = SDL_DisplayFormat(tmp)) == NULL) {
-					fprintf(stderr,"GFXManager: SDL_DisplayFormat() failed!\n");
-					exit(EXIT_FAILURE);
-				}
-				SDL_FreeSurface(tmp);
-			}
-		}
-	}
-
-
-	// load animations
-	animation[Anim_HarkonnenEyes] = menshph->getAnimation(0,4,true,true);
-	animation[Anim_HarkonnenEyes]->setFrameRate(0.3);
-	animation[Anim_HarkonnenMouth] = menshph->getAnimation(5,9,true,true,true);
-	animation[Anim_HarkonnenMouth]->setFrameRate(5.0);
-	animation[Anim_HarkonnenShoulder] = menshph->getAnimation(10,10,true,true);
-	animation[Anim_HarkonnenShoulder]->setFrameRate(1.0);
-	animation[Anim_AtreidesEyes] = menshpa->getAnimation(0,4,true,true);
-	animation[Anim_AtreidesEyes]->setFrameRate(0.5);
-	animation[Anim_AtreidesMouth] = menshpa->getAnimation(5,9,true,true,true);
-	animation[Anim_AtreidesMouth]->setFrameRate(5.0);
-	animation[Anim_AtreidesShoulder] = menshpa->getAnimation(10,10,true,true);
-	animation[Anim_AtreidesShoulder]->setFrameRate(1.0);
-	animation[Anim_AtreidesBook] = menshpa->getAnimation(11,12,true,true,true);
-	animation[Anim_AtreidesBook]->setNumLoops(1);
-	animation[Anim_AtreidesBook]->setFrameRate(0.2);
-	animation[Anim_OrdosEyes] = menshpo->getAnimation(0,4,true,true);
-	animation[Anim_OrdosEyes]->setFrameRate(0.5);
-	animation[Anim_OrdosMouth] = menshpo->getAnimation(5,9,true,true,true);
-	animation[Anim_OrdosMouth]->setFrameRate(5.0);
-	animation[Anim_OrdosShoulder] = menshpo->getAnimation(10,10,true,true);
-	animation[Anim_OrdosShoulder]->setFrameRate(1.0);
-	animation[Anim_OrdosRing] = menshpo->getAnimation(11,14,true,true,true);
-	animation[Anim_OrdosRing]->setNumLoops(1);
-	animation[Anim_OrdosRing]->setFrameRate(6.0);
-	animation[Anim_FremenEyes] = PictureFactory::mapMentatAnimationToFremen(animation[Anim_AtreidesEyes]);
-	animation[Anim_FremenMouth] = PictureFactory::mapMentatAnimationToFremen(animation[Anim_AtreidesMouth]);
-	animation[Anim_FremenShoulder] = PictureFactory::mapMentatAnimationToFremen(animation[Anim_AtreidesShoulder]);
-	animation[Anim_FremenBook] = PictureFactory::mapMentatAnimationToFremen(animation[Anim_AtreidesBook]);
-	animation[Anim_SardaukarEyes] = PictureFactory::mapMentatAnimationToSardaukar(animation[Anim_HarkonnenEyes]);
-	animation[Anim_SardaukarMouth] = PictureFactory::mapMentatAnimationToSardaukar(animation[Anim_HarkonnenMouth]);
-	animation[Anim_SardaukarShoulder] = PictureFactory::mapMentatAnimationToSardaukar(animation[Anim_HarkonnenShoulder]);
-	animation[Anim_MercenaryEyes] = PictureFactory::mapMentatAnimationToMercenary(animation[Anim_OrdosEyes]);
-	animation[Anim_MercenaryMouth] = PictureFactory::mapMentatAnimationToMercenary(animation[Anim_OrdosMouth]);
-	animation[Anim_MercenaryShoulder] = PictureFactory::mapMentatAnimationToMercenary(animation[Anim_OrdosShoulder]);
-	animation[Anim_MercenaryRing] = PictureFactory::mapMentatAnimationToMercenary(animation[Anim_OrdosRing]);
-
-	animation[Anim_BeneEyes] = menshpm->getAnimation(0,4,true,true);
-	if(animation[Anim_BeneEyes] != NULL) {
-	    animation[Anim_BeneEyes]->setPalette(benePalette);
-        animation[Anim_BeneEyes]->setFrameRate(0.5);
-	}
-	animation[Anim_BeneMouth] = menshpm->getAnimation(5,9,true,true,true);
-	if(animation[Anim_BeneMouth] != NULL) {
-	    animation[Anim_BeneMouth]->setPalette(benePalette);
-        animation[Anim_BeneMouth]->setFrameRate(5.0);
-	}
-	// the remaining animation are loaded on demand to save some loading time
-
-	// load map choice pieces
-	for(int i = 0; i < NUM_MAPCHOICEPIECES; i++) {
-		mapChoicePieces[i][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(pieces->getPicture(i));
-		SDL_SetColorKey(mapChoicePieces[i][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
 	}
-
-
-
-	// load map choice arrows
-	for(int i = 0; i < NUM_MAPCHOICEARROWS; i++) {
-		mapChoiceArrows[i] = Scaler::defaultDoubleSurface(arrows->getPicture(i),true);
-		SDL_SetColorKey(mapChoiceArrows[i], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
-	}
-
-
-
-	// Create alpha blending surfaces (128x128 pixel)
-	pTransparent40Surface = SDL_CreateRGBSurface(SDL_HWSURFACE,128,128,32,0,0,0,0);
-    SDL_SetAlpha(pTransparent40Surface, SDL_SRCALPHA, 40);
-
-	pTransparent150Surface = SDL_CreateRGBSurface(SDL_HWSURFACE,128,128,32,0,0,0,0);
-    SDL_SetAlpha(pTransparent150Surface, SDL_SRCALPHA, 150);
 }
 
 GFXManager::~GFXManager() {
+    if(prewarmThread != NULL) {
+        SDL_LockMutex(assetMutex);
+        bStopPrewarming = true;
+        SDL_UnlockMutex(assetMutex);
+
+        SDL_WaitThread(prewarmThread, NULL);
+        prewarmThread = NULL;
+    }
+
 	for(int i = 0; i < NUM_OBJPICS; i++) {
 		for(int j = 0; j < (int) NUM_HOUSES; j++) {
             for(int z = 0; z < NUM_ZOOMLEVEL; z++) {
@@ -1003,6 +231,24 @@ GFXManager::~GFXManager() {
 
 	SDL_FreeSurface(pTransparent40Surface);
 	SDL_FreeSurface(pTransparent150Surface);
+
+	delete pSpriteCache;
+
+	SDL_DestroyMutex(assetMutex);
+}
+
+const Uint8* GFXManager::getTransparent40ColorMap() {
+    SDL_Palette* pPalette = screen->format->palette;
+    size_t paletteSize = std::min(pPalette->ncolors, 256)*sizeof(SDL_Color);
+
+    // the palette may also change without changing the screen surface (e.g. by SDL_SetColors())
+    if((pTransparent40ColorMapScreen != screen) || (memcmp(transparent40ColorMapPalette, pPalette->colors, paletteSize) != 0)) {
+        createBlendColorMap(screen, pTransparent40Surface, transparent40ColorMap);
+        pTransparent40ColorMapScreen = screen;
+        memcpy(transparent40ColorMapPalette, pPalette->colors, paletteSize);
+    }
+
+    return transparent40ColorMap;
 }
 
 SDL_Surface** GFXManager::getObjPic(unsigned int id, int house) {
@@ -1011,6 +257,15 @@ SDL_Surface** GFXManager::getObjPic(unsigned int id, int house) {
 		exit(EXIT_FAILURE);
 	}
 
+    // only the main thread makes a picture ready, so no locking is needed once it is ready
+    if(objPicState[id] != AssetState_Ready) {
+        MutexLock lock(assetMutex);
+        if(objPicState[id] == AssetState_NotLoaded) {
+            buildObjPic(id);
+        }
+        publishObjPic(id);
+    }
+
     for(int z = 0; z < NUM_ZOOMLEVEL; z++) {
         if(objPic[id][house][z] == NULL) {
             // remap to this color
@@ -1031,6 +286,15 @@ SDL_Surface* GFXManager::getSmallDetailPic(unsigned int id) {
 	if(id >= NUM_SMALLDETAILPICS) {
 		return NULL;
 	}
+
+    if(smallDetailPicState[id] != AssetState_Ready) {
+        MutexLock lock(assetMutex);
+        if(smallDetailPicState[id] == AssetState_NotLoaded) {
+            buildSmallDetailPic(id);
+        }
+        publishSmallDetailPic(id);
+    }
+
 	return smallDetailPic[id];
 }
 
@@ -1041,6 +305,14 @@ SDL_Surface* GFXManager::getUIGraphic(unsigned int id, int house) {
 		exit(EXIT_FAILURE);
 	}
 
+    if(uiGraphicState[id] != AssetState_Ready) {
+        MutexLock lock(assetMutex);
+        if(uiGraphicState[id] == AssetState_NotLoaded) {
+            buildUIGraphic(id);
+        }
+        publishUIGraphic(id);
+    }
+
 	if(uiGraphic[id][house] == NULL) {
 		// remap to this color
 		if(uiGraphic[id][HOUSE_HARKONNEN] == NULL) {
@@ -1060,6 +332,8 @@ SDL_Surface* GFXManager::getMapChoicePiece(unsigned int num, int house) {
 		exit(EXIT_FAILURE);
 	}
 
+	loadMapChoiceGraphics();
+
 	if(mapChoicePieces[num][house] == NULL) {
 		// remap to this color
 		if(mapChoicePieces[num][HOUSE_HARKONNEN] == NULL) {
@@ -1079,9 +353,1587 @@ SDL_Surface* GFXManager::getMapChoiceArrow(unsigned int num) {
 		exit(EXIT_FAILURE);
 	}
 
+	loadMapChoiceGraphics();
+
 	return mapChoiceArrows[num];
 }
 
+void GFXManager::buildObjPic(unsigned int id) {
+    bool bCached = true;
+    for(int z = 0; z < NUM_ZOOMLEVEL; z++) {
+        bCached = bCached && pSpriteCache->contains(id*NUM_ZOOMLEVEL + z);
+    }
+
+    if(bCached) {
+        for(int z = 0; z < NUM_ZOOMLEVEL; z++) {
+            objPic[id][HOUSE_HARKONNEN][z] = pSpriteCache->getSurface(id*NUM_ZOOMLEVEL + z);
+        }
+    } else {
+        decodeObjPic(id);
+
+        for(int z = 0; z < NUM_ZOOMLEVEL; z++) {
+            pSpriteCache->addSurface(id*NUM_ZOOMLEVEL + z, objPic[id][HOUSE_HARKONNEN][z]);
+        }
+    }
+
+    objPicState[id] = AssetState_Built;
+}
+
+void GFXManager::decodeObjPic(unsigned int id) {
+    switch(id) {
+        case ObjPic_Tank_Base: {
+            objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0] = getShpfile("UNITS2.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(0));
+            objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Tank_Base][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Tank_Gun: {
+            objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][0] = getShpfile("UNITS2.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(5));
+            objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Tank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Siegetank_Base: {
+            objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][0] = getShpfile("UNITS2.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(10));
+            objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Siegetank_Base][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Siegetank_Gun: {
+            objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][0] = getShpfile("UNITS2.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(15));
+            objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Siegetank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Devastator_Base: {
+            objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][0] = getShpfile("UNITS2.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(20));
+            objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Devastator_Base][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Devastator_Gun: {
+            objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][0] = getShpfile("UNITS2.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(25));
+            objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Devastator_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Sonictank_Gun: {
+            objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][0] = getShpfile("UNITS2.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(30));
+            objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Sonictank_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Launcher_Gun: {
+            objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][0] = getShpfile("UNITS2.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(35));
+            objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Launcher_Gun][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Quad: {
+            objPic[ObjPic_Quad][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(0));
+            objPic[ObjPic_Quad][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Quad][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Quad][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Quad][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Trike: {
+            objPic[ObjPic_Trike][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(5));
+            objPic[ObjPic_Trike][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Trike][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Trike][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Trike][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Harvester: {
+            objPic[ObjPic_Harvester][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(10));
+            objPic[ObjPic_Harvester][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Harvester][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Harvester][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Harvester][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Harvester_Sand: {
+            objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(8,3,HARVESTERSAND_ROW(72),HARVESTERSAND_ROW(73),HARVESTERSAND_ROW(74));
+            objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][0], 8, 3, false);
+            objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Harvester_Sand][HOUSE_HARKONNEN][0], 8, 3, false);
+        } break;
+
+        case ObjPic_MCV: {
+            objPic[ObjPic_MCV][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(8,1,GROUNDUNIT_ROW(15));
+            objPic[ObjPic_MCV][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_MCV][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_MCV][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_MCV][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Carryall: {
+            objPic[ObjPic_Carryall][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(8,2,AIRUNIT_ROW(45),AIRUNIT_ROW(48));
+            objPic[ObjPic_Carryall][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Carryall][HOUSE_HARKONNEN][0], 8, 2, false);
+            objPic[ObjPic_Carryall][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Carryall][HOUSE_HARKONNEN][0], 8, 2, false);
+        } break;
+
+        case ObjPic_CarryallShadow: {
+            SDL_Surface* pCarryall = getShpfile("UNITS.SHP")->getPictureArray(8,2,AIRUNIT_ROW(45),AIRUNIT_ROW(48));
+            objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][0] = createShadowSurface(pCarryall);
+            SDL_FreeSurface(pCarryall);
+            objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][0], 8, 2, false);
+            objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_CarryallShadow][HOUSE_HARKONNEN][0], 8, 2, false);
+        } break;
+
+        case ObjPic_Frigate: {
+            objPic[ObjPic_Frigate][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(8,1,AIRUNIT_ROW(60));
+            objPic[ObjPic_Frigate][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Frigate][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Frigate][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Frigate][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_FrigateShadow: {
+            SDL_Surface* pFrigate = getShpfile("UNITS.SHP")->getPictureArray(8,1,AIRUNIT_ROW(60));
+            objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][0] = createShadowSurface(pFrigate);
+            SDL_FreeSurface(pFrigate);
+            objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_FrigateShadow][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Ornithopter: {
+            objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(8,3,ORNITHOPTER_ROW(51),ORNITHOPTER_ROW(52),ORNITHOPTER_ROW(53));
+            objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][0], 8, 3, false);
+            objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Ornithopter][HOUSE_HARKONNEN][0], 8, 3, false);
+        } break;
+
+        case ObjPic_OrnithopterShadow: {
+            SDL_Surface* pOrnithopter = getShpfile("UNITS.SHP")->getPictureArray(8,3,ORNITHOPTER_ROW(51),ORNITHOPTER_ROW(52),ORNITHOPTER_ROW(53));
+            objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][0] = createShadowSurface(pOrnithopter);
+            SDL_FreeSurface(pOrnithopter);
+            objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][0], 8, 3, false);
+            objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_OrnithopterShadow][HOUSE_HARKONNEN][0], 8, 3, false);
+        } break;
+
+        case ObjPic_Trooper: {
+            objPic[ObjPic_Trooper][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(4,3,INFANTRY_ROW(82),INFANTRY_ROW(83),INFANTRY_ROW(84));
+            objPic[ObjPic_Trooper][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Trooper][HOUSE_HARKONNEN][0], 4, 3, false);
+            objPic[ObjPic_Trooper][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Trooper][HOUSE_HARKONNEN][0], 4, 3, false);
+        } break;
+
+        case ObjPic_Troopers: {
+            objPic[ObjPic_Troopers][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(4,4,MULTIINFANTRY_ROW(103),MULTIINFANTRY_ROW(104),MULTIINFANTRY_ROW(105),MULTIINFANTRY_ROW(106));
+            objPic[ObjPic_Troopers][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Troopers][HOUSE_HARKONNEN][0], 4, 3, false);
+            objPic[ObjPic_Troopers][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Troopers][HOUSE_HARKONNEN][0], 4, 3, false);
+        } break;
+
+        case ObjPic_Soldier: {
+            objPic[ObjPic_Soldier][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(4,3,INFANTRY_ROW(73),INFANTRY_ROW(74),INFANTRY_ROW(75));
+            objPic[ObjPic_Soldier][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Soldier][HOUSE_HARKONNEN][0], 4, 3, false);
+            objPic[ObjPic_Soldier][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Soldier][HOUSE_HARKONNEN][0], 4, 3, false);
+        } break;
+
+        case ObjPic_Infantry: {
+            objPic[ObjPic_Infantry][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(4,4,MULTIINFANTRY_ROW(91),MULTIINFANTRY_ROW(92),MULTIINFANTRY_ROW(93),MULTIINFANTRY_ROW(94));
+            objPic[ObjPic_Infantry][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Infantry][HOUSE_HARKONNEN][0], 4, 3, false);
+            objPic[ObjPic_Infantry][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Infantry][HOUSE_HARKONNEN][0], 4, 3, false);
+        } break;
+
+        case ObjPic_Saboteur: {
+            objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(4,3,INFANTRY_ROW(63),INFANTRY_ROW(64),INFANTRY_ROW(65));
+            objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][0], 4, 3, false);
+            objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Saboteur][HOUSE_HARKONNEN][0], 4, 3, false);
+        } break;
+
+        case ObjPic_Sandworm: {
+            objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(1,9,71|TILE_NORMAL,70|TILE_NORMAL,69|TILE_NORMAL,68|TILE_NORMAL,67|TILE_NORMAL,68|TILE_NORMAL,69|TILE_NORMAL,70|TILE_NORMAL,71|TILE_NORMAL);
+            objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][0], 1, 9, false);
+            objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Sandworm][HOUSE_HARKONNEN][0], 1, 9, false);
+        } break;
+
+        case ObjPic_ConstructionYard: {
+            objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(17);
+            objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][0], 4, 1, false);
+            objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ConstructionYard][HOUSE_HARKONNEN][0], 4, 1, false);
+        } break;
+
+        case ObjPic_Windtrap: {
+            objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(19);
+            objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][0], 4, 1, false);
+            objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Windtrap][HOUSE_HARKONNEN][0], 4, 1, false);
+        } break;
+
+        case ObjPic_Refinery: {
+            objPic[ObjPic_Refinery][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(21);
+            objPic[ObjPic_Refinery][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Refinery][HOUSE_HARKONNEN][0], 10, 1, false);
+            objPic[ObjPic_Refinery][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Refinery][HOUSE_HARKONNEN][0], 10, 1, false);
+        } break;
+
+        case ObjPic_Barracks: {
+            objPic[ObjPic_Barracks][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(18);
+            objPic[ObjPic_Barracks][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Barracks][HOUSE_HARKONNEN][0], 4, 1, false);
+            objPic[ObjPic_Barracks][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Barracks][HOUSE_HARKONNEN][0], 4, 1, false);
+        } break;
+
+        case ObjPic_WOR: {
+            objPic[ObjPic_WOR][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(16);
+            objPic[ObjPic_WOR][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_WOR][HOUSE_HARKONNEN][0], 4, 1, false);
+            objPic[ObjPic_WOR][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_WOR][HOUSE_HARKONNEN][0], 4, 1, false);
+        } break;
+
+        case ObjPic_Radar: {
+            objPic[ObjPic_Radar][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(26);
+            objPic[ObjPic_Radar][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Radar][HOUSE_HARKONNEN][0], 4, 1, false);
+            objPic[ObjPic_Radar][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Radar][HOUSE_HARKONNEN][0], 4, 1, false);
+        } break;
+
+        case ObjPic_LightFactory: {
+            objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(12);
+            objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][0], 6, 1, false);
+            objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_LightFactory][HOUSE_HARKONNEN][0], 6, 1, false);
+        } break;
+
+        case ObjPic_Silo: {
+            objPic[ObjPic_Silo][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(25);
+            objPic[ObjPic_Silo][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Silo][HOUSE_HARKONNEN][0], 4, 1, false);
+            objPic[ObjPic_Silo][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Silo][HOUSE_HARKONNEN][0], 4, 1, false);
+        } break;
+
+        case ObjPic_HeavyFactory: {
+            objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(13);
+            objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_HeavyFactory][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_HighTechFactory: {
+            objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(14);
+            objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_HighTechFactory][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_IX: {
+            objPic[ObjPic_IX][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(15);
+            objPic[ObjPic_IX][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_IX][HOUSE_HARKONNEN][0], 4, 1, false);
+            objPic[ObjPic_IX][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_IX][HOUSE_HARKONNEN][0], 4, 1, false);
+        } break;
+
+        case ObjPic_Palace: {
+            objPic[ObjPic_Palace][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(11);
+            objPic[ObjPic_Palace][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Palace][HOUSE_HARKONNEN][0], 4, 1, false);
+            objPic[ObjPic_Palace][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Palace][HOUSE_HARKONNEN][0], 4, 1, false);
+        } break;
+
+        case ObjPic_RepairYard: {
+            objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(22);
+            objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][0], 10, 1, false);
+            objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_RepairYard][HOUSE_HARKONNEN][0], 10, 1, false);
+        } break;
+
+        case ObjPic_Starport: {
+            objPic[ObjPic_Starport][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(20);
+            objPic[ObjPic_Starport][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Starport][HOUSE_HARKONNEN][0], 10, 1, false);
+            objPic[ObjPic_Starport][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Starport][HOUSE_HARKONNEN][0], 10, 1, false);
+        } break;
+
+        case ObjPic_GunTurret: {
+            objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(23);
+            objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][0], 10, 1, false);
+            objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_GunTurret][HOUSE_HARKONNEN][0], 10, 1, false);
+        } break;
+
+        case ObjPic_RocketTurret: {
+            objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(24);
+            objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][0], 10, 1, false);
+            objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_RocketTurret][HOUSE_HARKONNEN][0], 10, 1, false);
+        } break;
+
+        case ObjPic_Wall: {
+            objPic[ObjPic_Wall][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(6,1,1,75);
+            objPic[ObjPic_Wall][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Wall][HOUSE_HARKONNEN][0], 75, 1, false);
+            objPic[ObjPic_Wall][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Wall][HOUSE_HARKONNEN][0], 75, 1, false);
+        } break;
+
+        case ObjPic_Bullet_SmallRocket: {
+            objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(16,1,ROCKET_ROW(35));
+            objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][0], 16, 1, false);
+            objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_SmallRocket][HOUSE_HARKONNEN][0], 16, 1, false);
+        } break;
+
+        case ObjPic_Bullet_MediumRocket: {
+            objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(16,1,ROCKET_ROW(20));
+            objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][0], 16, 1, false);
+            objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_MediumRocket][HOUSE_HARKONNEN][0], 16, 1, false);
+        } break;
+
+        case ObjPic_Bullet_LargeRocket: {
+            objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][0] = getShpfile("UNITS.SHP")->getPictureArray(16,1,ROCKET_ROW(40));
+            objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][0], 16, 1, false);
+            objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_LargeRocket][HOUSE_HARKONNEN][0], 16, 1, false);
+        } break;
+
+        case ObjPic_Bullet_Small: {
+            objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPicture(23);
+            objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][0], 1, 1, false);
+            objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_Small][HOUSE_HARKONNEN][0], 1, 1, false);
+        } break;
+
+        case ObjPic_Bullet_Medium: {
+            objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPicture(24);
+            objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][0], 1, 1, false);
+            objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_Medium][HOUSE_HARKONNEN][0], 1, 1, false);
+        } break;
+
+        case ObjPic_Bullet_Large: {
+            objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPicture(25);
+            objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][0], 1, 1, false);
+            objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_Large][HOUSE_HARKONNEN][0], 1, 1, false);
+        } break;
+
+        case ObjPic_Bullet_Sonic: {
+            objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPicture(10);
+            objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][0], 1, 1, false);
+            objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Bullet_Sonic][HOUSE_HARKONNEN][0], 1, 1, false);
+        } break;
+
+        case ObjPic_Hit_Gas: {
+            objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][0] = getShpfile("UNITS1.SHP")->getPictureArray(5,1,57|TILE_NORMAL,58|TILE_NORMAL,59|TILE_NORMAL,60|TILE_NORMAL,61|TILE_NORMAL);
+            objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][0], 5, 1, false);
+            objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][0], 5, 1, false);
+            objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][0] = mapSurfaceColorRange(objPic[ObjPic_Hit_Gas][HOUSE_ORDOS][0], COLOR_ORDOS, COLOR_HARKONNEN);
+            objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][0], 5, 1, false);
+            objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_Gas][HOUSE_HARKONNEN][0], 5, 1, false);
+        } break;
+
+        case ObjPic_Hit_ShellSmall: {
+            objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPicture(2);
+            objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][0], 1, 1, false);
+            objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_ShellSmall][HOUSE_HARKONNEN][0], 1, 1, false);
+        } break;
+
+        case ObjPic_Hit_ShellMedium: {
+            objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPicture(3);
+            objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][0], 1, 1, false);
+            objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_ShellMedium][HOUSE_HARKONNEN][0], 1, 1, false);
+        } break;
+
+        case ObjPic_Hit_ShellLarge: {
+            objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPicture(4);
+            objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][0], 1, 1, false);
+            objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Hit_ShellLarge][HOUSE_HARKONNEN][0], 1, 1, false);
+        } break;
+
+        case ObjPic_ExplosionSmall: {
+            objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(5,1,32|TILE_NORMAL,33|TILE_NORMAL,34|TILE_NORMAL,35|TILE_NORMAL,36|TILE_NORMAL);
+            objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][0], 5, 1, false);
+            objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionSmall][HOUSE_HARKONNEN][0], 5, 1, false);
+        } break;
+
+        case ObjPic_ExplosionMedium1: {
+            objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(5,1,47|TILE_NORMAL,48|TILE_NORMAL,49|TILE_NORMAL,50|TILE_NORMAL,51|TILE_NORMAL);
+            objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][0], 5, 1, false);
+            objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionMedium1][HOUSE_HARKONNEN][0], 5, 1, false);
+        } break;
+
+        case ObjPic_ExplosionMedium2: {
+            objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(5,1,52|TILE_NORMAL,53|TILE_NORMAL,54|TILE_NORMAL,55|TILE_NORMAL,56|TILE_NORMAL);
+            objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][0], 5, 1, false);
+            objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionMedium2][HOUSE_HARKONNEN][0], 5, 1, false);
+        } break;
+
+        case ObjPic_ExplosionLarge1: {
+            objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(5,1,37|TILE_NORMAL,38|TILE_NORMAL,39|TILE_NORMAL,40|TILE_NORMAL,41|TILE_NORMAL);
+            objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][0], 5, 1, false);
+            objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionLarge1][HOUSE_HARKONNEN][0], 5, 1, false);
+        } break;
+
+        case ObjPic_ExplosionLarge2: {
+            objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(5,1,42|TILE_NORMAL,43|TILE_NORMAL,44|TILE_NORMAL,45|TILE_NORMAL,46|TILE_NORMAL);
+            objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][0], 5, 1, false);
+            objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionLarge2][HOUSE_HARKONNEN][0], 5, 1, false);
+        } break;
+
+        case ObjPic_ExplosionSmallUnit: {
+            objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(2,1,0|TILE_NORMAL,1|TILE_NORMAL);
+            objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][0], 2, 1, false);
+            objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionSmallUnit][HOUSE_HARKONNEN][0], 2, 1, false);
+        } break;
+
+        case ObjPic_ExplosionFlames: {
+            objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(21,1,	11|TILE_NORMAL,12|TILE_NORMAL,13|TILE_NORMAL,17|TILE_NORMAL,18|TILE_NORMAL,19|TILE_NORMAL,17|TILE_NORMAL,
+                                                             18|TILE_NORMAL,19|TILE_NORMAL,17|TILE_NORMAL,18|TILE_NORMAL,19|TILE_NORMAL,17|TILE_NORMAL,18|TILE_NORMAL,
+                                                             19|TILE_NORMAL,17|TILE_NORMAL,18|TILE_NORMAL,19|TILE_NORMAL,20|TILE_NORMAL,21|TILE_NORMAL,22|TILE_NORMAL);
+            objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][0], 21, 1, false);
+            objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionFlames][HOUSE_HARKONNEN][0], 21, 1, false);
+        } break;
+
+        case ObjPic_ExplosionSpiceBloom: {
+            objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(3,1,7|TILE_NORMAL,6|TILE_NORMAL,5|TILE_NORMAL);
+            objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][0], 3, 1, false);
+            objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_ExplosionSpiceBloom][HOUSE_HARKONNEN][0], 3, 1, false);
+        } break;
+
+        case ObjPic_DeadInfantry: {
+            objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(4,1,1,6);
+            objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][0], 6, 1, false);
+            objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_DeadInfantry][HOUSE_HARKONNEN][0], 6, 1, false);
+        } break;
+
+        case ObjPic_DeadAirUnit: {
+            objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureArray(3,1,1,6);
+            objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][0], 6, 1, false);
+            objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_DeadAirUnit][HOUSE_HARKONNEN][0], 6, 1, false);
+        } break;
+
+        case ObjPic_Smoke: {
+            objPic[ObjPic_Smoke][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPictureArray(3,1,29|TILE_NORMAL,30|TILE_NORMAL,31|TILE_NORMAL);
+            objPic[ObjPic_Smoke][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Smoke][HOUSE_HARKONNEN][0], 3, 1, false);
+            objPic[ObjPic_Smoke][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Smoke][HOUSE_HARKONNEN][0], 3, 1, false);
+        } break;
+
+        case ObjPic_SandwormShimmerMask: {
+            objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][0] = getShpfile("UNITS1.SHP")->getPicture(10);
+            objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][0], 1, 1, false);
+            objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_SandwormShimmerMask][HOUSE_HARKONNEN][0], 1, 1, false);
+        } break;
+
+        case ObjPic_Terrain: {
+            objPic[ObjPic_Terrain][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureRow(124,209);
+            objPic[ObjPic_Terrain][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Terrain][HOUSE_HARKONNEN][0], 86, 1, false);
+            objPic[ObjPic_Terrain][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Terrain][HOUSE_HARKONNEN][0], 86, 1, false);
+        } break;
+
+        case ObjPic_DestroyedStructure: {
+            objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureRow2(14, 33, 125, 213, 214, 215, 223, 224, 225, 232, 233, 234, 240, 246, 247);
+            objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][0], 14, 1, false);
+            objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_DestroyedStructure][HOUSE_HARKONNEN][0], 14, 1, false);
+        } break;
+
+        case ObjPic_RockDamage: {
+            objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureRow(1,6);
+            objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][0], 6, 1, false);
+            objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_RockDamage][HOUSE_HARKONNEN][0], 6, 1, false);
+        } break;
+
+        case ObjPic_SandDamage: {
+            objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureRow(7,12);
+            objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][0], 3, 1, false);
+            objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_SandDamage][HOUSE_HARKONNEN][0], 3, 1, false);
+        } break;
+
+        case ObjPic_Terrain_Hidden: {
+            objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureRow(108,123);
+            objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][0], 16, 1, false);
+            objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Terrain_Hidden][HOUSE_HARKONNEN][0], 16, 1, false);
+        } break;
+
+        case ObjPic_Terrain_HiddenFog: {
+            objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureRow(108,123);
+            objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][0], 16, 1, false);
+            objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][0], 16, 1, false);
+        } break;
+
+        case ObjPic_Terrain_Tracks: {
+            objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][0] = getIcnfile()->getPictureRow(25,32);
+            objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][1] = Scaler::defaultDoubleTiledSurface(objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][0], 8, 1, false);
+            objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][2] = Scaler::defaultTripleTiledSurface(objPic[ObjPic_Terrain_Tracks][HOUSE_HARKONNEN][0], 8, 1, false);
+        } break;
+
+        case ObjPic_Star: {
+            objPic[ObjPic_Star][HOUSE_HARKONNEN][0] = SDL_LoadBMP_RW(pFileManager->openFile("Star5x5.bmp"),true);
+            objPic[ObjPic_Star][HOUSE_HARKONNEN][1] = SDL_LoadBMP_RW(pFileManager->openFile("Star7x7.bmp"),true);
+            objPic[ObjPic_Star][HOUSE_HARKONNEN][2] = SDL_LoadBMP_RW(pFileManager->openFile("Star11x11.bmp"),true);
+        } break;
+
+        default: {
+            fprintf(stderr,"GFXManager::decodeObjPic(): Invalid object picture id %d\n",id);
+            exit(EXIT_FAILURE);
+        } break;
+    }
+}
+
+void GFXManager::publishObjPic(unsigned int id) {
+    if(objPicState[id] == AssetState_Ready) {
+        return;
+    }
+
+    for(int j = 0; j < (int) NUM_HOUSES; j++) {
+        for(int z=0; z < NUM_ZOOMLEVEL; z++) {
+            if(objPic[id][j][z] != NULL) {
+                SDL_SetColorKey(objPic[id][j][z], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+                SDL_Surface* tmp;
+                tmp = objPic[id][j][z];
+                if((objPic[id][j][z] = SDL_DisplayFormat(tmp)) == NULL) {
+                    fprintf(stderr,"GFXManager: SDL_DisplayFormat() failed!\n");
+                    exit(EXIT_FAILURE);
+                }
+                SDL_FreeSurface(tmp);
+            }
+        }
+    }
+
+    if(id == ObjPic_Terrain_HiddenFog) {
+        // Precalculate which pixels of the fog tiles are darkened (color 12)
+        for(int z = 0; z < NUM_ZOOMLEVEL; z++) {
+            SDL_Surface* pHiddenFog = objPic[ObjPic_Terrain_HiddenFog][HOUSE_HARKONNEN][z];
+            int tileSize = pHiddenFog->h;
+            for(int i = 0; i < NUM_FOGTILES; i++) {
+                SDL_Rect tileRect = { i*tileSize, 0, tileSize, tileSize };
+                fogMask[i][z] = createMaskSpans(pHiddenFog, tileRect, 12);
+            }
+        }
+    }
+
+    objPicState[id] = AssetState_Ready;
+}
+
+void GFXManager::buildUIGraphic(unsigned int id) {
+    switch(id) {
+        case UI_RadarAnimation: {
+            uiGraphic[UI_RadarAnimation][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(loadWsafile("STATIC.WSA")->getAnimationAsPictureRow());
+        } break;
+
+        case UI_CursorNormal: {
+            uiGraphic[UI_CursorNormal][HOUSE_HARKONNEN] = getShpfile("MOUSE.SHP")->getPicture(0);
+            SDL_SetColorKey(uiGraphic[UI_CursorNormal][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_CursorUp: {
+            uiGraphic[UI_CursorUp][HOUSE_HARKONNEN] = getShpfile("MOUSE.SHP")->getPicture(1);
+            SDL_SetColorKey(uiGraphic[UI_CursorUp][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_CursorRight: {
+            uiGraphic[UI_CursorRight][HOUSE_HARKONNEN] = getShpfile("MOUSE.SHP")->getPicture(2);
+            SDL_SetColorKey(uiGraphic[UI_CursorRight][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_CursorDown: {
+            uiGraphic[UI_CursorDown][HOUSE_HARKONNEN] = getShpfile("MOUSE.SHP")->getPicture(3);
+            SDL_SetColorKey(uiGraphic[UI_CursorDown][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_CursorLeft: {
+            uiGraphic[UI_CursorLeft][HOUSE_HARKONNEN] = getShpfile("MOUSE.SHP")->getPicture(4);
+            SDL_SetColorKey(uiGraphic[UI_CursorLeft][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_CursorMove_Zoomlevel0:
+        case UI_CursorMove_Zoomlevel1:
+        case UI_CursorMove_Zoomlevel2:
+        case UI_CursorAttack_Zoomlevel0:
+        case UI_CursorAttack_Zoomlevel1:
+        case UI_CursorAttack_Zoomlevel2: {
+            uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN] = getShpfile("MOUSE.SHP")->getPicture(5);
+            SDL_SetColorKey(uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_CursorMove_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_CursorMove_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_CursorMove_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_CursorMove_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_CursorAttack_Zoomlevel0][HOUSE_HARKONNEN] = mapSurfaceColorRange(uiGraphic[UI_CursorMove_Zoomlevel0][HOUSE_HARKONNEN], 232, COLOR_HARKONNEN);
+            SDL_SetColorKey(uiGraphic[UI_CursorAttack_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_CursorAttack_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_CursorAttack_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_CursorAttack_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_CursorAttack_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_CursorAttack_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_CursorAttack_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+
+            uiGraphicState[UI_CursorMove_Zoomlevel0] = AssetState_Built;
+            uiGraphicState[UI_CursorMove_Zoomlevel1] = AssetState_Built;
+            uiGraphicState[UI_CursorMove_Zoomlevel2] = AssetState_Built;
+            uiGraphicState[UI_CursorAttack_Zoomlevel0] = AssetState_Built;
+            uiGraphicState[UI_CursorAttack_Zoomlevel1] = AssetState_Built;
+            uiGraphicState[UI_CursorAttack_Zoomlevel2] = AssetState_Built;
+        } break;
+
+        case UI_CursorCapture_Zoomlevel0:
+        case UI_CursorCapture_Zoomlevel1:
+        case UI_CursorCapture_Zoomlevel2: {
+            uiGraphic[UI_CursorCapture_Zoomlevel0][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Capture.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_CursorCapture_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_CursorCapture_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_CursorCapture_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_CursorCapture_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_CursorCapture_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_CursorCapture_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_CursorCapture_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+
+            uiGraphicState[UI_CursorCapture_Zoomlevel0] = AssetState_Built;
+            uiGraphicState[UI_CursorCapture_Zoomlevel1] = AssetState_Built;
+            uiGraphicState[UI_CursorCapture_Zoomlevel2] = AssetState_Built;
+        } break;
+
+        case UI_ReturnIcon: {
+            uiGraphic[UI_ReturnIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Return.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_ReturnIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_DeployIcon: {
+            uiGraphic[UI_DeployIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Deploy.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_DeployIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_DestructIcon: {
+            uiGraphic[UI_DestructIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Destruct.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_DestructIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_CreditsDigits: {
+            uiGraphic[UI_CreditsDigits][HOUSE_HARKONNEN] = getShpfile("SHAPES.SHP")->getPictureArray(10,1,2|TILE_NORMAL,3|TILE_NORMAL,4|TILE_NORMAL,5|TILE_NORMAL,6|TILE_NORMAL,
+                7|TILE_NORMAL,8|TILE_NORMAL,9|TILE_NORMAL,10|TILE_NORMAL,11|TILE_NORMAL);
+        } break;
+
+        case UI_SideBar: {
+            uiGraphic[UI_SideBar][HOUSE_HARKONNEN] = getPictureFactory()->createSideBar(false);
+        } break;
+
+        case UI_Indicator: {
+            uiGraphic[UI_Indicator][HOUSE_HARKONNEN] = getShpfile("UNITS1.SHP")->getPictureArray(3,1,8|TILE_NORMAL,9|TILE_NORMAL,10|TILE_NORMAL);
+            SDL_SetColorKey(uiGraphic[UI_Indicator][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_InvalidPlace_Zoomlevel0: {
+            uiGraphic[UI_InvalidPlace_Zoomlevel0][HOUSE_HARKONNEN] = getPictureFactory()->createPlacingGrid(16, COLOR_LIGHTRED);
+        } break;
+
+        case UI_InvalidPlace_Zoomlevel1: {
+            uiGraphic[UI_InvalidPlace_Zoomlevel1][HOUSE_HARKONNEN] = getPictureFactory()->createPlacingGrid(32, COLOR_LIGHTRED);
+        } break;
+
+        case UI_InvalidPlace_Zoomlevel2: {
+            uiGraphic[UI_InvalidPlace_Zoomlevel2][HOUSE_HARKONNEN] = getPictureFactory()->createPlacingGrid(48, COLOR_LIGHTRED);
+        } break;
+
+        case UI_ValidPlace_Zoomlevel0: {
+            uiGraphic[UI_ValidPlace_Zoomlevel0][HOUSE_HARKONNEN] = getPictureFactory()->createPlacingGrid(16, COLOR_LIGHTGREEN);
+        } break;
+
+        case UI_ValidPlace_Zoomlevel1: {
+            uiGraphic[UI_ValidPlace_Zoomlevel1][HOUSE_HARKONNEN] = getPictureFactory()->createPlacingGrid(32, COLOR_LIGHTGREEN);
+        } break;
+
+        case UI_ValidPlace_Zoomlevel2: {
+            uiGraphic[UI_ValidPlace_Zoomlevel2][HOUSE_HARKONNEN] = getPictureFactory()->createPlacingGrid(48, COLOR_LIGHTGREEN);
+        } break;
+
+        case UI_GreyPlace_Zoomlevel0: {
+            uiGraphic[UI_GreyPlace_Zoomlevel0][HOUSE_HARKONNEN] = getPictureFactory()->createPlacingGrid(16, COLOR_LIGHTGREY);
+        } break;
+
+        case UI_GreyPlace_Zoomlevel1: {
+            uiGraphic[UI_GreyPlace_Zoomlevel1][HOUSE_HARKONNEN] = getPictureFactory()->createPlacingGrid(32, COLOR_LIGHTGREY);
+        } break;
+
+        case UI_GreyPlace_Zoomlevel2: {
+            uiGraphic[UI_GreyPlace_Zoomlevel2][HOUSE_HARKONNEN] = getPictureFactory()->createPlacingGrid(48, COLOR_LIGHTGREY);
+        } break;
+
+        case UI_MenuBackground: {
+            uiGraphic[UI_MenuBackground][HOUSE_HARKONNEN] = getPictureFactory()->createMainBackground();
+        } break;
+
+        case UI_Background: {
+            uiGraphic[UI_Background][HOUSE_HARKONNEN] = getPictureFactory()->createBackground();
+        } break;
+
+        case UI_GameStatsBackground: {
+            uiGraphic[UI_GameStatsBackground][HOUSE_HARKONNEN] = getPictureFactory()->createGameStatsBackground(HOUSE_HARKONNEN);
+            uiGraphic[UI_GameStatsBackground][HOUSE_ATREIDES] = getPictureFactory()->createGameStatsBackground(HOUSE_ATREIDES);
+            uiGraphic[UI_GameStatsBackground][HOUSE_ORDOS] = getPictureFactory()->createGameStatsBackground(HOUSE_ORDOS);
+            uiGraphic[UI_GameStatsBackground][HOUSE_FREMEN] = getPictureFactory()->createGameStatsBackground(HOUSE_FREMEN);
+            uiGraphic[UI_GameStatsBackground][HOUSE_SARDAUKAR] = getPictureFactory()->createGameStatsBackground(HOUSE_SARDAUKAR);
+            uiGraphic[UI_GameStatsBackground][HOUSE_MERCENARY] = getPictureFactory()->createGameStatsBackground(HOUSE_MERCENARY);
+        } break;
+
+        case UI_SelectionBox_Zoomlevel0:
+        case UI_SelectionBox_Zoomlevel1:
+        case UI_SelectionBox_Zoomlevel2: {
+            uiGraphic[UI_SelectionBox_Zoomlevel0][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("UI_SelectionBox.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_SelectionBox_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_SelectionBox_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_SelectionBox_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_SelectionBox_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_SelectionBox_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_SelectionBox_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_SelectionBox_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+
+            uiGraphicState[UI_SelectionBox_Zoomlevel0] = AssetState_Built;
+            uiGraphicState[UI_SelectionBox_Zoomlevel1] = AssetState_Built;
+            uiGraphicState[UI_SelectionBox_Zoomlevel2] = AssetState_Built;
+        } break;
+
+        case UI_OtherPlayerSelectionBox_Zoomlevel0:
+        case UI_OtherPlayerSelectionBox_Zoomlevel1:
+        case UI_OtherPlayerSelectionBox_Zoomlevel2: {
+            uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel0][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("UI_OtherPlayerSelectionBox.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel0][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel1][HOUSE_HARKONNEN] = Scaler::defaultDoubleTiledSurface(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel2][HOUSE_HARKONNEN] = Scaler::defaultTripleTiledSurface(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel0][HOUSE_HARKONNEN], 1, 1, false);
+            SDL_SetColorKey(uiGraphic[UI_OtherPlayerSelectionBox_Zoomlevel2][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+
+            uiGraphicState[UI_OtherPlayerSelectionBox_Zoomlevel0] = AssetState_Built;
+            uiGraphicState[UI_OtherPlayerSelectionBox_Zoomlevel1] = AssetState_Built;
+            uiGraphicState[UI_OtherPlayerSelectionBox_Zoomlevel2] = AssetState_Built;
+        } break;
+
+        case UI_TopBar: {
+            uiGraphic[UI_TopBar][HOUSE_HARKONNEN] = getPictureFactory()->createTopBar();
+        } break;
+
+        case UI_ButtonUp: {
+            uiGraphic[UI_ButtonUp][HOUSE_HARKONNEN] = getChoamShpfile()->getPicture(0);
+        } break;
+
+        case UI_ButtonUp_Pressed: {
+            uiGraphic[UI_ButtonUp_Pressed][HOUSE_HARKONNEN] = getChoamShpfile()->getPicture(1);
+        } break;
+
+        case UI_ButtonDown: {
+            uiGraphic[UI_ButtonDown][HOUSE_HARKONNEN] = getChoamShpfile()->getPicture(2);
+        } break;
+
+        case UI_ButtonDown_Pressed: {
+            uiGraphic[UI_ButtonDown_Pressed][HOUSE_HARKONNEN] = getChoamShpfile()->getPicture(3);
+        } break;
+
+        case UI_BuilderListUpperCap: {
+            uiGraphic[UI_BuilderListUpperCap][HOUSE_HARKONNEN] = getPictureFactory()->createBuilderListUpperCap();
+        } break;
+
+        case UI_BuilderListLowerCap: {
+            uiGraphic[UI_BuilderListLowerCap][HOUSE_HARKONNEN] = getPictureFactory()->createBuilderListLowerCap();
+        } break;
+
+        case UI_CustomGamePlayersArrow: {
+            uiGraphic[UI_CustomGamePlayersArrow][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("CustomGamePlayers_Arrow.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_CustomGamePlayersArrow][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_CustomGamePlayersArrowNeutral: {
+            uiGraphic[UI_CustomGamePlayersArrowNeutral][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("CustomGamePlayers_ArrowNeutral.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_CustomGamePlayersArrowNeutral][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MessageBox: {
+            uiGraphic[UI_MessageBox][HOUSE_HARKONNEN] = getPictureFactory()->createMessageBoxBorder();
+        } break;
+
+        case UI_Mentat:
+        case UI_Mentat_Pressed:
+        case UI_Options:
+        case UI_Options_Pressed: {
+            shared_ptr<Shpfile> bttn;
+            if(pFileManager->exists("BTTN." + languageFileExtension)) {
+                bttn = getShpfile("BTTN." + languageFileExtension);
+            }
+
+            if(bttn.get() != NULL) {
+                uiGraphic[UI_Mentat][HOUSE_HARKONNEN] = bttn->getPicture(0);
+                uiGraphic[UI_Mentat_Pressed][HOUSE_HARKONNEN] = bttn->getPicture(1);
+                uiGraphic[UI_Options][HOUSE_HARKONNEN] = bttn->getPicture(2);
+                uiGraphic[UI_Options_Pressed][HOUSE_HARKONNEN] = bttn->getPicture(3);
+            } else {
+                // The US-Version has the buttons in SHAPES.SHP
+                shared_ptr<Shpfile> shapes = getShpfile("SHAPES.SHP");
+                uiGraphic[UI_Mentat][HOUSE_HARKONNEN] = shapes->getPicture(94);
+                uiGraphic[UI_Mentat_Pressed][HOUSE_HARKONNEN] = shapes->getPicture(95);
+                uiGraphic[UI_Options][HOUSE_HARKONNEN] = shapes->getPicture(96);
+                uiGraphic[UI_Options_Pressed][HOUSE_HARKONNEN] = shapes->getPicture(97);
+            }
+
+            uiGraphicState[UI_Mentat] = AssetState_Built;
+            uiGraphicState[UI_Mentat_Pressed] = AssetState_Built;
+            uiGraphicState[UI_Options] = AssetState_Built;
+            uiGraphicState[UI_Options_Pressed] = AssetState_Built;
+        } break;
+
+        case UI_Upgrade: {
+            uiGraphic[UI_Upgrade][HOUSE_HARKONNEN] = getChoamShpfile()->getPicture(4);
+            SDL_SetColorKey(uiGraphic[UI_Upgrade][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_Upgrade_Pressed: {
+            uiGraphic[UI_Upgrade_Pressed][HOUSE_HARKONNEN] = getChoamShpfile()->getPicture(5);
+            SDL_SetColorKey(uiGraphic[UI_Upgrade_Pressed][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_Repair: {
+            uiGraphic[UI_Repair][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_Repair.bmp"),true);
+        } break;
+
+        case UI_Repair_Pressed: {
+            uiGraphic[UI_Repair_Pressed][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_RepairPushed.bmp"),true);
+        } break;
+
+        case UI_Minus: {
+            uiGraphic[UI_Minus][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_Minus.bmp"),true);
+        } break;
+
+        case UI_Minus_Pressed: {
+            uiGraphic[UI_Minus_Pressed][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_MinusPushed.bmp"),true);
+        } break;
+
+        case UI_Plus: {
+            uiGraphic[UI_Plus][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_Plus.bmp"),true);
+        } break;
+
+        case UI_Plus_Pressed: {
+            uiGraphic[UI_Plus_Pressed][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Button_PlusPushed.bmp"),true);
+        } break;
+
+        case UI_MissionSelect: {
+            uiGraphic[UI_MissionSelect][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("Menu_MissionSelect.bmp"),true);
+            getPictureFactory()->drawFrame(uiGraphic[UI_MissionSelect][HOUSE_HARKONNEN],PictureFactory::SimpleFrame,NULL);
+            SDL_SetColorKey(uiGraphic[UI_MissionSelect][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_OptionsMenu: {
+            uiGraphic[UI_OptionsMenu][HOUSE_HARKONNEN] = getPictureFactory()->createOptionsMenu();
+        } break;
+
+        case UI_LoadSaveWindow: {
+            uiGraphic[UI_LoadSaveWindow][HOUSE_HARKONNEN] = getPictureFactory()->createMenu(280,228);
+        } break;
+
+        case UI_NewMapWindow: {
+            uiGraphic[UI_NewMapWindow][HOUSE_HARKONNEN] = getPictureFactory()->createMenu(600,440);
+        } break;
+
+        case UI_DuneLegacy:
+        case UI_GameMenu: {
+            // the game menu shows the logo without the frame
+            SDL_Surface* pDuneLegacy = SDL_LoadBMP_RW(pFileManager->openFile("DuneLegacy.bmp"),true);
+            uiGraphic[UI_GameMenu][HOUSE_HARKONNEN] = getPictureFactory()->createMenu(pDuneLegacy,158);
+            SDL_FreeSurface(pDuneLegacy);
+
+            uiGraphic[UI_DuneLegacy][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("DuneLegacy.bmp"),true);
+            getPictureFactory()->drawFrame(uiGraphic[UI_DuneLegacy][HOUSE_HARKONNEN],PictureFactory::SimpleFrame);
+
+            uiGraphicState[UI_DuneLegacy] = AssetState_Built;
+            uiGraphicState[UI_GameMenu] = AssetState_Built;
+        } break;
+
+        case UI_PlanetBackground: {
+            uiGraphic[UI_PlanetBackground][HOUSE_HARKONNEN] = LoadCPS_RW(pFileManager->openFile("BIGPLAN.CPS"),true);
+            getPictureFactory()->drawFrame(uiGraphic[UI_PlanetBackground][HOUSE_HARKONNEN],PictureFactory::SimpleFrame);
+        } break;
+
+        case UI_MenuButtonBorder: {
+            uiGraphic[UI_MenuButtonBorder][HOUSE_HARKONNEN] = getPictureFactory()->createFrame(PictureFactory::DecorationFrame1,190,123,false);
+        } break;
+
+        case UI_MentatBackground: {
+            uiGraphic[UI_MentatBackground][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(LoadCPS_RW(pFileManager->openFile("MENTATH.CPS"),true),true);
+            uiGraphic[UI_MentatBackground][HOUSE_ATREIDES] = Scaler::defaultDoubleSurface(LoadCPS_RW(pFileManager->openFile("MENTATA.CPS"),true),true);
+            uiGraphic[UI_MentatBackground][HOUSE_ORDOS] = Scaler::defaultDoubleSurface(LoadCPS_RW(pFileManager->openFile("MENTATO.CPS"),true),true);
+            uiGraphic[UI_MentatBackground][HOUSE_FREMEN] = PictureFactory::mapMentatSurfaceToFremen(uiGraphic[UI_MentatBackground][HOUSE_ATREIDES]);
+            uiGraphic[UI_MentatBackground][HOUSE_SARDAUKAR] = PictureFactory::mapMentatSurfaceToSardaukar(uiGraphic[UI_MentatBackground][HOUSE_HARKONNEN]);
+            uiGraphic[UI_MentatBackground][HOUSE_MERCENARY] = PictureFactory::mapMentatSurfaceToMercenary(uiGraphic[UI_MentatBackground][HOUSE_ORDOS]);
+        } break;
+
+        case UI_MentatBackgroundBene: {
+            uiGraphic[UI_MentatBackgroundBene][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(LoadCPS_RW(pFileManager->openFile("MENTATM.CPS"),true),true);
+            if(uiGraphic[UI_MentatBackgroundBene][HOUSE_HARKONNEN] != NULL) {
+                benePalette.applyToSurface(uiGraphic[UI_MentatBackgroundBene][HOUSE_HARKONNEN]);
+            }
+        } break;
+
+        case UI_MentatHouseChoiceInfoQuestion: {
+            uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_HARKONNEN] = getPictureFactory()->createMentatHouseChoiceQuestion(HOUSE_HARKONNEN, benePalette);
+            uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_ATREIDES] = getPictureFactory()->createMentatHouseChoiceQuestion(HOUSE_ATREIDES, benePalette);
+            uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_ORDOS] = getPictureFactory()->createMentatHouseChoiceQuestion(HOUSE_ORDOS, benePalette);
+            uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_SARDAUKAR] = getPictureFactory()->createMentatHouseChoiceQuestion(HOUSE_SARDAUKAR, benePalette);
+            uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_FREMEN] = getPictureFactory()->createMentatHouseChoiceQuestion(HOUSE_FREMEN, benePalette);
+            uiGraphic[UI_MentatHouseChoiceInfoQuestion][HOUSE_MERCENARY] = getPictureFactory()->createMentatHouseChoiceQuestion(HOUSE_MERCENARY, benePalette);
+        } break;
+
+        case UI_MentatYes: {
+            uiGraphic[UI_MentatYes][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(0),true);
+        } break;
+
+        case UI_MentatYes_Pressed: {
+            uiGraphic[UI_MentatYes_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(1),true);
+        } break;
+
+        case UI_MentatNo: {
+            uiGraphic[UI_MentatNo][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(2),true);
+        } break;
+
+        case UI_MentatNo_Pressed: {
+            uiGraphic[UI_MentatNo_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(3),true);
+        } break;
+
+        case UI_MentatExit: {
+            uiGraphic[UI_MentatExit][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(4),true);
+        } break;
+
+        case UI_MentatExit_Pressed: {
+            uiGraphic[UI_MentatExit_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(5),true);
+        } break;
+
+        case UI_MentatProcced: {
+            uiGraphic[UI_MentatProcced][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(6),true);
+        } break;
+
+        case UI_MentatProcced_Pressed: {
+            uiGraphic[UI_MentatProcced_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(7),true);
+        } break;
+
+        case UI_MentatRepeat: {
+            uiGraphic[UI_MentatRepeat][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(8),true);
+        } break;
+
+        case UI_MentatRepeat_Pressed: {
+            uiGraphic[UI_MentatRepeat_Pressed][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getMentatShpfile()->getPicture(9),true);
+        } break;
+
+        case UI_HouseSelect:
+        case UI_SelectYourHouseLarge:
+        case UI_Herald_Colored:
+        case UI_Herald_ColoredLarge:
+        case UI_Herald_Grey: {
+            SDL_Surface* pHouseChoiceBackground;
+            if(pFileManager->exists("HERALD." + languageFileExtension)) {
+                pHouseChoiceBackground = LoadCPS_RW(pFileManager->openFile("HERALD." + languageFileExtension),true);
+            } else {
+                pHouseChoiceBackground = LoadCPS_RW(pFileManager->openFile("HERALD.CPS"),true);
+            }
+
+            uiGraphic[UI_HouseSelect][HOUSE_HARKONNEN] = getPictureFactory()->createHouseSelect(pHouseChoiceBackground);
+            uiGraphic[UI_SelectYourHouseLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getSubPicture(pHouseChoiceBackground, 0, 0, 320, 50), true);
+            uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES] = getSubPicture(pHouseChoiceBackground,20,54,83,91);
+            uiGraphic[UI_Herald_ColoredLarge][HOUSE_ATREIDES] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES], false);
+            uiGraphic[UI_Herald_Colored][HOUSE_ORDOS] = getSubPicture(pHouseChoiceBackground,117,54,83,91);
+            uiGraphic[UI_Herald_ColoredLarge][HOUSE_ORDOS] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_ORDOS], false);
+            uiGraphic[UI_Herald_Colored][HOUSE_HARKONNEN] = getSubPicture(pHouseChoiceBackground,215,54,83,91);
+            uiGraphic[UI_Herald_ColoredLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_HARKONNEN], false);
+            uiGraphic[UI_Herald_Colored][HOUSE_FREMEN] = getPictureFactory()->createHeraldFre(uiGraphic[UI_Herald_Colored][HOUSE_HARKONNEN]);
+            uiGraphic[UI_Herald_ColoredLarge][HOUSE_FREMEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_FREMEN], false);
+            uiGraphic[UI_Herald_Colored][HOUSE_SARDAUKAR] = getPictureFactory()->createHeraldSard(uiGraphic[UI_Herald_Colored][HOUSE_ORDOS], uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES]);
+            uiGraphic[UI_Herald_ColoredLarge][HOUSE_SARDAUKAR] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_SARDAUKAR], false);
+            uiGraphic[UI_Herald_Colored][HOUSE_MERCENARY] = getPictureFactory()->createHeraldMerc(uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES], uiGraphic[UI_Herald_Colored][HOUSE_ORDOS]);
+            uiGraphic[UI_Herald_ColoredLarge][HOUSE_MERCENARY] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_Colored][HOUSE_MERCENARY], false);
+
+            SDL_FreeSurface(pHouseChoiceBackground);
+
+            uiGraphic[UI_Herald_Grey][HOUSE_HARKONNEN] = getPictureFactory()->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_HARKONNEN]);
+            uiGraphic[UI_Herald_Grey][HOUSE_ATREIDES] = getPictureFactory()->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_ATREIDES]);
+            uiGraphic[UI_Herald_Grey][HOUSE_ORDOS] = getPictureFactory()->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_ORDOS]);
+            uiGraphic[UI_Herald_Grey][HOUSE_FREMEN] = getPictureFactory()->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_FREMEN]);
+            uiGraphic[UI_Herald_Grey][HOUSE_SARDAUKAR] = getPictureFactory()->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_SARDAUKAR]);
+            uiGraphic[UI_Herald_Grey][HOUSE_MERCENARY] = getPictureFactory()->createGreyHouseChoice(uiGraphic[UI_Herald_Colored][HOUSE_MERCENARY]);
+
+            uiGraphicState[UI_HouseSelect] = AssetState_Built;
+            uiGraphicState[UI_SelectYourHouseLarge] = AssetState_Built;
+            uiGraphicState[UI_Herald_Colored] = AssetState_Built;
+            uiGraphicState[UI_Herald_ColoredLarge] = AssetState_Built;
+            uiGraphicState[UI_Herald_Grey] = AssetState_Built;
+        } break;
+
+        case UI_Herald_ArrowLeft:
+        case UI_Herald_ArrowLeftLarge: {
+            uiGraphic[UI_Herald_ArrowLeft][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("ArrowLeft.bmp"),true);
+            uiGraphic[UI_Herald_ArrowLeftLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_ArrowLeft][HOUSE_HARKONNEN], false);
+
+            uiGraphicState[UI_Herald_ArrowLeft] = AssetState_Built;
+            uiGraphicState[UI_Herald_ArrowLeftLarge] = AssetState_Built;
+        } break;
+
+        case UI_Herald_ArrowLeftHighlight:
+        case UI_Herald_ArrowLeftHighlightLarge: {
+            uiGraphic[UI_Herald_ArrowLeftHighlight][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("ArrowLeftHighlight.bmp"),true);
+            uiGraphic[UI_Herald_ArrowLeftHighlightLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_ArrowLeftHighlight][HOUSE_HARKONNEN], false);
+
+            uiGraphicState[UI_Herald_ArrowLeftHighlight] = AssetState_Built;
+            uiGraphicState[UI_Herald_ArrowLeftHighlightLarge] = AssetState_Built;
+        } break;
+
+        case UI_Herald_ArrowRight:
+        case UI_Herald_ArrowRightLarge: {
+            uiGraphic[UI_Herald_ArrowRight][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("ArrowRight.bmp"),true);
+            uiGraphic[UI_Herald_ArrowRightLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_ArrowRight][HOUSE_HARKONNEN], false);
+
+            uiGraphicState[UI_Herald_ArrowRight] = AssetState_Built;
+            uiGraphicState[UI_Herald_ArrowRightLarge] = AssetState_Built;
+        } break;
+
+        case UI_Herald_ArrowRightHighlight:
+        case UI_Herald_ArrowRightHighlightLarge: {
+            uiGraphic[UI_Herald_ArrowRightHighlight][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("ArrowRightHighlight.bmp"),true);
+            uiGraphic[UI_Herald_ArrowRightHighlightLarge][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(uiGraphic[UI_Herald_ArrowRightHighlight][HOUSE_HARKONNEN], false);
+
+            uiGraphicState[UI_Herald_ArrowRightHighlight] = AssetState_Built;
+            uiGraphicState[UI_Herald_ArrowRightHighlightLarge] = AssetState_Built;
+        } break;
+
+        case UI_MapChoiceScreen: {
+            uiGraphic[UI_MapChoiceScreen][HOUSE_HARKONNEN] = getPictureFactory()->createMapChoiceScreen(HOUSE_HARKONNEN);
+            uiGraphic[UI_MapChoiceScreen][HOUSE_ATREIDES] = getPictureFactory()->createMapChoiceScreen(HOUSE_ATREIDES);
+            uiGraphic[UI_MapChoiceScreen][HOUSE_ORDOS] = getPictureFactory()->createMapChoiceScreen(HOUSE_ORDOS);
+            uiGraphic[UI_MapChoiceScreen][HOUSE_FREMEN] = getPictureFactory()->createMapChoiceScreen(HOUSE_FREMEN);
+            uiGraphic[UI_MapChoiceScreen][HOUSE_SARDAUKAR] = getPictureFactory()->createMapChoiceScreen(HOUSE_SARDAUKAR);
+            uiGraphic[UI_MapChoiceScreen][HOUSE_MERCENARY] = getPictureFactory()->createMapChoiceScreen(HOUSE_MERCENARY);
+        } break;
+
+        case UI_MapChoicePlanet: {
+            uiGraphic[UI_MapChoicePlanet][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(LoadCPS_RW(pFileManager->openFile("PLANET.CPS"),true));
+            SDL_SetColorKey(uiGraphic[UI_MapChoicePlanet][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapChoiceMapOnly: {
+            uiGraphic[UI_MapChoiceMapOnly][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(LoadCPS_RW(pFileManager->openFile("DUNEMAP.CPS"),true));
+            SDL_SetColorKey(uiGraphic[UI_MapChoiceMapOnly][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapChoiceMap: {
+            uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(LoadCPS_RW(pFileManager->openFile("DUNERGN.CPS"),true));
+            SDL_SetColorKey(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+
+            // make black lines inside the map non-transparent
+            if(!SDL_MUSTLOCK(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN]) || (SDL_LockSurface(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN]) == 0)) {
+                for(int y = 48; y < 48+240; y++) {
+                    for(int x = 16; x < 16 + 608; x++) {
+                        if(getPixel(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN], x, y) == 0) {
+                            putPixel(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN], x, y, 12);
+                        }
+                    }
+                }
+
+                if(SDL_MUSTLOCK(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN])) {
+                    SDL_UnlockSurface(uiGraphic[UI_MapChoiceMap][HOUSE_HARKONNEN]);
+                }
+            }
+        } break;
+
+        case UI_MapChoiceClickMap: {
+            uiGraphic[UI_MapChoiceClickMap][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(LoadCPS_RW(pFileManager->openFile("RGNCLK.CPS"),true));
+        } break;
+
+        case UI_StructureSizeLattice: {
+            uiGraphic[UI_StructureSizeLattice][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("StructureSizeLattice.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_StructureSizeLattice][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_StructureSizeConcrete: {
+            uiGraphic[UI_StructureSizeConcrete][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("StructureSizeConcrete.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_StructureSizeConcrete][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_SideBar: {
+            uiGraphic[UI_MapEditor_SideBar][HOUSE_HARKONNEN] = getPictureFactory()->createSideBar(true);
+        } break;
+
+        case UI_MapEditor_BottomBar: {
+            uiGraphic[UI_MapEditor_BottomBar][HOUSE_HARKONNEN] = getPictureFactory()->createBottomBar();
+        } break;
+
+        case UI_MapEditor_ExitIcon: {
+            uiGraphic[UI_MapEditor_ExitIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorExitIcon.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_ExitIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_NewIcon: {
+            uiGraphic[UI_MapEditor_NewIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorNewIcon.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_NewIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_LoadIcon: {
+            uiGraphic[UI_MapEditor_LoadIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorLoadIcon.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_LoadIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_SaveIcon: {
+            uiGraphic[UI_MapEditor_SaveIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorSaveIcon.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_SaveIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_UndoIcon: {
+            uiGraphic[UI_MapEditor_UndoIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorUndoIcon.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_UndoIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_RedoIcon: {
+            uiGraphic[UI_MapEditor_RedoIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorRedoIcon.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_RedoIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_PlayerIcon: {
+            uiGraphic[UI_MapEditor_PlayerIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPlayerIcon.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_PlayerIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_MapSettingsIcon: {
+            uiGraphic[UI_MapEditor_MapSettingsIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMapSettingsIcon.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_MapSettingsIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_ChoamIcon: {
+            uiGraphic[UI_MapEditor_ChoamIcon][HOUSE_HARKONNEN] = scaleSurface(getSubFrame(getObjPic(ObjPic_Frigate)[0],1,0,8,1), 0.5);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_ChoamIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_ReinforcementsIcon: {
+            uiGraphic[UI_MapEditor_ReinforcementsIcon][HOUSE_HARKONNEN] = scaleSurface(getSubFrame(getObjPic(ObjPic_Carryall)[0],1,0,8,2), 0.66667);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_ReinforcementsIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_TeamsIcon: {
+            uiGraphic[UI_MapEditor_TeamsIcon][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Troopers)[0],0,0,4,4);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_TeamsIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_MirrorNoneIcon: {
+            uiGraphic[UI_MapEditor_MirrorNoneIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorNone.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorNoneIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_MirrorHorizontalIcon: {
+            uiGraphic[UI_MapEditor_MirrorHorizontalIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorHorizontal.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorHorizontalIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_MirrorVerticalIcon: {
+            uiGraphic[UI_MapEditor_MirrorVerticalIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorVertical.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorVerticalIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_MirrorBothIcon: {
+            uiGraphic[UI_MapEditor_MirrorBothIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorBoth.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorBothIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_MirrorPointIcon: {
+            uiGraphic[UI_MapEditor_MirrorPointIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMirrorPoint.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_MirrorPointIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_ArrowUp: {
+            uiGraphic[UI_MapEditor_ArrowUp][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorArrowUp.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_ArrowUp][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_ArrowDown: {
+            uiGraphic[UI_MapEditor_ArrowDown][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorArrowDown.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_ArrowDown][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_Plus: {
+            uiGraphic[UI_MapEditor_Plus][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPlus.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_Plus][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_Minus: {
+            uiGraphic[UI_MapEditor_Minus][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorMinus.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_Minus][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_RotateLeftIcon:
+        case UI_MapEditor_RotateLeftHighlightIcon: {
+            uiGraphic[UI_MapEditor_RotateLeftIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorRotateLeft.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_RotateLeftIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_MapEditor_RotateLeftHighlightIcon][HOUSE_HARKONNEN] = mapSurfaceColorRange(uiGraphic[UI_MapEditor_RotateLeftIcon][HOUSE_HARKONNEN], COLOR_HARKONNEN, COLOR_HARKONNEN-3);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_RotateLeftHighlightIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+
+            uiGraphicState[UI_MapEditor_RotateLeftIcon] = AssetState_Built;
+            uiGraphicState[UI_MapEditor_RotateLeftHighlightIcon] = AssetState_Built;
+        } break;
+
+        case UI_MapEditor_RotateRightIcon:
+        case UI_MapEditor_RotateRightHighlightIcon: {
+            uiGraphic[UI_MapEditor_RotateRightIcon][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorRotateRight.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_RotateRightIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+            uiGraphic[UI_MapEditor_RotateRightHighlightIcon][HOUSE_HARKONNEN] = mapSurfaceColorRange(uiGraphic[UI_MapEditor_RotateRightIcon][HOUSE_HARKONNEN], COLOR_HARKONNEN, COLOR_HARKONNEN-3);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_RotateRightHighlightIcon][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+
+            uiGraphicState[UI_MapEditor_RotateRightIcon] = AssetState_Built;
+            uiGraphicState[UI_MapEditor_RotateRightHighlightIcon] = AssetState_Built;
+        } break;
+
+        case UI_MapEditor_Sand: {
+            uiGraphic[UI_MapEditor_Sand][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getIcnfile()->getPicture(127),true);
+        } break;
+
+        case UI_MapEditor_Dunes: {
+            uiGraphic[UI_MapEditor_Dunes][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getIcnfile()->getPicture(159),true);
+        } break;
+
+        case UI_MapEditor_SpecialBloom: {
+            uiGraphic[UI_MapEditor_SpecialBloom][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getIcnfile()->getPicture(209),true);
+        } break;
+
+        case UI_MapEditor_Spice: {
+            uiGraphic[UI_MapEditor_Spice][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getIcnfile()->getPicture(191),true);
+        } break;
+
+        case UI_MapEditor_ThickSpice: {
+            uiGraphic[UI_MapEditor_ThickSpice][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getIcnfile()->getPicture(207),true);
+        } break;
+
+        case UI_MapEditor_SpiceBloom: {
+            uiGraphic[UI_MapEditor_SpiceBloom][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getIcnfile()->getPicture(208),true);
+        } break;
+
+        case UI_MapEditor_Slab: {
+            uiGraphic[UI_MapEditor_Slab][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getIcnfile()->getPicture(126),true);
+        } break;
+
+        case UI_MapEditor_Rock: {
+            uiGraphic[UI_MapEditor_Rock][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getIcnfile()->getPicture(143),true);
+        } break;
+
+        case UI_MapEditor_Mountain: {
+            uiGraphic[UI_MapEditor_Mountain][HOUSE_HARKONNEN] = Scaler::defaultDoubleSurface(getIcnfile()->getPicture(175),true);
+        } break;
+
+        case UI_MapEditor_Slab1: {
+            uiGraphic[UI_MapEditor_Slab1][HOUSE_HARKONNEN] = getIcnfile()->getPicture(126);
+        } break;
+
+        case UI_MapEditor_Wall: {
+            uiGraphic[UI_MapEditor_Wall][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_Wall)[0],2*D2_TILESIZE,0,D2_TILESIZE,D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_GunTurret: {
+            uiGraphic[UI_MapEditor_GunTurret][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_GunTurret)[0],2*D2_TILESIZE,0,D2_TILESIZE,D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_RocketTurret: {
+            uiGraphic[UI_MapEditor_RocketTurret][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_RocketTurret)[0],2*D2_TILESIZE,0,D2_TILESIZE,D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_ConstructionYard: {
+            uiGraphic[UI_MapEditor_ConstructionYard][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_ConstructionYard)[0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_Windtrap: {
+            uiGraphic[UI_MapEditor_Windtrap][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_Windtrap)[0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_Radar: {
+            uiGraphic[UI_MapEditor_Radar][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_Radar)[0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_Silo: {
+            uiGraphic[UI_MapEditor_Silo][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_Silo)[0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_IX: {
+            uiGraphic[UI_MapEditor_IX][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_IX)[0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_Barracks: {
+            uiGraphic[UI_MapEditor_Barracks][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_Barracks)[0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_WOR: {
+            uiGraphic[UI_MapEditor_WOR][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_WOR)[0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_LightFactory: {
+            uiGraphic[UI_MapEditor_LightFactory][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_LightFactory)[0],2*2*D2_TILESIZE,0,2*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_Refinery: {
+            uiGraphic[UI_MapEditor_Refinery][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_Refinery)[0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_HighTechFactory: {
+            uiGraphic[UI_MapEditor_HighTechFactory][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_HighTechFactory)[0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_HeavyFactory: {
+            uiGraphic[UI_MapEditor_HeavyFactory][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_HeavyFactory)[0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_RepairYard: {
+            uiGraphic[UI_MapEditor_RepairYard][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_RepairYard)[0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,2*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_Starport: {
+            uiGraphic[UI_MapEditor_Starport][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_Starport)[0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,3*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_Palace: {
+            uiGraphic[UI_MapEditor_Palace][HOUSE_HARKONNEN] = getSubPicture(getObjPic(ObjPic_Palace)[0],2*3*D2_TILESIZE,0,3*D2_TILESIZE,3*D2_TILESIZE);
+        } break;
+
+        case UI_MapEditor_Soldier: {
+            uiGraphic[UI_MapEditor_Soldier][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Soldier)[0],0,0,4,3);
+        } break;
+
+        case UI_MapEditor_Trooper: {
+            uiGraphic[UI_MapEditor_Trooper][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Trooper)[0],0,0,4,3);
+        } break;
+
+        case UI_MapEditor_Harvester: {
+            uiGraphic[UI_MapEditor_Harvester][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Harvester)[0],0,0,8,1);
+        } break;
+
+        case UI_MapEditor_Infantry: {
+            uiGraphic[UI_MapEditor_Infantry][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Infantry)[0],0,0,4,4);
+        } break;
+
+        case UI_MapEditor_Troopers: {
+            uiGraphic[UI_MapEditor_Troopers][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Troopers)[0],0,0,4,4);
+        } break;
+
+        case UI_MapEditor_MCV: {
+            uiGraphic[UI_MapEditor_MCV][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_MCV)[0],0,0,8,1);
+        } break;
+
+        case UI_MapEditor_Trike: {
+            uiGraphic[UI_MapEditor_Trike][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Trike)[0],0,0,8,1);
+        } break;
+
+        case UI_MapEditor_Raider: {
+            uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Trike)[0],0,0,8,1);
+            uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN] = combinePictures(uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN], getObjPic(ObjPic_Star)[1],
+            uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN]->w - getObjPic(ObjPic_Star)[1]->w,
+            uiGraphic[UI_MapEditor_Raider][HOUSE_HARKONNEN]->h - getObjPic(ObjPic_Star)[1]->h,
+                true, false);
+        } break;
+
+        case UI_MapEditor_Quad: {
+            uiGraphic[UI_MapEditor_Quad][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Quad)[0],0,0,8,1);
+        } break;
+
+        case UI_MapEditor_Tank: {
+            uiGraphic[UI_MapEditor_Tank][HOUSE_HARKONNEN] = combinePictures(getSubFrame(getObjPic(ObjPic_Tank_Base)[0],0,0,8,1), getSubFrame(getObjPic(ObjPic_Tank_Gun)[0],0,0,8,1), 0, 0);
+        } break;
+
+        case UI_MapEditor_SiegeTank: {
+            uiGraphic[UI_MapEditor_SiegeTank][HOUSE_HARKONNEN] = combinePictures(getSubFrame(getObjPic(ObjPic_Siegetank_Base)[0],0,0,8,1), getSubFrame(getObjPic(ObjPic_Siegetank_Gun)[0],0,0,8,1), 2, -4);
+        } break;
+
+        case UI_MapEditor_Launcher: {
+            uiGraphic[UI_MapEditor_Launcher][HOUSE_HARKONNEN] = combinePictures(getSubFrame(getObjPic(ObjPic_Tank_Base)[0],0,0,8,1), getSubFrame(getObjPic(ObjPic_Launcher_Gun)[0],0,0,8,1), 3, 0);
+        } break;
+
+        case UI_MapEditor_Devastator: {
+            uiGraphic[UI_MapEditor_Devastator][HOUSE_HARKONNEN] = combinePictures(getSubFrame(getObjPic(ObjPic_Devastator_Base)[0],0,0,8,1), getSubFrame(getObjPic(ObjPic_Devastator_Gun)[0],0,0,8,1), 2, -4);
+        } break;
+
+        case UI_MapEditor_SonicTank: {
+            uiGraphic[UI_MapEditor_SonicTank][HOUSE_HARKONNEN] = combinePictures(getSubFrame(getObjPic(ObjPic_Tank_Base)[0],0,0,8,1), getSubFrame(getObjPic(ObjPic_Sonictank_Gun)[0],0,0,8,1), 3, 1);
+        } break;
+
+        case UI_MapEditor_Deviator: {
+            uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN] = combinePictures(getSubFrame(getObjPic(ObjPic_Tank_Base)[0],0,0,8,1), getSubFrame(getObjPic(ObjPic_Launcher_Gun)[0],0,0,8,1), 3, 0);
+            uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN] = combinePictures(uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN], getObjPic(ObjPic_Star)[1],
+            uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN]->w - getObjPic(ObjPic_Star)[1]->w,
+            uiGraphic[UI_MapEditor_Deviator][HOUSE_HARKONNEN]->h - getObjPic(ObjPic_Star)[1]->h,
+                true, false);
+        } break;
+
+        case UI_MapEditor_Saboteur: {
+            uiGraphic[UI_MapEditor_Saboteur][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Saboteur)[0],0,0,4,3);
+        } break;
+
+        case UI_MapEditor_Sandworm: {
+            uiGraphic[UI_MapEditor_Sandworm][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Sandworm)[0],0,5,1,9);
+        } break;
+
+        case UI_MapEditor_SpecialUnit: {
+            uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN] = combinePictures(getSubFrame(getObjPic(ObjPic_Devastator_Base)[0],0,0,8,1), getSubFrame(getObjPic(ObjPic_Devastator_Gun)[0],0,0,8,1), 2, -4);
+            uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN] = combinePictures(uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN], getObjPic(ObjPic_Star)[1],
+            uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN]->w - getObjPic(ObjPic_Star)[1]->w,
+            uiGraphic[UI_MapEditor_SpecialUnit][HOUSE_HARKONNEN]->h - getObjPic(ObjPic_Star)[1]->h,
+                true, false);
+        } break;
+
+        case UI_MapEditor_Carryall: {
+            uiGraphic[UI_MapEditor_Carryall][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Carryall)[0],0,0,8,2);
+        } break;
+
+        case UI_MapEditor_Ornithopter: {
+            uiGraphic[UI_MapEditor_Ornithopter][HOUSE_HARKONNEN] = getSubFrame(getObjPic(ObjPic_Ornithopter)[0],0,0,8,3);
+        } break;
+
+        case UI_MapEditor_Pen1x1: {
+            uiGraphic[UI_MapEditor_Pen1x1][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPen1x1.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_Pen1x1][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_Pen3x3: {
+            uiGraphic[UI_MapEditor_Pen3x3][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPen3x3.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_Pen3x3][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        case UI_MapEditor_Pen5x5: {
+            uiGraphic[UI_MapEditor_Pen5x5][HOUSE_HARKONNEN] = SDL_LoadBMP_RW(pFileManager->openFile("MapEditorPen5x5.bmp"),true);
+            SDL_SetColorKey(uiGraphic[UI_MapEditor_Pen5x5][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+        } break;
+
+        default: {
+            fprintf(stderr,"GFXManager::buildUIGraphic(): Invalid ui graphic id %d\n",id);
+            exit(EXIT_FAILURE);
+        } break;
+    }
+
+    uiGraphicState[id] = AssetState_Built;
+}
+
+void GFXManager::publishUIGraphic(unsigned int id) {
+    if(uiGraphicState[id] == AssetState_Ready) {
+        return;
+    }
+
+    for(int j = 0; j < (int) NUM_HOUSES; j++) {
+        if(uiGraphic[id][j] != NULL) {
+            SDL_Surface* tmp;
+            tmp = uiGraphic[id][j];
+            if((uiGraphic[id][j] = SDL_DisplayFormat(tmp)) == NULL) {
+                fprintf(stderr,"GFXManager: SDL_DisplayFormat() failed!\n");
+                exit(EXIT_FAILURE);
+            }
+            SDL_FreeSurface(tmp);
+        }
+    }
+
+    uiGraphicState[id] = AssetState_Ready;
+}
+
+void GFXManager::buildSmallDetailPic(unsigned int id) {
+    switch(id) {
+        case Picture_Barracks:         smallDetailPic[Picture_Barracks] = extractSmallDetailPic("BARRAC.WSA");  break;
+        case Picture_ConstructionYard: smallDetailPic[Picture_ConstructionYard] = extractSmallDetailPic("CONSTRUC.WSA"); break;
+        case Picture_Carryall:         smallDetailPic[Picture_Carryall] = extractSmallDetailPic("CARRYALL.WSA"); break;
+        case Picture_Devastator:       smallDetailPic[Picture_Devastator] = extractSmallDetailPic("HARKTANK.WSA"); break;
+        case Picture_Deviator:         smallDetailPic[Picture_Deviator] = extractSmallDetailPic("ORDRTANK.WSA"); break;
+        case Picture_DeathHand:        smallDetailPic[Picture_DeathHand] = extractSmallDetailPic("GOLD-BB.WSA"); break;
+        case Picture_Fremen:           smallDetailPic[Picture_Fremen] = extractSmallDetailPic("FREMEN.WSA");    break;
+        case Picture_Frigate: {
+            if(pFileManager->exists("FRIGATE.WSA")) {
+                smallDetailPic[Picture_Frigate] = extractSmallDetailPic("FRIGATE.WSA");
+            } else {
+                // US-Version 1.07 does not contain FRIGATE.WSA
+                // We replace it with the starport
+                smallDetailPic[Picture_Frigate] = extractSmallDetailPic("STARPORT.WSA");
+            }
+        } break;
+        case Picture_GunTurret:        smallDetailPic[Picture_GunTurret] = extractSmallDetailPic("TURRET.WSA"); break;
+        case Picture_Harvester:        smallDetailPic[Picture_Harvester] = extractSmallDetailPic("HARVEST.WSA"); break;
+        case Picture_HeavyFactory:     smallDetailPic[Picture_HeavyFactory] = extractSmallDetailPic("HVYFTRY.WSA"); break;
+        case Picture_HighTechFactory:  smallDetailPic[Picture_HighTechFactory] = extractSmallDetailPic("HITCFTRY.WSA"); break;
+        case Picture_Soldier:          smallDetailPic[Picture_Soldier] = extractSmallDetailPic("INFANTRY.WSA"); break;
+        case Picture_IX:               smallDetailPic[Picture_IX] = extractSmallDetailPic("IX.WSA");            break;
+        case Picture_Launcher:         smallDetailPic[Picture_Launcher] = extractSmallDetailPic("RTANK.WSA");   break;
+        case Picture_LightFactory:     smallDetailPic[Picture_LightFactory] = extractSmallDetailPic("LITEFTRY.WSA"); break;
+        case Picture_MCV:              smallDetailPic[Picture_MCV] = extractSmallDetailPic("MCV.WSA");          break;
+        case Picture_Ornithopter:      smallDetailPic[Picture_Ornithopter] = extractSmallDetailPic("ORNI.WSA"); break;
+        case Picture_Palace:           smallDetailPic[Picture_Palace] = extractSmallDetailPic("PALACE.WSA");    break;
+        case Picture_Quad:             smallDetailPic[Picture_Quad] = extractSmallDetailPic("QUAD.WSA");        break;
+        case Picture_Radar:            smallDetailPic[Picture_Radar] = extractSmallDetailPic("HEADQRTS.WSA");   break;
+        case Picture_RaiderTrike:      smallDetailPic[Picture_RaiderTrike] = extractSmallDetailPic("OTRIKE.WSA"); break;
+        case Picture_Refinery:         smallDetailPic[Picture_Refinery] = extractSmallDetailPic("REFINERY.WSA"); break;
+        case Picture_RepairYard:       smallDetailPic[Picture_RepairYard] = extractSmallDetailPic("REPAIR.WSA"); break;
+        case Picture_RocketTurret:     smallDetailPic[Picture_RocketTurret] = extractSmallDetailPic("RTURRET.WSA"); break;
+        case Picture_Saboteur:         smallDetailPic[Picture_Saboteur] = extractSmallDetailPic("SABOTURE.WSA"); break;
+        case Picture_Sandworm:         smallDetailPic[Picture_Sandworm] = extractSmallDetailPic("WORM.WSA");    break;
+        case Picture_Sardaukar:        smallDetailPic[Picture_Sardaukar] = extractSmallDetailPic("SARDUKAR.WSA"); break;
+        case Picture_SiegeTank:        smallDetailPic[Picture_SiegeTank] = extractSmallDetailPic("HTANK.WSA");  break;
+        case Picture_Silo:             smallDetailPic[Picture_Silo] = extractSmallDetailPic("STORAGE.WSA");     break;
+        case Picture_Slab1:            smallDetailPic[Picture_Slab1] = extractSmallDetailPic("SLAB.WSA");       break;
+        case Picture_Slab4:            smallDetailPic[Picture_Slab4] = extractSmallDetailPic("4SLAB.WSA");      break;
+        case Picture_SonicTank:        smallDetailPic[Picture_SonicTank] = extractSmallDetailPic("STANK.WSA");  break;
+        case Picture_StarPort:         smallDetailPic[Picture_StarPort] = extractSmallDetailPic("STARPORT.WSA"); break;
+        case Picture_Tank:             smallDetailPic[Picture_Tank] = extractSmallDetailPic("LTANK.WSA");       break;
+        case Picture_Trike:            smallDetailPic[Picture_Trike] = extractSmallDetailPic("TRIKE.WSA");      break;
+        case Picture_Trooper:          smallDetailPic[Picture_Trooper] = extractSmallDetailPic("HYINFY.WSA");   break;
+        case Picture_Wall:             smallDetailPic[Picture_Wall] = extractSmallDetailPic("WALL.WSA");        break;
+        case Picture_WindTrap:         smallDetailPic[Picture_WindTrap] = extractSmallDetailPic("WINDTRAP.WSA"); break;
+        case Picture_WOR:              smallDetailPic[Picture_WOR] = extractSmallDetailPic("WOR.WSA");          break;
+        case Picture_Special:          smallDetailPic[Picture_Special] = NULL;                                  break;
+        // unused: FARTR.WSA, FHARK.WSA, FORDOS.WSA
+
+        default: {
+            fprintf(stderr,"GFXManager::buildSmallDetailPic(): Invalid small detail picture id %d\n",id);
+            exit(EXIT_FAILURE);
+        } break;
+    }
+
+    smallDetailPicState[id] = AssetState_Built;
+}
+
+void GFXManager::publishSmallDetailPic(unsigned int id) {
+    if(smallDetailPicState[id] == AssetState_Ready) {
+        return;
+    }
+
+    if(smallDetailPic[id] != NULL) {
+        SDL_Surface* tmp;
+        tmp = smallDetailPic[id];
+        if((smallDetailPic[id] = SDL_DisplayFormat(tmp)) == NULL) {
+            fprintf(stderr,"GFXManager: SDL_DisplayFormat() failed!\n");
+            exit(EXIT_FAILURE);
+        }
+        SDL_FreeSurface(tmp);
+    }
+
+    smallDetailPicState[id] = AssetState_Ready;
+}
+
+void GFXManager::loadMapChoiceGraphics() {
+    if(bMapChoiceGraphicsLoaded) {
+        return;
+    }
+
+    MutexLock lock(assetMutex);
+
+	// load map choice pieces
+	shared_ptr<Shpfile> pieces = getShpfile("PIECES.SHP");
+	for(int i = 0; i < NUM_MAPCHOICEPIECES; i++) {
+		mapChoicePieces[i][HOUSE_HARKONNEN] = Scaler::doubleSurfaceNN(pieces->getPicture(i));
+		SDL_SetColorKey(mapChoicePieces[i][HOUSE_HARKONNEN], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+	}
+
+	// load map choice arrows
+	shared_ptr<Shpfile> arrows = getShpfile("ARROWS.SHP");
+	for(int i = 0; i < NUM_MAPCHOICEARROWS; i++) {
+		mapChoiceArrows[i] = Scaler::defaultDoubleSurface(arrows->getPicture(i),true);
+		SDL_SetColorKey(mapChoiceArrows[i], SDL_SRCCOLORKEY | SDL_RLEACCEL, 0);
+	}
+
+	bMapChoiceGraphicsLoaded = true;
+}
+
+int GFXManager::prewarmThreadMain(void* data) {
+    GFXManager* pGFXManager = (GFXManager*) data;
+
+    // Every picture is decoded with its own lock so that the main thread never waits long for a picture it needs.
+    // The map editor icons are skipped because they need pictures in the display format.
+    const int numMenuUIGraphics = sizeof(menuUIGraphics)/sizeof(menuUIGraphics[0]);
+    const int numGameUIGraphics = sizeof(gameUIGraphics)/sizeof(gameUIGraphics[0]);
+    const int numItems = numMenuUIGraphics + NUM_OBJPICS + numGameUIGraphics + NUM_SMALLDETAILPICS;
+
+    try {
+        for(int i = 0; i < numItems; i++) {
+            MutexLock lock(pGFXManager->assetMutex);
+
+            if(pGFXManager->bStopPrewarming) {
+                break;
+            }
+
+            int item = i;
+            if(item < numMenuUIGraphics) {
+                unsigned int id = menuUIGraphics[item];
+                if(pGFXManager->uiGraphicState[id] == AssetState_NotLoaded) {
+                    pGFXManager->buildUIGraphic(id);
+                }
+                continue;
+            }
+            item -= numMenuUIGraphics;
+
+            if(item < NUM_OBJPICS) {
+                if(pGFXManager->objPicState[item] == AssetState_NotLoaded) {
+                    pGFXManager->buildObjPic(item);
+                }
+                continue;
+            }
+            item -= NUM_OBJPICS;
+
+            if(item < numGameUIGraphics) {
+                unsigned int id = gameUIGraphics[item];
+                if(pGFXManager->uiGraphicState[id] == AssetState_NotLoaded) {
+                    pGFXManager->buildUIGraphic(id);
+                }
+                continue;
+            }
+            item -= numGameUIGraphics;
+
+            if(pGFXManager->smallDetailPicState[item] == AssetState_NotLoaded) {
+                pGFXManager->buildSmallDetailPic(item);
+            }
+        }
+    } catch (std::exception& e) {
+        // the main thread will get the same error when it needs this picture
+        fprintf(stderr, "GFXManager::prewarmThreadMain(): %s\n", e.what());
+    }
+
+    return 0;
+}
+
 Animation* GFXManager::getAnimation(unsigned int id) {
 	if(id >= NUM_ANIMATION) {
 		fprintf(stderr,"GFXManager::getAnimation(): Animation with id %d is not available!\n",id);
@@ -1089,7 +1941,95 @@ Animation* GFXManager::getAnimation(unsigned int id) {
 	}
 
 	if(animation[id] == NULL) {
+        // the shp files are shared with the prewarm thread
+        MutexLock lock(assetMutex);
+
         switch(id) {
+            case Anim_HarkonnenEyes: {
+                animation[Anim_HarkonnenEyes] = getShpfile("MENSHPH.SHP")->getAnimation(0,4,true,true);
+                animation[Anim_HarkonnenEyes]->setFrameRate(0.3);
+            } break;
+
+            case Anim_HarkonnenMouth: {
+                animation[Anim_HarkonnenMouth] = getShpfile("MENSHPH.SHP")->getAnimation(5,9,true,true,true);
+                animation[Anim_HarkonnenMouth]->setFrameRate(5.0);
+            } break;
+
+            case Anim_HarkonnenShoulder: {
+                animation[Anim_HarkonnenShoulder] = getShpfile("MENSHPH.SHP")->getAnimation(10,10,true,true);
+                animation[Anim_HarkonnenShoulder]->setFrameRate(1.0);
+            } break;
+
+            case Anim_AtreidesEyes: {
+                animation[Anim_AtreidesEyes] = getShpfile("MENSHPA.SHP")->getAnimation(0,4,true,true);
+                animation[Anim_AtreidesEyes]->setFrameRate(0.5);
+            } break;
+
+            case Anim_AtreidesMouth: {
+                animation[Anim_AtreidesMouth] = getShpfile("MENSHPA.SHP")->getAnimation(5,9,true,true,true);
+                animation[Anim_AtreidesMouth]->setFrameRate(5.0);
+            } break;
+
+            case Anim_AtreidesShoulder: {
+                animation[Anim_AtreidesShoulder] = getShpfile("MENSHPA.SHP")->getAnimation(10,10,true,true);
+                animation[Anim_AtreidesShoulder]->setFrameRate(1.0);
+            } break;
+
+            case Anim_AtreidesBook: {
+                animation[Anim_AtreidesBook] = getShpfile("MENSHPA.SHP")->getAnimation(11,12,true,true,true);
+                animation[Anim_AtreidesBook]->setNumLoops(1);
+                animation[Anim_AtreidesBook]->setFrameRate(0.2);
+            } break;
+
+            case Anim_OrdosEyes: {
+                animation[Anim_OrdosEyes] = getShpfile("MENSHPO.SHP")->getAnimation(0,4,true,true);
+                animation[Anim_OrdosEyes]->setFrameRate(0.5);
+            } break;
+
+            case Anim_OrdosMouth: {
+                animation[Anim_OrdosMouth] = getShpfile("MENSHPO.SHP")->getAnimation(5,9,true,true,true);
+                animation[Anim_OrdosMouth]->setFrameRate(5.0);
+            } break;
+
+            case Anim_OrdosShoulder: {
+                animation[Anim_OrdosShoulder] = getShpfile("MENSHPO.SHP")->getAnimation(10,10,true,true);
+                animation[Anim_OrdosShoulder]->setFrameRate(1.0);
+            } break;
+
+            case Anim_OrdosRing: {
+                animation[Anim_OrdosRing] = getShpfile("MENSHPO.SHP")->getAnimation(11,14,true,true,true);
+                animation[Anim_OrdosRing]->setNumLoops(1);
+                animation[Anim_OrdosRing]->setFrameRate(6.0);
+            } break;
+
+            case Anim_FremenEyes:       animation[Anim_FremenEyes] = PictureFactory::mapMentatAnimationToFremen(getAnimation(Anim_AtreidesEyes));                 break;
+            case Anim_FremenMouth:      animation[Anim_FremenMouth] = PictureFactory::mapMentatAnimationToFremen(getAnimation(Anim_AtreidesMouth));               break;
+            case Anim_FremenShoulder:   animation[Anim_FremenShoulder] = PictureFactory::mapMentatAnimationToFremen(getAnimation(Anim_AtreidesShoulder));         break;
+            case Anim_FremenBook:       animation[Anim_FremenBook] = PictureFactory::mapMentatAnimationToFremen(getAnimation(Anim_AtreidesBook));                 break;
+            case Anim_SardaukarEyes:    animation[Anim_SardaukarEyes] = PictureFactory::mapMentatAnimationToSardaukar(getAnimation(Anim_HarkonnenEyes));          break;
+            case Anim_SardaukarMouth:   animation[Anim_SardaukarMouth] = PictureFactory::mapMentatAnimationToSardaukar(getAnimation(Anim_HarkonnenMouth));        break;
+            case Anim_SardaukarShoulder: animation[Anim_SardaukarShoulder] = PictureFactory::mapMentatAnimationToSardaukar(getAnimation(Anim_HarkonnenShoulder)); break;
+            case Anim_MercenaryEyes:    animation[Anim_MercenaryEyes] = PictureFactory::mapMentatAnimationToMercenary(getAnimation(Anim_OrdosEyes));              break;
+            case Anim_MercenaryMouth:   animation[Anim_MercenaryMouth] = PictureFactory::mapMentatAnimationToMercenary(getAnimation(Anim_OrdosMouth));            break;
+            case Anim_MercenaryShoulder: animation[Anim_MercenaryShoulder] = PictureFactory::mapMentatAnimationToMercenary(getAnimation(Anim_OrdosShoulder));    break;
+            case Anim_MercenaryRing:    animation[Anim_MercenaryRing] = PictureFactory::mapMentatAnimationToMercenary(getAnimation(Anim_OrdosRing));              break;
+
+            case Anim_BeneEyes: {
+                animation[Anim_BeneEyes] = getShpfile("MENSHPM.SHP")->getAnimation(0,4,true,true);
+                if(animation[Anim_BeneEyes] != NULL) {
+                    animation[Anim_BeneEyes]->setPalette(benePalette);
+                    animation[Anim_BeneEyes]->setFrameRate(0.5);
+                }
+            } break;
+
+            case Anim_BeneMouth: {
+                animation[Anim_BeneMouth] = getShpfile("MENSHPM.SHP")->getAnimation(5,9,true,true,true);
+                if(animation[Anim_BeneMouth] != NULL) {
+                    animation[Anim_BeneMouth]->setPalette(benePalette);
+                    animation[Anim_BeneMouth]->setFrameRate(5.0);
+                }
+            } break;
+
             case Anim_HarkonnenPlanet: {
                 animation[Anim_HarkonnenPlanet] = loadAnimationFromWsa("FHARK.WSA");
                 animation[Anim_HarkonnenPlanet]->setFrameRate(10);
@@ -1106,17 +2046,17 @@ Animation* GFXManager::getAnimation(unsigned int id) {
             } break;
 
             case Anim_FremenPlanet: {
-                animation[Anim_FremenPlanet] = PictureFactory::createFremenPlanet(uiGraphic[UI_Herald_ColoredLarge][HOUSE_FREMEN]);
+                animation[Anim_FremenPlanet] = PictureFactory::createFremenPlanet(getUIGraphic(UI_Herald_ColoredLarge, HOUSE_FREMEN));
                 animation[Anim_FremenPlanet]->setFrameRate(10);
             } break;
 
             case Anim_SardaukarPlanet: {
-                animation[Anim_SardaukarPlanet] = PictureFactory::createSardaukarPlanet(getAnimation(Anim_OrdosPlanet), uiGraphic[UI_Herald_ColoredLarge][HOUSE_SARDAUKAR]);
+                animation[Anim_SardaukarPlanet] = PictureFactory::createSardaukarPlanet(getAnimation(Anim_OrdosPlanet), getUIGraphic(UI_Herald_ColoredLarge, HOUSE_SARDAUKAR));
                 animation[Anim_SardaukarPlanet]->setFrameRate(10);
             } break;
 
             case Anim_MercenaryPlanet: {
-                animation[Anim_MercenaryPlanet] = PictureFactory::createMercenaryPlanet(getAnimation(Anim_AtreidesPlanet), uiGraphic[UI_Herald_ColoredLarge][HOUSE_MERCENARY]);
+                animation[Anim_MercenaryPlanet] = PictureFactory::createMercenaryPlanet(getAnimation(Anim_AtreidesPlanet), getUIGraphic(UI_Herald_ColoredLarge, HOUSE_MERCENARY));
                 animation[Anim_MercenaryPlanet]->setFrameRate(10);
             } break;
 
@@ -1211,6 +2151,49 @@ shared_ptr<Wsafile> GFXManager::loadWsafile(std::string filename) {
 	}
 }
 
+shared_ptr<Shpfile> GFXManager::getShpfile(std::string filename) {
+    std::map<std::string, shared_ptr<Shpfile> >::const_iterator iter = shpfiles.find(filename);
+    if(iter != shpfiles.end()) {
+        return iter->second;
+    }
+
+    shared_ptr<Shpfile> shpfile = loadShpfile(filename);
+    shpfiles[filename] = shpfile;
+    return shpfile;
+}
+
+shared_ptr<Shpfile> GFXManager::getChoamShpfile() {
+    if(pFileManager->exists("CHOAM." + languageFileExtension)) {
+        return getShpfile("CHOAM." + languageFileExtension);
+    } else if(pFileManager->exists("CHOAMSHP.SHP")) {
+        return getShpfile("CHOAMSHP.SHP");
+    } else {
+        throw std::runtime_error("GFXManager::getChoamShpfile(): Cannot open CHOAMSHP.SHP or CHOAM."+languageFileExtension+"!");
+    }
+}
+
+shared_ptr<Shpfile> GFXManager::getMentatShpfile() {
+    if(pFileManager->exists("MENTAT." + languageFileExtension)) {
+        return getShpfile("MENTAT." + languageFileExtension);
+    } else {
+        return getShpfile("MENTAT.SHP");
+    }
+}
+
+shared_ptr<Icnfile> GFXManager::getIcnfile() {
+    if(icnfile.get() == NULL) {
+        icnfile = shared_ptr<Icnfile>(new Icnfile(pFileManager->openFile("ICON.ICN"),pFileManager->openFile("ICON.MAP"), true));
+    }
+    return icnfile;
+}
+
+shared_ptr<PictureFactory> GFXManager::getPictureFactory() {
+    if(pictureFactory.get() == NULL) {
+        pictureFactory = shared_ptr<PictureFactory>(new PictureFactory());
+    }
+    return pictureFactory;
+}
+
 SDL_Surface* GFXManager::extractSmallDetailPic(std::string filename) {
 	SDL_RWops* myFile;
 	if((myFile = pFileManager->openFile(filename.c_str())) == NULL) {
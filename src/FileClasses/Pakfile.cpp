@@ -23,6 +23,14 @@
 #include <SDL.h>
 #include <stdexcept>
 
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 
 ///	Constructor for Pakfile
 /**
@@ -35,6 +43,9 @@
 Pakfile::Pakfile(std::string pakfilename, bool write)
 {
 	this->write = write;
+	fileMutex = NULL;
+	pMappedData = NULL;
+	mappedSize = 0;
 	writeOutData = NULL;
 	numWriteOutData = 0;
 
@@ -53,6 +64,13 @@ Pakfile::Pakfile(std::string pakfilename, bool write)
             throw;
         }
 
+        if((fileMutex = SDL_CreateMutex()) == NULL) {
+            SDL_RWclose(fPakFile);
+            throw std::runtime_error("Pakfile::Pakfile(): Cannot create mutex for " + pakfilename + "!");
+        }
+
+        mapFile();
+
 	} else {
 		// Open for writing
 		if( (fPakFile = SDL_RWFromFile(filename.c_str(), "wb")) == NULL) {
@@ -97,6 +115,16 @@ Pakfile::~Pakfile()
 		SDL_RWclose(fPakFile);
 	}
 
+	if(fileMutex != NULL) {
+		SDL_DestroyMutex(fileMutex);
+	}
+
+#ifndef _WIN32
+	if(pMappedData != NULL) {
+		munmap((void*) pMappedData, mappedSize);
+	}
+#endif
+
 	if(writeOutData != NULL) {
 		free(writeOutData);
 		writeOutData = NULL;
@@ -197,6 +225,27 @@ SDL_RWops* Pakfile::openFile(std::string filename) {
 		return NULL;
 	}
 
+	return openFile((unsigned int) index);
+}
+
+/// Opens a file in this PAK-File.
+/**
+	This method opens the file specified by index. If the PAK-File is mapped into memory the returned SDL_RWops-structure is
+	a read-only view of the mapped data; otherwise it reads from the PAK-File. If the Pakfile is opened for writing or index is
+	not valid this method returns NULL.<br>
+	NOTICE: The returned SDL_RWops-Structure is only valid as long as this Pakfile-Object exists.
+	\param	index	Index in pak-File
+	\return	SDL_RWops for this file
+*/
+SDL_RWops* Pakfile::openFile(unsigned int index) {
+	if((write == true) || (index >= fileEntries.size())) {
+		return NULL;
+	}
+
+	if(pMappedData != NULL) {
+		return SDL_RWFromConstMem(pMappedData + fileEntries[index].startOffset, fileEntries[index].endOffset + 1 - fileEntries[index].startOffset);
+	}
+
 	// alloc RWop
 	SDL_RWops *pRWop;
 	if((pRWop = SDL_AllocRW()) == NULL) {
@@ -269,14 +318,21 @@ int Pakfile::ReadFile(SDL_RWops* pRWop, void *ptr, int size, int n) {
 		}
 	}
 
+	// seeking and reading must not be interrupted by another thread reading from the same PAK-File
+	SDL_LockMutex(pPakfile->fileMutex);
+
 	if(SDL_RWseek(pPakfile->fPakFile,readstartoffset,SEEK_SET) < 0) {
+		SDL_UnlockMutex(pPakfile->fileMutex);
 		return -1;
 	}
 
 	if(SDL_RWread(pPakfile->fPakFile,ptr,bytes2read,1) != 1) {
+		SDL_UnlockMutex(pPakfile->fileMutex);
 		return -1;
 	}
 
+	SDL_UnlockMutex(pPakfile->fileMutex);
+
 	pRWopData->fileOffset += bytes2read;
 	return bytes2read/size;
 }
@@ -389,3 +445,35 @@ void Pakfile::readIndex()
 
 	fileEntries.back().endOffset = filesize - 1;
 }
+
+/// Maps the PAK-File into memory
+/**
+	Maps the whole PAK-File read-only into memory. If this is not possible (or not supported on this system) the files are
+	read with SDL_RWread.
+*/
+void Pakfile::mapFile() {
+#ifndef _WIN32
+	if(fileEntries.empty()) {
+		return;
+	}
+
+	int fd = open(filename.c_str(), O_RDONLY);
+	if(fd < 0) {
+		return;
+	}
+
+	struct stat fileStat;
+	if((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0)) {
+		// the index was read with the size at this time
+		if((uint32_t) fileStat.st_size > fileEntries.back().endOffset) {
+			void* pData = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(pData != MAP_FAILED) {
+				pMappedData = (const char*) pData;
+				mappedSize = fileStat.st_size;
+			}
+		}
+	}
+
+	close(fd);
+#endif
+}
@@ -0,0 +1,303 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <FileClasses/SpriteCache.h>
+
+#include <SDL_endian.h>
+#include <SDL_rwops.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+// no mmap; the file is read completely
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// the size of one entry in the index of the cache file
+#define SPRITECACHE_INDEXENTRYSIZE  16
+
+static Uint16 readLE16(const Uint8* p) {
+    return (Uint16) (p[0] | (p[1] << 8));
+}
+
+static Uint32 readLE32(const Uint8* p) {
+    return ((Uint32) p[0]) | (((Uint32) p[1]) << 8) | (((Uint32) p[2]) << 16) | (((Uint32) p[3]) << 24);
+}
+
+static bool writeLE16(SDL_RWops* file, Uint16 value) {
+    value = SDL_SwapLE16(value);
+    return (SDL_RWwrite(file, &value, sizeof(value), 1) == 1);
+}
+
+static bool writeLE32(SDL_RWops* file, Uint32 value) {
+    value = SDL_SwapLE32(value);
+    return (SDL_RWwrite(file, &value, sizeof(value), 1) == 1);
+}
+
+SpriteCache::SpriteCache(const std::string& filename, const std::string& key)
+ : filename(filename), key(key), bModified(false), pFileData(NULL), fileSize(0), bFileMapped(false) {
+
+#ifdef _WIN32
+    SDL_RWops* file = SDL_RWFromFile(filename.c_str(), "rb");
+    if(file != NULL) {
+        int size = SDL_RWseek(file, 0, SEEK_END);
+        if(size > 0) {
+            fileBuffer.resize(size);
+            SDL_RWseek(file, 0, SEEK_SET);
+            if(SDL_RWread(file, &fileBuffer[0], size, 1) == 1) {
+                pFileData = &fileBuffer[0];
+                fileSize = size;
+            } else {
+                fileBuffer.clear();
+            }
+        }
+        SDL_RWclose(file);
+    }
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if(fd >= 0) {
+        struct stat fileStat;
+        if((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0)) {
+            void* pMapped = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(pMapped != MAP_FAILED) {
+                pFileData = (const Uint8*) pMapped;
+                fileSize = fileStat.st_size;
+                bFileMapped = true;
+            }
+        }
+        close(fd);
+    }
+#endif
+
+    if((pFileData != NULL) && (readIndex() == false)) {
+        fprintf(stderr, "SpriteCache: %s is outdated and will be rebuilt\n", filename.c_str());
+        entries.clear();
+        closeFile();
+    }
+}
+
+SpriteCache::~SpriteCache() {
+    save();
+    closeFile();
+}
+
+bool SpriteCache::contains(Uint32 id) const {
+    return (entries.find(id) != entries.end());
+}
+
+SDL_Surface* SpriteCache::getSurface(Uint32 id) const {
+    std::map<Uint32, Entry>::const_iterator iter = entries.find(id);
+    if((iter == entries.end()) || (iter->second.h == 0)) {
+        return NULL;
+    }
+
+    const Entry& entry = iter->second;
+
+    SDL_Surface* pSurface = SDL_CreateRGBSurface(SDL_HWSURFACE, entry.w, entry.h, 8, 0, 0, 0, 0);
+    if(pSurface == NULL) {
+        return NULL;
+    }
+
+    SDL_Color colors[256];
+    for(int i = 0; i < entry.numColors; i++) {
+        colors[i].r = entry.pData[4*i];
+        colors[i].g = entry.pData[4*i+1];
+        colors[i].b = entry.pData[4*i+2];
+        colors[i].unused = 0;
+    }
+    SDL_SetColors(pSurface, colors, 0, entry.numColors);
+
+    if(SDL_LockSurface(pSurface) != 0) {
+        SDL_FreeSurface(pSurface);
+        return NULL;
+    }
+
+    const Uint8* pPixels = entry.pData + 4*entry.numColors;
+    for(int y = 0; y < entry.h; y++) {
+        memcpy((Uint8*) pSurface->pixels + y*pSurface->pitch, pPixels + y*entry.w, entry.w);
+    }
+
+    SDL_UnlockSurface(pSurface);
+
+    return pSurface;
+}
+
+void SpriteCache::addSurface(Uint32 id, SDL_Surface* pSurface) {
+    Entry entry;
+    entry.w = 0;
+    entry.h = 0;
+    entry.numColors = 0;
+    entry.pData = NULL;
+
+    if(pSurface != NULL) {
+        if((pSurface->format->BitsPerPixel != 8) || (pSurface->format->palette == NULL)
+            || (pSurface->w > 0xFFFF) || (pSurface->h > 0xFFFF) || (SDL_LockSurface(pSurface) != 0)) {
+            return;
+        }
+
+        entry.w = pSurface->w;
+        entry.h = pSurface->h;
+        entry.numColors = pSurface->format->palette->ncolors;
+
+        newData.push_back(std::vector<Uint8>(4*entry.numColors + entry.w*entry.h));
+        Uint8* pData = &newData.back()[0];
+
+        for(int i = 0; i < entry.numColors; i++) {
+            pData[4*i] = pSurface->format->palette->colors[i].r;
+            pData[4*i+1] = pSurface->format->palette->colors[i].g;
+            pData[4*i+2] = pSurface->format->palette->colors[i].b;
+            pData[4*i+3] = 0;
+        }
+
+        Uint8* pPixels = pData + 4*entry.numColors;
+        for(int y = 0; y < entry.h; y++) {
+            memcpy(pPixels + y*entry.w, (Uint8*) pSurface->pixels + y*pSurface->pitch, entry.w);
+        }
+
+        SDL_UnlockSurface(pSurface);
+
+        entry.pData = pData;
+    }
+
+    entries[id] = entry;
+    bModified = true;
+}
+
+void SpriteCache::save() {
+    if(bModified == false) {
+        return;
+    }
+
+    // the old file may still be mapped, so the new one is written next to it and renamed afterwards
+    std::string tmpFilename = filename + ".tmp";
+    SDL_RWops* file = SDL_RWFromFile(tmpFilename.c_str(), "wb");
+    if(file == NULL) {
+        fprintf(stderr, "SpriteCache::save(): Cannot open %s!\n", tmpFilename.c_str());
+        return;
+    }
+
+    bool bError = false;
+
+    bError |= (SDL_RWwrite(file, "DLSC", 4, 1) != 1);
+    bError |= !writeLE32(file, SPRITECACHEVERSION);
+    bError |= !writeLE32(file, key.length());
+    bError |= (SDL_RWwrite(file, key.c_str(), key.length(), 1) != 1);
+    bError |= !writeLE32(file, entries.size());
+
+    Uint32 offset = 4 + 4 + 4 + key.length() + 4 + entries.size()*SPRITECACHE_INDEXENTRYSIZE;
+
+    std::map<Uint32, Entry>::const_iterator iter;
+    for(iter = entries.begin(); iter != entries.end(); ++iter) {
+        bError |= !writeLE32(file, iter->first);
+        bError |= !writeLE16(file, iter->second.w);
+        bError |= !writeLE16(file, iter->second.h);
+        bError |= !writeLE16(file, iter->second.numColors);
+        bError |= !writeLE16(file, 0);
+        bError |= !writeLE32(file, offset);
+
+        offset += 4*iter->second.numColors + iter->second.w*iter->second.h;
+    }
+
+    for(iter = entries.begin(); iter != entries.end(); ++iter) {
+        int dataSize = 4*iter->second.numColors + iter->second.w*iter->second.h;
+        if(dataSize > 0) {
+            bError |= (SDL_RWwrite(file, iter->second.pData, dataSize, 1) != 1);
+        }
+    }
+
+    SDL_RWclose(file);
+
+    if(bError) {
+        fprintf(stderr, "SpriteCache::save(): Cannot write %s!\n", tmpFilename.c_str());
+        remove(tmpFilename.c_str());
+        return;
+    }
+
+    // rename() does not replace an existing file on every system
+    remove(filename.c_str());
+    if(rename(tmpFilename.c_str(), filename.c_str()) != 0) {
+        fprintf(stderr, "SpriteCache::save(): Cannot rename %s to %s!\n", tmpFilename.c_str(), filename.c_str());
+        remove(tmpFilename.c_str());
+        return;
+    }
+
+    bModified = false;
+}
+
+bool SpriteCache::readIndex() {
+    const Uint8* pEnd = pFileData + fileSize;
+    const Uint8* p = pFileData;
+
+    if((fileSize < 16) || (memcmp(p, "DLSC", 4) != 0) || (readLE32(p+4) != SPRITECACHEVERSION)) {
+        return false;
+    }
+    p += 8;
+
+    Uint32 keyLength = readLE32(p);
+    p += 4;
+    if((keyLength != key.length()) || ((size_t) (pEnd - p) < keyLength + 4) || (memcmp(p, key.c_str(), keyLength) != 0)) {
+        return false;
+    }
+    p += keyLength;
+
+    Uint32 numEntries = readLE32(p);
+    p += 4;
+    if((size_t) (pEnd - p) / SPRITECACHE_INDEXENTRYSIZE < numEntries) {
+        return false;
+    }
+
+    for(Uint32 i = 0; i < numEntries; i++, p += SPRITECACHE_INDEXENTRYSIZE) {
+        Entry entry;
+        entry.w = readLE16(p+4);
+        entry.h = readLE16(p+6);
+        entry.numColors = readLE16(p+8);
+
+        Uint32 offset = readLE32(p+12);
+        size_t dataSize = 4*entry.numColors + entry.w*entry.h;
+        if((entry.numColors > 256) || (offset > fileSize) || (fileSize - offset < dataSize)) {
+            return false;
+        }
+
+        entry.pData = pFileData + offset;
+        entries[readLE32(p)] = entry;
+    }
+
+    return true;
+}
+
+void SpriteCache::closeFile() {
+    if(pFileData == NULL) {
+        return;
+    }
+
+#ifndef _WIN32
+    if(bFileMapped) {
+        munmap((void*) pFileData, fileSize);
+    }
+#endif
+
+    fileBuffer.clear();
+    pFileData = NULL;
+    fileSize = 0;
+    bFileMapped = false;
+}
@@ -2284,6 +2284,11 @@ SoundAdlibPC::SoundAdlibPC(SDL_RWops* rwop, bool bMAME) : _driver(0), _trackEntr
 
 	bJustStartedPlaying = false;
 
+	driverMutex = SDL_CreateMutex();
+	synthesisThread = NULL;
+	bStopSynthesis = false;
+	pRingBuffer = NULL;
+
 	internalLoadFile(rwop);
 }
 
@@ -2305,10 +2310,21 @@ SoundAdlibPC::SoundAdlibPC(SDL_RWops* rwop, int freq, bool bMAME) : _driver(0),
 
 	bJustStartedPlaying = false;
 
+	driverMutex = SDL_CreateMutex();
+	synthesisThread = NULL;
+	bStopSynthesis = false;
+	pRingBuffer = NULL;
+
 	internalLoadFile(rwop);
 }
 
 SoundAdlibPC::~SoundAdlibPC() {
+	stopSynthesisThread();
+
+	if(driverMutex != NULL) {
+		SDL_DestroyMutex(driverMutex);
+	}
+
 	delete _driver;
 	delete[] _soundDataPtr;
 }
@@ -2346,116 +2362,219 @@ void SoundAdlibPC::process() {
 	}
 }
 
+// The public methods lock driverMutex as they might be called while the synthesis thread
+// is using _driver. SDL mutexes are recursive, so they may call each other.
+
 void SoundAdlibPC::playTrack(uint8 track) {
+	SDL_LockMutex(driverMutex);
 	_driver->setSyncJumpMask(0);
 	play(track);
+	SDL_UnlockMutex(driverMutex);
 }
 
 void SoundAdlibPC::haltTrack() {
+	SDL_LockMutex(driverMutex);
 	unk1();
 	unk2();
 
 	bJustStartedPlaying = false;
+	SDL_UnlockMutex(driverMutex);
 }
 
 bool SoundAdlibPC::isPlaying() {
-	return (bJustStartedPlaying == true) || (_driver->callback(7, int(0)) != 0);
+	SDL_LockMutex(driverMutex);
+	bool bPlaying = (bJustStartedPlaying == true) || (_driver->callback(7, int(0)) != 0);
+	SDL_UnlockMutex(driverMutex);
+
+	// the synthesis thread is ahead of playback, so the end of the song might still be in the ring buffer
+	if((bPlaying == false) && (pRingBuffer != NULL)) {
+		bPlaying = (pRingBuffer->getReadAvailable() > 0);
+	}
+
+	return bPlaying;
 }
 
 void SoundAdlibPC::playSoundEffect(uint8 track) {
+	SDL_LockMutex(driverMutex);
 	play(track);
+	SDL_UnlockMutex(driverMutex);
 }
 
-#define CONV_VOLUME(x) (x*self->volume/MIX_MAX_VOLUME)
+bool SoundAdlibPC::startSynthesisThread() {
+	if((synthesisThread != NULL) || (driverMutex == NULL)) {
+		return (synthesisThread != NULL);
+	}
 
-void SoundAdlibPC::callback(void *userdata, Uint8 *audiobuf, int len)
-{
-	SoundAdlibPC *self = (SoundAdlibPC *)userdata;
+	pRingBuffer = new RingBuffer<Sint16>(ADLIB_RINGBUFFERSIZE);
+	bStopSynthesis = false;
 
-	self->process();
+	synthesisThread = SDL_CreateThread(synthesisThreadMain, (void*) this);
+	if(synthesisThread == NULL) {
+		warning("SoundAdlibPC::startSynthesisThread(): Unable to create thread; the music is synthesized in the audio callback");
+		delete pRingBuffer;
+		pRingBuffer = NULL;
+		return false;
+	}
 
-	int numSamples = len / (self->getsampsize());
+	return true;
+}
 
-	int16* tmpBuf = (int16*) calloc(numSamples,sizeof(int16));
-	if(tmpBuf == NULL) {
-		warning("Not enough memory!");
+void SoundAdlibPC::stopSynthesisThread() {
+	if(synthesisThread == NULL) {
 		return;
 	}
 
-	// write mono 16-bit signed samples (in system endianess)
-	self->_driver->readBuffer((int16*) tmpBuf, numSamples);
+	bStopSynthesis = true;
+	SDL_WaitThread(synthesisThread, NULL);
+	synthesisThread = NULL;
 
-	// now convert to target format
-	switch(self->m_format) {
-		case AUDIO_U8: {
-			Uint8* out = audiobuf;
+	delete pRingBuffer;
+	pRingBuffer = NULL;
+}
 
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = ((CONV_VOLUME(tmpBuf[i])/2) >> 8) + 0x80;
-				}
-			}
-		} break;
+int SoundAdlibPC::synthesisThreadMain(void* data) {
+	SoundAdlibPC *self = (SoundAdlibPC *)data;
 
-		case AUDIO_S8: {
-			Sint8* out = (Sint8*) audiobuf;
+	while(self->bStopSynthesis == false) {
+		if(self->pRingBuffer->getWriteAvailable() < ADLIB_CHUNKSIZE) {
+			// the buffer is full; wait until the audio callback has consumed some samples
+			SDL_Delay(5);
+			continue;
+		}
 
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = ((CONV_VOLUME(tmpBuf[i])/2) >> 8);
-				}
-			}
-		} break;
+		SDL_LockMutex(self->driverMutex);
+		bool bFinished = (self->bJustStartedPlaying == false) && (self->_driver->callback(7, int(0)) == 0);
+		if(bFinished == false) {
+			self->process();
+			self->_driver->readBuffer(self->synthesisBuffer, ADLIB_CHUNKSIZE);
+			self->bJustStartedPlaying = false;
+		}
+		SDL_UnlockMutex(self->driverMutex);
 
-		case AUDIO_U16LSB: {
-			Uint16* out = (Uint16*) audiobuf;
+		if(bFinished) {
+			// let the ring buffer run empty so that isPlaying() can tell when the end of the song was played
+			SDL_Delay(5);
+			continue;
+		}
 
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = SDL_SwapLE16((CONV_VOLUME(tmpBuf[i])/2) + 0x8000);
-				}
-			}
-		} break;
+		self->pRingBuffer->write(self->synthesisBuffer, ADLIB_CHUNKSIZE);
+	}
 
-		case AUDIO_S16LSB: {
-			Sint16* out = (Sint16*) audiobuf;
+	return 0;
+}
 
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = SDL_SwapLE16(CONV_VOLUME(tmpBuf[i])/2);
-				}
-			}
-		} break;
+void SoundAdlibPC::callback(void *userdata, Uint8 *audiobuf, int len)
+{
+	SoundAdlibPC *self = (SoundAdlibPC *)userdata;
 
-		case AUDIO_U16MSB: {
-			Uint16* out = (Uint16*) audiobuf;
+	int sampleSize = self->getsampsize();
+	int numSamples = len / sampleSize;
 
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = SDL_SwapBE16((CONV_VOLUME(tmpBuf[i])/2) + 0x8000);
-				}
-			}
-		} break;
-
-		case AUDIO_S16MSB: {
-			Sint16* out = (Sint16*) audiobuf;
+	// work in chunks so that no memory has to be allocated
+	while(numSamples > 0) {
+		int numChunkSamples = std::min(numSamples, ADLIB_CHUNKSIZE);
 
-			for(int i=0;i<numSamples;i++) {
-				for(int j=0;j<self->m_channels;j++,out++) {
-					*out = SDL_SwapBE16(CONV_VOLUME(tmpBuf[i])/2);
-				}
+		if(self->pRingBuffer != NULL) {
+			int numRead = self->pRingBuffer->read(self->callbackBuffer, numChunkSamples);
+			if(numRead < numChunkSamples) {
+				// buffer underrun; play silence instead of waiting for the synthesis thread
+				memset(self->callbackBuffer + numRead, 0, (numChunkSamples - numRead)*sizeof(int16));
 			}
-		} break;
+		} else {
+			self->process();
 
-		default: {
+			// write mono 16-bit signed samples (in system endianess)
+			self->_driver->readBuffer(self->callbackBuffer, numChunkSamples);
+			self->bJustStartedPlaying = false;
+		}
+
+		if(self->convertSamples(self->callbackBuffer, numChunkSamples, audiobuf) == false) {
 			warning("Unsupported audio format");
 			return;
 		}
+
+		audiobuf += numChunkSamples*sampleSize;
+		numSamples -= numChunkSamples;
+	}
+}
+
+/*
+ * The converters apply the volume and change a mono 16-bit signed sample (in system endianess)
+ * into one sample of the output format.
+ */
+struct ConvertToU8 {
+	typedef Uint8 OutType;
+	static inline Uint8 convert(int16 sample, int volume) { return ((sample*volume/MIX_MAX_VOLUME/2) >> 8) + 0x80; }
+};
+
+struct ConvertToS8 {
+	typedef Sint8 OutType;
+	static inline Sint8 convert(int16 sample, int volume) { return ((sample*volume/MIX_MAX_VOLUME/2) >> 8); }
+};
+
+struct ConvertToU16LSB {
+	typedef Uint16 OutType;
+	static inline Uint16 convert(int16 sample, int volume) { return SDL_SwapLE16((sample*volume/MIX_MAX_VOLUME/2) + 0x8000); }
+};
+
+struct ConvertToS16LSB {
+	typedef Sint16 OutType;
+	static inline Sint16 convert(int16 sample, int volume) { return SDL_SwapLE16(sample*volume/MIX_MAX_VOLUME/2); }
+};
+
+struct ConvertToU16MSB {
+	typedef Uint16 OutType;
+	static inline Uint16 convert(int16 sample, int volume) { return SDL_SwapBE16((sample*volume/MIX_MAX_VOLUME/2) + 0x8000); }
+};
+
+struct ConvertToS16MSB {
+	typedef Sint16 OutType;
+	static inline Sint16 convert(int16 sample, int volume) { return SDL_SwapBE16(sample*volume/MIX_MAX_VOLUME/2); }
+};
+
+/*
+ * Converts numSamples mono samples and copies them into every channel. Mono and stereo
+ * get loops without an inner channel loop so that the compiler can vectorize them.
+ */
+template<class Converter>
+static void convertChunk(const int16* pSamples, int numSamples, typename Converter::OutType* out, int channels, int volume) {
+	typedef typename Converter::OutType OutType;
+
+	if(channels == 1) {
+		for(int i=0;i<numSamples;i++) {
+			out[i] = Converter::convert(pSamples[i], volume);
+		}
+	} else if(channels == 2) {
+		for(int i=0;i<numSamples;i++) {
+			OutType sample = Converter::convert(pSamples[i], volume);
+			out[2*i] = sample;
+			out[2*i+1] = sample;
+		}
+	} else {
+		for(int i=0;i<numSamples;i++) {
+			OutType sample = Converter::convert(pSamples[i], volume);
+			for(int j=0;j<channels;j++,out++) {
+				*out = sample;
+			}
+		}
 	}
+}
+
+bool SoundAdlibPC::convertSamples(const Sint16* pSamples, int numSamples, Uint8* pOutput) {
+	// the volume might be changed by another thread while converting
+	int currentVolume = volume;
 
-	free(tmpBuf);
+	switch(m_format) {
+		case AUDIO_U8:		convertChunk<ConvertToU8>(pSamples, numSamples, (Uint8*) pOutput, m_channels, currentVolume);		break;
+		case AUDIO_S8:		convertChunk<ConvertToS8>(pSamples, numSamples, (Sint8*) pOutput, m_channels, currentVolume);		break;
+		case AUDIO_U16LSB:	convertChunk<ConvertToU16LSB>(pSamples, numSamples, (Uint16*) pOutput, m_channels, currentVolume);	break;
+		case AUDIO_S16LSB:	convertChunk<ConvertToS16LSB>(pSamples, numSamples, (Sint16*) pOutput, m_channels, currentVolume);	break;
+		case AUDIO_U16MSB:	convertChunk<ConvertToU16MSB>(pSamples, numSamples, (Uint16*) pOutput, m_channels, currentVolume);	break;
+		case AUDIO_S16MSB:	convertChunk<ConvertToS16MSB>(pSamples, numSamples, (Sint16*) pOutput, m_channels, currentVolume);	break;
+		default:			return false;
+	}
 
-	self->bJustStartedPlaying = false;
+	return true;
 }
 
 void SoundAdlibPC::play(uint8 track) {
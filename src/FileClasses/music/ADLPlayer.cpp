@@ -201,6 +201,9 @@ void ADLPlayer::changeMusic(MUSICTYPE musicType)
 
             pSoundAdlibPC->playTrack(musicNum);
 
+            // synthesize the music ahead of playback; if this fails it is synthesized inside the audio callback
+            pSoundAdlibPC->startSynthesisThread();
+
             Mix_HookMusic(pSoundAdlibPC->callback, pSoundAdlibPC);
 
             //printf("Now playing %s!\n",filename.c_str());
@@ -29,6 +29,8 @@
 #include <misc/IFileStream.h>
 #include <misc/OFileStream.h>
 #include <misc/IMemoryStream.h>
+#include <misc/OMemoryStream.h>
+#include <misc/PerformanceTimer.h>
 #include <misc/FileSystem.h>
 #include <misc/fnkdat.h>
 #include <misc/draw_util.h>
@@ -63,9 +65,11 @@
 
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 #include <SDL.h>
 
-Game::Game() {
+Game::Game()
+ : thinkWorkerPool(std::min(WorkerPool::getNumCPUs(), (int) NUM_HOUSES) - 1) {
     currentZoomlevel = settings.video.preferredZoomLevel;
 
 	whatNextParam = GAME_NOTHING;
@@ -135,6 +139,7 @@ Game::Game() {
 
 	gameCycleCount = 0;
 	skipToGameCycle = 0;
+	replaySeekCycle = 0;
 
 	averageFrameTime = 31.25f;
 	debug = false;
@@ -162,6 +167,9 @@ Game::~Game() {
         pNetworkManager->setOnReceiveCommandList(std::function<void (const std::string&, const CommandList&)>());
         pNetworkManager->setOnReceiveSelectionList(std::function<void (std::string, std::set<Uint32>, int)>());
         pNetworkManager->setOnPeerDisconnected(std::function<void (std::string, bool, int)>());
+        pNetworkManager->setOnReceiveSyncCheck(std::function<void (const std::string&, Uint32, Uint32)>());
+        pNetworkManager->setOnReceiveSyncRequest(std::function<void (const std::string&, Uint32, Sint32)>());
+        pNetworkManager->setOnReceiveSyncResponse(std::function<void (const std::string&, Uint32, Sint32, const std::vector<Uint32>&)>());
 	}
 
     delete pInGameMenu;
@@ -173,22 +181,22 @@ Game::~Game() {
     delete pWaitingForOtherPlayers;
     pWaitingForOtherPlayers = NULL;
 
-    for(RobustList<StructureBase*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+    for(DenseList<StructureBase*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
         delete *iter;
     }
     structureList.clear();
 
-    for(RobustList<UnitBase*>::const_iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
+    for(DenseList<UnitBase*>::const_iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
         delete *iter;
     }
     unitList.clear();
 
-	for(RobustList<Bullet*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
+	for(DenseList<Bullet*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
 	    delete *iter;
 	}
 	bulletList.clear();
 
-    for(RobustList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
+    for(DenseList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
 	    delete *iter;
 	}
 	explosionList.clear();
@@ -258,44 +266,104 @@ void Game::initGame(const GameInitSettings& newGameInitSettings) {
         default: {
         } break;
     }
+
+    applyGameOptions();
+}
+
+void Game::applyGameOptions() {
     screenborder->setScrollSpeed(settings.gameOptions.scrollSpeed);
     soundPlayer->setSfxVolume(settings.gameOptions.volume);
     musicPlayer->setMusicVolume(settings.gameOptions.volume);
 }
 
-void Game::initReplay(const std::string& filename) {
-    bReplay = true;
+void Game::initReplay(const std::string& filename, Uint32 startCycle) {
+	IFileStream* pStream = new IFileStream();
 
-	IFileStream fs;
-
-	if(fs.open(filename) == false) {
+	if(pStream->open(filename) == false) {
 		perror("Game::loadSaveGame()");
 		exit(EXIT_FAILURE);
 	}
 
 	// read GameInitInfo
-	GameInitSettings loadedGameInitSettings(fs);
+	GameInitSettings loadedGameInitSettings(*pStream);
+
+	cmdManager.readKeyframeIndex(*pStream);
+
+	std::string keyframe;
+	if((startCycle != 0) && cmdManager.loadKeyframe(*pStream, startCycle, keyframe)) {
+        // a keyframe is a savegame; the commands already scheduled at this point are only stored in the keyframe so they
+        // have to be loaded with it (bReplay is not set yet)
+        if((loadedGameInitSettings.getGameType() == GAMETYPE_CUSTOM_MULTIPLAYER) || (loadedGameInitSettings.getGameType() == GAMETYPE_LOAD_MULTIPLAYER)) {
+            // the local player is not stored in a network savegame
+            gameInitSettings = GameInitSettings(filename, keyframe, loadedGameInitSettings.getServername());
+            GameInitSettings::HouseInfoList::const_iterator iter;
+            for(iter = loadedGameInitSettings.getHouseInfoList().begin(); iter != loadedGameInitSettings.getHouseInfoList().end(); ++iter) {
+                gameInitSettings.addHouseInfo(*iter);
+            }
+        }
+
+        IMemoryStream memStream(keyframe.data(), keyframe.size());
+        if(loadSaveGame(memStream) == false) {
+            throw std::runtime_error("Loading replay keyframe failed!");
+        }
 
-	// load all commands
-	cmdManager.load(fs);
+        applyGameOptions();
 
-	initGame(loadedGameInitSettings);
+        bReplay = true;
+	} else {
+        bReplay = true;
+
+        initGame(loadedGameInitSettings);
+	}
 
-	// fs is closed by its destructor
+	// the commands are read while the replay is played; the stream is closed by the command manager
+	cmdManager.setReplayStream(pStream);
+
+	skipToGameCycle = startCycle;
 }
 
 
+void Game::thinkPlayers() {
+    std::vector<Player*> thinkingPlayers;
+    for(int i = 0; i < NUM_HOUSES; i++) {
+        if(house[i] != NULL) {
+            const std::list<std::shared_ptr<Player> >& players = house[i]->getPlayerList();
+            std::list<std::shared_ptr<Player> >::const_iterator iter;
+            for(iter = players.begin(); iter != players.end(); ++iter) {
+                if((*iter)->wantsToThink()) {
+                    thinkingPlayers.push_back(iter->get());
+                }
+            }
+        }
+    }
+
+    if(thinkingPlayers.empty()) {
+        return;
+    }
+
+    // the players only read the game state while thinking, so they can all think at the same time
+    Player::freezeObjectLists();
+    currentGameMap->getBuildSiteGrid().update();
+
+    std::vector<std::function<void ()> > tasks;
+    for(size_t i = 0; i < thinkingPlayers.size(); i++) {
+        tasks.push_back(std::bind(&Player::think, thinkingPlayers[i]));
+    }
+    thinkWorkerPool.run(tasks);
+
+    // the actions change the game state and thus must be executed in the same order on all peers
+    for(size_t i = 0; i < thinkingPlayers.size(); i++) {
+        thinkingPlayers[i]->executeDeferredActions();
+    }
+}
+
 void Game::processObjects()
 {
-	// update all tiles
-    for(int y = 0; y < currentGameMap->getSizeY(); y++) {
-		for(int x = 0; x < currentGameMap->getSizeX(); x++) {
-            currentGameMap->getTile(x,y)->update();
-		}
-	}
+	// update all tiles with tracks or dead units
+	currentGameMap->updateTiles();
 
 
-    for(RobustList<StructureBase*>::iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+    for(DenseList<StructureBase*>::iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
         StructureBase* tempStructure = *iter;
         tempStructure->update();
     }
@@ -304,18 +372,24 @@ void Game::processObjects()
 		currentCursorMode = CursorMode_Normal;
 	}
 
-	for(RobustList<UnitBase*>::iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
+	for(DenseList<UnitBase*>::iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
 		UnitBase* tempUnit = *iter;
 		tempUnit->update();
 	}
 
-    for(RobustList<Bullet*>::iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
+    for(DenseList<Bullet*>::iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
         (*iter)->update();
 	}
 
-    for(RobustList<Explosion*>::iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
+    for(DenseList<Explosion*>::iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
         (*iter)->update();
 	}
+
+    // free the slots of all objects removed in this cycle
+    structureList.compact();
+    unitList.compact();
+    bulletList.compact();
+    explosionList.compact();
 }
 
 
@@ -333,125 +407,60 @@ void Game::drawScreen()
     BottomRightTile.x = std::min(currentGameMap->getSizeX()-1, BottomRightTile.x + 1);
     BottomRightTile.y = std::min(currentGameMap->getSizeY()-1, BottomRightTile.y + 1);
 
-    Coord currentTile;
+    // collect everything visible in one pass over the visible tiles
+    renderList.clear();
 
-    /* draw ground */
+    Coord currentTile;
 	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
 		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->tileExists(currentTile))	{
-				Tile* pTile = currentGameMap->getTile(currentTile);
-				pTile->blitGround( screenborder->world2screenX(currentTile.x*TILESIZE),
-                                  screenborder->world2screenY(currentTile.y*TILESIZE));
-			}
+            Tile* pTile = currentGameMap->getTile(currentTile);
+            pTile->addToRenderList( renderList,
+                                    screenborder->world2screenX(currentTile.x*TILESIZE),
+                                    screenborder->world2screenY(currentTile.y*TILESIZE));
 		}
 	}
 
-    /* draw structures */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
+    /* draw ground */
+    renderList.draw(RenderList::RenderLayer_Ground);
 
-			if (currentGameMap->tileExists(currentTile))	{
-				Tile* pTile = currentGameMap->getTile(currentTile);
-				pTile->blitStructures( screenborder->world2screenX(currentTile.x*TILESIZE),
-                                      screenborder->world2screenY(currentTile.y*TILESIZE));
-			}
-		}
-	}
+    /* draw structures */
+    renderList.draw(RenderList::RenderLayer_Structures);
 
     /* draw underground units */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->tileExists(currentTile))	{
-				Tile* pTile = currentGameMap->getTile(currentTile);
-				pTile->blitUndergroundUnits( screenborder->world2screenX(currentTile.x*TILESIZE),
-                                            screenborder->world2screenY(currentTile.y*TILESIZE));
-			}
-		}
-	}
+    renderList.draw(RenderList::RenderLayer_UndergroundUnits);
 
     /* draw dead objects */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->tileExists(currentTile))	{
-				Tile* pTile = currentGameMap->getTile(currentTile);
-				pTile->blitDeadUnits( screenborder->world2screenX(currentTile.x*TILESIZE),
-                                     screenborder->world2screenY(currentTile.y*TILESIZE));
-			}
-		}
-	}
+    renderList.draw(RenderList::RenderLayer_DeadUnits);
 
     /* draw infantry */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->tileExists(currentTile))	{
-				Tile* pTile = currentGameMap->getTile(currentTile);
-				pTile->blitInfantry( screenborder->world2screenX(currentTile.x*TILESIZE),
-                                    screenborder->world2screenY(currentTile.y*TILESIZE));
-			}
-		}
-	}
+    renderList.draw(RenderList::RenderLayer_Infantry);
 
     /* draw non-infantry ground units */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->tileExists(currentTile))	{
-				Tile* pTile = currentGameMap->getTile(currentTile);
-				pTile->blitNonInfantryGroundUnits( screenborder->world2screenX(currentTile.x*TILESIZE),
-                                                  screenborder->world2screenY(currentTile.y*TILESIZE));
-			}
-		}
-	}
+    renderList.draw(RenderList::RenderLayer_NonInfantryGroundUnits);
 
 	/* draw bullets */
-    for(RobustList<Bullet*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
+    for(DenseList<Bullet*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
         Bullet* pBullet = *iter;
         pBullet->blitToScreen();
 	}
 
 
 	/* draw explosions */
-	for(RobustList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
+	for(DenseList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
         (*iter)->blitToScreen();
 	}
 
     /* draw air units */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->tileExists(currentTile))	{
-				Tile* pTile = currentGameMap->getTile(currentTile);
-				pTile->blitAirUnits(   screenborder->world2screenX(currentTile.x*TILESIZE),
-                                      screenborder->world2screenY(currentTile.y*TILESIZE));
-			}
-		}
-	}
+    renderList.draw(RenderList::RenderLayer_AirUnits);
 
     /* draw selection rectangles */
-	for(currentTile.y = TopLeftTile.y; currentTile.y <= BottomRightTile.y; currentTile.y++) {
-		for(currentTile.x = TopLeftTile.x; currentTile.x <= BottomRightTile.x; currentTile.x++) {
-
-			if (currentGameMap->tileExists(currentTile))	{
-				Tile* pTile = currentGameMap->getTile(currentTile);
-
-				if(debug || pTile->isExplored(pLocalHouse->getHouseID())) {
-					pTile->blitSelectionRects(   screenborder->world2screenX(currentTile.x*TILESIZE),
-                                                screenborder->world2screenY(currentTile.y*TILESIZE));
-				}
-			}
-		}
-	}
+    renderList.draw(RenderList::RenderLayer_SelectionRects);
 
 
 //////////////////////////////draw unexplored/shade
 
 	if(debug == false) {
-        SDL_Surface** hiddenFogSurf = pGFXManager->getObjPic(ObjPic_Terrain_HiddenFog);
-        SDL_LockSurface(hiddenFogSurf[currentZoomlevel]);
+        const Uint8* fogColorMap = pGFXManager->getTransparent40ColorMap();
 
 	    int zoomedTileSize = world2zoomedWorld(TILESIZE);
 		for(int x = screenborder->getTopLeftTile().x - 1; x <= screenborder->getBottomRightTile().x + 1; x++) {
@@ -480,25 +489,9 @@ void Game::drawScreen()
                             }
 
                             if(fogTile != 0) {
-                                SDL_Rect source = { fogTile*zoomedTileSize, 0,
-                                                    zoomedTileSize, zoomedTileSize };
-                                SDL_Rect drawLocation = {   screenborder->world2screenX(x*TILESIZE), screenborder->world2screenY(y*TILESIZE),
-                                                            zoomedTileSize, zoomedTileSize };
-
-                                SDL_Rect mini = {0, 0, 1, 1};
-                                SDL_Rect drawLoc = {drawLocation.x, drawLocation.y, 0, 0};
-
-                                SDL_Surface* fogSurf = pGFXManager->getTransparent40Surface();
-
-                                for(int i=0;i<zoomedTileSize; i++) {
-                                    for(int j=0;j<zoomedTileSize; j++) {
-                                        if(getPixel(hiddenFogSurf[currentZoomlevel],source.x+i,source.y+j) == 12) {
-                                            drawLoc.x = drawLocation.x + i;
-                                            drawLoc.y = drawLocation.y + j;
-                                            SDL_BlitSurface(fogSurf,&mini,screen,&drawLoc);
-                                        }
-                                    }
-                                }
+                                // darken the fogged part of this tile
+                                mapColorMasked( screen, screenborder->world2screenX(x*TILESIZE), screenborder->world2screenY(y*TILESIZE),
+                                                pGFXManager->getFogMask(fogTile, currentZoomlevel), fogColorMap);
                             }
 						}
 					} else {
@@ -520,7 +513,6 @@ void Game::drawScreen()
 				}
 			}
 		}
-		SDL_UnlockSurface(hiddenFogSurf[currentZoomlevel]);
 	}
 
 /////////////draw placement position
@@ -1126,7 +1118,7 @@ void Game::setupView()
 	//setup start location/view
 	i = j = count = 0;
 
-    RobustList<UnitBase*>::const_iterator unitIterator;
+    DenseList<UnitBase*>::const_iterator unitIterator;
 	for(unitIterator = unitList.begin(); unitIterator != unitList.end(); ++unitIterator) {
 		UnitBase* pUnit = *unitIterator;
 		if(pUnit->getOwner() == pLocalHouse) {
@@ -1136,7 +1128,7 @@ void Game::setupView()
 		}
 	}
 
-    RobustList<StructureBase*>::const_iterator structureIterator;
+    DenseList<StructureBase*>::const_iterator structureIterator;
 	for(structureIterator = structureList.begin(); structureIterator != structureList.end(); ++structureIterator) {
 		StructureBase* pStructure = *structureIterator;
 		if(pStructure->getOwner() == pLocalHouse) {
@@ -1216,6 +1208,9 @@ void Game::runMainLoop() {
         pNetworkManager->setOnReceiveCommandList(std::bind(&CommandManager::addCommandList, &cmdManager, std::placeholders::_1, std::placeholders::_2));
         pNetworkManager->setOnReceiveSelectionList(std::bind(&Game::onReceiveSelectionList, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
         pNetworkManager->setOnPeerDisconnected(std::bind(&Game::onPeerDisconnected, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+        pNetworkManager->setOnReceiveSyncCheck(std::bind(&SyncManager::onReceiveSyncCheck, &syncManager, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+        pNetworkManager->setOnReceiveSyncRequest(std::bind(&SyncManager::onReceiveSyncRequest, &syncManager, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+        pNetworkManager->setOnReceiveSyncResponse(std::bind(&SyncManager::onReceiveSyncResponse, &syncManager, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
 
         cmdManager.setNetworkCycleBuffer( MILLI2CYCLES(pNetworkManager->getMaxPeerRoundTripTime()) + 5 );
 	}
@@ -1332,6 +1327,19 @@ void Game::runMainLoop() {
 
             if(!bWaitForNetwork && !bPause)	{
                 pInterface->getRadarView().update();
+
+                if((bReplay == false) && (gameCycleCount != 0) && (gameCycleCount % REPLAYKEYFRAMEINTERVAL == 0)) {
+                    // store the game state for starting the replay at this cycle
+                    OMemoryStream keyframe;
+                    keyframe.open();
+                    saveGame(keyframe);
+                    cmdManager.addKeyframe(gameCycleCount, std::string(keyframe.getData(), keyframe.getDataLength()));
+                }
+
+                if(pNetworkManager != NULL) {
+                    syncManager.update(gameCycleCount);
+                }
+
                 cmdManager.executeCommands(gameCycleCount);
 
 #ifdef TEST_SYNC
@@ -1341,6 +1349,8 @@ void Game::runMainLoop() {
                 }
 #endif
 
+                thinkPlayers();
+
                 for (int i = 0; i < NUM_HOUSES; i++) {
                     if (house[i] != NULL) {
                         house[i]->update();
@@ -1383,6 +1393,10 @@ void Game::runMainLoop() {
 
 	// Game is finished
 
+	if(bReplay == false) {
+        cmdManager.writeKeyframeIndex();
+	}
+
 	if(bReplay == false && currentGame->won == true) {
         // save replay
 		char tmp[FILENAME_MAX];
@@ -1391,11 +1405,34 @@ void Game::runMainLoop() {
 		fnkdat(std::string("replay/" + mapnameBase + ".rpl").c_str(), tmp, FILENAME_MAX, FNKDAT_USER | FNKDAT_CREAT);
 		std::string replayname(tmp);
 
-		OFileStream* pStream = new OFileStream();
-		pStream->open(replayname);
-		gameInitSettings.save(*pStream);
-		cmdManager.save(*pStream);
-        delete pStream;
+		// the command manager does not keep the executed commands => copy the replay that was written while playing
+		OutputStream* pReplayStream = cmdManager.getStream();
+		if(pReplayStream != NULL) {
+            pReplayStream->flush();
+
+            char autoReplayName[FILENAME_MAX];
+            fnkdat("replay/auto.rpl", autoReplayName, FILENAME_MAX, FNKDAT_USER | FNKDAT_CREAT);
+
+            SDL_RWops* pSrc = SDL_RWFromFile(autoReplayName, "rb");
+            SDL_RWops* pDest = SDL_RWFromFile(replayname.c_str(), "wb");
+            if((pSrc != NULL) && (pDest != NULL)) {
+                char buffer[4096];
+                int length;
+                while((length = SDL_RWread(pSrc, buffer, 1, sizeof(buffer))) > 0) {
+                    SDL_RWwrite(pDest, buffer, 1, length);
+                }
+            } else {
+                fprintf(stderr, "Game::runMainLoop(): Cannot copy replay to '%s'!\n", replayname.c_str());
+            }
+
+            if(pSrc != NULL) {
+                SDL_RWclose(pSrc);
+            }
+
+            if(pDest != NULL) {
+                SDL_RWclose(pDest);
+            }
+		}
 	}
 
 	if(pNetworkManager != NULL) {
@@ -1408,6 +1445,130 @@ void Game::runMainLoop() {
 }
 
 
+std::string Game::runBenchmark(Uint32 maxCycles) {
+	printf("Starting benchmark...\n");
+	fflush(stdout);
+
+    // some game objects expect an interface to exist
+	if(pInterface == NULL) {
+        pInterface = new GameInterface();
+	}
+
+    gameState = BEGUN;
+    finishedLevel = false;
+
+	// Check if a player has lost
+	for(int j = 0; j < NUM_HOUSES; j++) {
+		if(house[j] != NULL) {
+			if(!house[j]->isAlive()) {
+				house[j]->lose(true);
+			}
+		}
+	}
+
+	cmdManager.setReadOnly(true);
+
+
+    Uint64 commandTime = 0;
+    Uint64 houseTime = 0;
+    Uint64 triggerTime = 0;
+    Uint64 objectTime = 0;
+
+    const Uint32 startCycle = gameCycleCount;
+    const Uint64 startTime = getMicroseconds();
+
+    while(!bQuitGame && !finished && ((maxCycles != 0) ? (gameCycleCount < maxCycles) : cmdManager.hasCommandsFrom(gameCycleCount))) {
+        Uint64 phaseStart = getMicroseconds();
+        cmdManager.executeCommands(gameCycleCount);
+        Uint64 phaseEnd = getMicroseconds();
+        commandTime += phaseEnd - phaseStart;
+
+        phaseStart = phaseEnd;
+        thinkPlayers();
+        for (int i = 0; i < NUM_HOUSES; i++) {
+            if (house[i] != NULL) {
+                house[i]->update();
+            }
+        }
+        phaseEnd = getMicroseconds();
+        houseTime += phaseEnd - phaseStart;
+
+        phaseStart = phaseEnd;
+        triggerManager.trigger(gameCycleCount);
+        phaseEnd = getMicroseconds();
+        triggerTime += phaseEnd - phaseStart;
+
+        phaseStart = phaseEnd;
+        processObjects();
+        phaseEnd = getMicroseconds();
+        objectTime += phaseEnd - phaseStart;
+
+        gameCycleCount++;
+    }
+
+    const Uint64 totalTime = std::max(getMicroseconds() - startTime, (Uint64) 1);
+    const Uint32 numCycles = gameCycleCount - startCycle;
+
+    std::string stateHash = getGameStateHash();
+
+    printf("Benchmark finished after %d game cycles (%s)\n", numCycles, finished ? (won ? "game won" : "game lost") : "end of replay");
+    printf("  total:           %10.1f ms   %10.1f cycles/s\n", totalTime / 1000.0, numCycles * 1000000.0 / totalTime);
+    printf("  commands:        %10.1f ms   %5.1f %%\n", commandTime / 1000.0, commandTime * 100.0 / totalTime);
+    printf("  houses:          %10.1f ms   %5.1f %%\n", houseTime / 1000.0, houseTime * 100.0 / totalTime);
+    printf("  triggers:        %10.1f ms   %5.1f %%\n", triggerTime / 1000.0, triggerTime * 100.0 / totalTime);
+    printf("  objects:         %10.1f ms   %5.1f %%\n", objectTime / 1000.0, objectTime * 100.0 / totalTime);
+    printf("  state hash:      %s\n", stateHash.c_str());
+	fflush(stdout);
+
+    gameState = DEINITIALIZE;
+
+    return stateHash;
+}
+
+
+std::string Game::getGameStateHash() const {
+    OMemoryStream memStream;
+    memStream.open();
+
+	memStream.writeUint32(gameCycleCount);
+	memStream.writeUint32(randomGen.getSeed());
+
+	for(int i=0; i<NUM_HOUSES; i++) {
+		memStream.writeBool(house[i] != NULL);
+
+		if(house[i] != NULL) {
+			house[i]->save(memStream);
+		}
+	}
+
+	currentGameMap->save(memStream);
+
+	objectManager.save(memStream);
+
+	memStream.writeUint32(bulletList.size());
+	for(DenseList<Bullet*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
+		(*iter)->save(memStream);
+	}
+
+	memStream.writeUint32(explosionList.size());
+	for(DenseList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
+		(*iter)->save(memStream);
+	}
+
+	triggerManager.save(memStream);
+
+	unsigned char md5sum[16];
+	md5((const unsigned char*) memStream.getData(), memStream.getDataLength(), md5sum);
+
+    std::stringstream stream;
+    stream << std::setfill('0') << std::hex;
+    for(int i=0;i<16;i++) {
+        stream << std::setw(2) << (int) md5sum[i];
+    }
+    return stream.str();
+}
+
+
 void Game::resumeGame()
 {
 	bMenu = false;
@@ -1695,7 +1856,10 @@ bool Game::loadSaveGame(InputStream& stream) {
     triggerManager.load(stream);
 
     // CommandManager is at the very end of the file. DO NOT CHANGE THIS!
-	cmdManager.load(stream);
+    if(bReplay == false) {
+        // a replay already contains these commands
+        cmdManager.load(stream);
+    }
 
 	finished = false;
 
@@ -1713,6 +1877,16 @@ bool Game::saveGame(std::string filename)
 		return false;
 	}
 
+	bool ret = saveGame(fs);
+
+	fs.close();
+
+	return ret;
+}
+
+bool Game::saveGame(OutputStream& fs)
+{
+
 	fs.writeUint32(SAVEMAGIC);
 
 	fs.writeUint32(SAVEGAMEVERSION);
@@ -1769,12 +1943,12 @@ bool Game::saveGame(std::string filename)
 	objectManager.save(fs);
 
 	fs.writeUint32(bulletList.size());
-	for(RobustList<Bullet*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
+	for(DenseList<Bullet*>::const_iterator iter = bulletList.begin(); iter != bulletList.end(); ++iter) {
 		(*iter)->save(fs);
 	}
 
 	fs.writeUint32(explosionList.size());
-	for(RobustList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
+	for(DenseList<Explosion*>::const_iterator iter = explosionList.begin(); iter != explosionList.end(); ++iter) {
 		(*iter)->save(fs);
 	}
 
@@ -1794,8 +1968,6 @@ bool Game::saveGame(std::string filename)
     // CommandManager is at the very end of the file. DO NOT CHANGE THIS!
 	cmdManager.save(fs);
 
-	fs.close();
-
 	return true;
 }
 
@@ -2202,7 +2374,7 @@ void Game::handleKeyInput(SDL_KeyboardEvent& keyboardEvent) {
         case SDLK_F4: {
             // skip a 10 seconds
             if(gameType != GAMETYPE_CUSTOM_MULTIPLAYER || bReplay) {
-                skipToGameCycle = gameCycleCount + (10*1000)/GAMESPEED_DEFAULT;
+                skipToCycle(gameCycleCount + (10*1000)/GAMESPEED_DEFAULT);
                 skipped = 10;
             }
         } break;
@@ -2210,7 +2382,7 @@ void Game::handleKeyInput(SDL_KeyboardEvent& keyboardEvent) {
         case SDLK_F5: {
             // skip a 30 seconds
             if(gameType != GAMETYPE_CUSTOM_MULTIPLAYER || bReplay) {
-                skipToGameCycle = gameCycleCount + (30*1000)/GAMESPEED_DEFAULT;
+                skipToCycle(gameCycleCount + (30*1000)/GAMESPEED_DEFAULT);
                 skipped = 30;
             }
         } break;
@@ -2218,7 +2390,7 @@ void Game::handleKeyInput(SDL_KeyboardEvent& keyboardEvent) {
         case SDLK_F6: {
             // skip 2 minutes
             if(gameType != GAMETYPE_CUSTOM_MULTIPLAYER || bReplay) {
-                skipToGameCycle = gameCycleCount + (120*1000)/GAMESPEED_DEFAULT;
+                skipToCycle(gameCycleCount + (120*1000)/GAMESPEED_DEFAULT);
                 skipped = 120;
             }
         } break;
@@ -2354,7 +2526,7 @@ void Game::handleKeyInput(SDL_KeyboardEvent& keyboardEvent) {
         } break;
 
         case SDLK_x: {
-		RobustList<StructureBase*>::const_iterator structureIterator;
+		DenseList<StructureBase*>::const_iterator structureIterator;
 		for(structureIterator = structureList.begin(); structureIterator != structureList.end(); ++structureIterator) {
 			StructureBase* pStructure = *structureIterator;
 			if(pStructure->getOwner() == pLocalHouse)
@@ -2395,6 +2567,17 @@ void Game::handleKeyInput(SDL_KeyboardEvent& keyboardEvent) {
 }
 
 
+void Game::skipToCycle(Uint32 cycle) {
+    if(bReplay && (cmdManager.getKeyframeCycle(cycle) > gameCycleCount)) {
+        // restarting from the keyframe is faster than simulating all cycles until there
+        replaySeekCycle = cycle;
+        quitGame();
+    } else {
+        skipToGameCycle = cycle;
+    }
+}
+
+
 bool Game::handlePlacementClick(int xPos, int yPos) {
     BuilderBase* pBuilder = NULL;
 
@@ -2467,7 +2650,7 @@ bool Game::handlePlacementClick(int xPos, int yPos) {
                                 pUnit->handleMoveClick(newDestination.x, newDestination.y);
                             }
                         } else if(pTile->hasInfantry()) {
-                            std::list<Uint32>::const_iterator iter;
+                            Tile::InfantryList::const_iterator iter;
                             for(iter = pTile->getInfantryList().begin(); iter != pTile->getInfantryList().end(); ++iter) {
                                 InfantryBase* pInfantry = dynamic_cast<InfantryBase*>(getObjectManager().getObject(*iter));
                                 if((pInfantry != NULL) && (pInfantry->getOwner() == pBuilder->getOwner())) {
@@ -2605,7 +2788,7 @@ void Game::selectNextStructureOfType(const std::set<Uint32>& itemIDs) {
 
     StructureBase* pStructure2Select = NULL;
 
-    for(RobustList<StructureBase*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+    for(DenseList<StructureBase*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
         StructureBase* pStructure = *iter;
 
         if(bSelectNext) {
@@ -2622,7 +2805,7 @@ void Game::selectNextStructureOfType(const std::set<Uint32>& itemIDs) {
 
     if(pStructure2Select == NULL) {
         // start over at the beginning
-        for(RobustList<StructureBase*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+        for(DenseList<StructureBase*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
             StructureBase* pStructure = *iter;
             if( (itemIDs.count(pStructure->getItemID()) == 1) && (pStructure->getOwner() == pLocalHouse) && !pStructure->isSelected() ) {
                 pStructure2Select = pStructure;
@@ -270,7 +270,7 @@ void House::printStat() const {
 
 
 void House::updateBuildLists() {
-    RobustList<StructureBase*>::const_iterator iter;
+    DenseList<StructureBase*>::const_iterator iter;
     for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
 		StructureBase* tempStructure = *iter;
         if(tempStructure->isABuilder() && (tempStructure->getOwner() == this)) {
@@ -646,7 +646,7 @@ StructureBase* House::placeStructure(Uint32 builderID, int itemID, int xPos, int
 
                 if(itemID == Structure_Palace) {
                     // cancel all other palaces
-                    for(RobustList<StructureBase*>::iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+                    for(DenseList<StructureBase*>::iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
                         if((*iter)->getOwner() == this && (*iter)->getItemID() == Structure_ConstructionYard) {
                             ConstructionYard* pConstructionYard = (ConstructionYard*) *iter;
 
@@ -740,7 +740,7 @@ Coord House::getCenterOfMainBase() const {
     Coord center;
     int numStructures = 0;
 
-    RobustList<StructureBase*>::const_iterator iter;
+    DenseList<StructureBase*>::const_iterator iter;
     for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
         StructureBase* tempStructure = *iter;
 
@@ -764,7 +764,7 @@ Coord House::getStrongestUnitPosition() const {
     Coord position = Coord::Invalid();
     Sint32 highestCost = 0;
 
-    RobustList<UnitBase*>::const_iterator iter;
+    DenseList<UnitBase*>::const_iterator iter;
     for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
         UnitBase* tempUnit = *iter;
 
@@ -795,7 +795,7 @@ void House::decrementHarvesters() {
             float	closestDistance = INFINITY;
             StructureBase *closestRefinery = NULL;
 
-            RobustList<StructureBase*>::const_iterator iter;
+            DenseList<StructureBase*>::const_iterator iter;
             for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
                 StructureBase* tempStructure = *iter;
 
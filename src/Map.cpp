@@ -35,9 +35,10 @@
 #include <set>
 
 Map::Map(int xSize, int ySize)
- : sizeX(xSize), sizeY(ySize), tiles(NULL), lastSinglySelectedObject(NULL) {
+ : sizeX(xSize), sizeY(ySize), tiles(NULL), lastSinglySelectedObject(NULL), pathClusterGraph(this), spatialObjectIndex(xSize, ySize), radarTileTracker(this), buildSiteGrid(this), spiceIndex(this) {
 
 	tiles = new Tile[sizeX*sizeY];
+	activeTileFlags.resize(sizeX*sizeY, false);
 
 	for(int i=0; i<sizeX; i++) {
 		for(int j=0; j<sizeY; j++) {
@@ -45,6 +46,9 @@ Map::Map(int xSize, int ySize)
 			tiles[i+j*sizeX].location.y = j;
 		}
 	}
+
+	buildSiteGrid.reset();
+	spiceIndex.reset();
 }
 
 
@@ -56,13 +60,27 @@ void Map::load(InputStream& stream) {
 	sizeX = stream.readSint32();
 	sizeY = stream.readSint32();
 
+	spatialObjectIndex.reset(sizeX, sizeY);
+	radarTileTracker.reset();
+
+	activeTiles.clear();
+	activeTileFlags.clear();
+	activeTileFlags.resize(sizeX*sizeY, false);
+
 	for (int i = 0; i < sizeX; i++) {
 		for (int j = 0; j < sizeY; j++) {
 			getTile(i,j)->load(stream);
 			getTile(i,j)->location.x = i;
 			getTile(i,j)->location.y = j;
+			getTile(i,j)->addObjectsToIndex(spatialObjectIndex);
+			if(getTile(i,j)->needsUpdate()) {
+                addActiveTile(getTile(i,j)->location);
+			}
 		}
 	}
+
+	buildSiteGrid.reset();
+	spiceIndex.reset();
 }
 
 void Map::save(OutputStream& stream) const {
@@ -76,6 +94,32 @@ void Map::save(OutputStream& stream) const {
 	}
 }
 
+void Map::updateTiles() {
+    // every tile only changes its own state, so the order of the updates does not matter
+    for(size_t i = 0; i < activeTiles.size(); ) {
+        Tile* pTile = activeTiles[i];
+        if(pTile->update() == true) {
+            i++;
+        } else {
+            activeTileFlags[pTile->location.y*sizeX + pTile->location.x] = false;
+            activeTiles[i] = activeTiles.back();
+            activeTiles.pop_back();
+        }
+    }
+}
+
+void Map::addActiveTile(const Coord& location) {
+    if(!tileExists(location)) {
+        return;
+    }
+
+    int tileIndex = location.y*sizeX + location.x;
+    if(activeTileFlags[tileIndex] == false) {
+        activeTileFlags[tileIndex] = true;
+        activeTiles.push_back(getTile(location));
+    }
+}
+
 void Map::createSandRegions() {
 	std::stack<Tile*> tileQueue;
 	std::vector<bool> visited(sizeX * sizeY);
@@ -111,7 +155,7 @@ void Map::createSandRegions() {
 	}
 }
 
-void Map::damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Uint32 bulletID, float damage, int damageRadius, bool air) {
+void Map::damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Uint32 bulletID, FixPoint damage, int damageRadius, bool air) {
 	Coord location = Coord(realPos.x/TILESIZE, realPos.y/TILESIZE);
 
     std::set<Uint32>	affectedAirUnits;
@@ -136,7 +180,7 @@ void Map::damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Ui
             ObjectBase* pObject = currentGame->getObjectManager().getObject(*iter);
             if((pObject->getItemID() != Unit_Sandworm) && (pObject->isAGroundUnit() || pObject->isInfantry()) && (pObject->getLocation() == location)) {
                 pObject->setVisible(VIS_ALL, false);
-                pObject->handleDamage( lroundf(damage), damagerID, damagerOwner);
+                pObject->handleDamage( damage.roundToInt(), damagerID, damagerOwner);
             }
         }
     } else {
@@ -153,7 +197,7 @@ void Map::damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Ui
 
 
                     Coord centerPoint = pAirUnit->getCenterPoint();
-                    int distance = lroundf(distanceFrom(centerPoint, realPos));
+                    int distance = distanceFrom(FixPoint(centerPoint.x), FixPoint(centerPoint.y), FixPoint(realPos.x), FixPoint(realPos.y)).roundToInt();
 
                     if(distance <= damageRadius) {
                         if(bulletID == Bullet_DRocket) {
@@ -164,7 +208,7 @@ void Map::damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Ui
                                 }
                             }
                         } else {
-                            int scaledDamage = lroundf(damage) >> (distance/4 + 1);
+                            int scaledDamage = damage.roundToInt() >> (distance/4 + 1);
                             pAirUnit->handleDamage(scaledDamage, damagerID, damagerOwner);
                         }
                     }
@@ -184,7 +228,7 @@ void Map::damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Ui
                     Coord bottomRightCorner = topLeftCorner + pStructure->getStructureSize()*TILESIZE;
 
                     if(realPos.x >= topLeftCorner.x && realPos.y >= topLeftCorner.y && realPos.x < bottomRightCorner.x && realPos.y < bottomRightCorner.y) {
-                        pStructure->handleDamage(damage, damagerID, damagerOwner);
+                        pStructure->handleDamage(damage.toInt(), damagerID, damagerOwner);
 
                         if( (bulletID == Bullet_LargeRocket || bulletID == Bullet_Rocket || bulletID == Bullet_TurretRocket || bulletID == Bullet_SmallRocket)
                             && (pStructure->getHealth() < pStructure->getMaxHealth()/2)) {
@@ -199,7 +243,7 @@ void Map::damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Ui
                     UnitBase* pUnit = dynamic_cast<UnitBase*>(pObject);
 
                     Coord centerPoint = pUnit->getCenterPoint();
-                    int distance = lroundf(distanceFrom(centerPoint, realPos));
+                    int distance = distanceFrom(FixPoint(centerPoint.x), FixPoint(centerPoint.y), FixPoint(realPos.x), FixPoint(realPos.y)).roundToInt();
 
                     if(distance <= damageRadius) {
                         if(bulletID == Bullet_DRocket) {
@@ -210,9 +254,9 @@ void Map::damage(Uint32 damagerID, House* damagerOwner, const Coord& realPos, Ui
                                 }
                             }
                         } else if(bulletID == Bullet_Sonic) {
-                            pUnit->handleDamage(lroundf(damage), damagerID, damagerOwner);
+                            pUnit->handleDamage(damage.roundToInt(), damagerID, damagerOwner);
                         } else {
-                            int scaledDamage = lroundf(damage) >> (distance/16 + 1);
+                            int scaledDamage = damage.roundToInt() >> (distance/16 + 1);
                             pUnit->handleDamage(scaledDamage, damagerID, damagerOwner);
                         }
                     }
@@ -280,6 +324,10 @@ bool Map::okayToPlaceStructure(int x, int y, int buildingSizeX, int buildingSize
 
 
 bool Map::isWithinBuildRange(int x, int y, const House* pHouse) const {
+	if(tileExists(x, y)) {
+		return buildSiteGrid.isWithinBuildRange(x, y, pHouse->getHouseID());
+	}
+
 	bool withinBuildRange = false;
 
 	for (int i = x - BUILDRANGE; i <= x + BUILDRANGE; i++)
@@ -462,10 +510,13 @@ Coord Map::findClosestEdgePoint(const Coord& origin, const Coord& buildingSize)
 
 
 void Map::removeObjectFromMap(Uint32 objectID) {
-	for(int y = 0; y < sizeY ; y++) {
-		for(int x = 0 ; x < sizeX ; x++) {
-			getTile(x,y)->unassignObject(objectID);
-		}
+	// only check the tiles this object is assigned to
+	std::vector<Coord> objectTiles;
+	spatialObjectIndex.getObjectTiles(objectID, objectTiles);
+
+	std::vector<Coord>::const_iterator iter;
+	for(iter = objectTiles.begin(); iter != objectTiles.end(); ++iter) {
+		getTile(*iter)->unassignObject(objectID);
 	}
 }
 
@@ -543,38 +594,15 @@ void Map::selectObjects(int houseID, int x1, int y1, int x2, int y2, int realX,
 
 
 bool Map::findSpice(Coord& destination, const Coord& origin) const {
-	bool found = false;
-
-	int	counter = 0;
-	int depth = 1;
-
-	do {
-        int ranX;
-        int ranY;
-		do {
-			ranX = currentGame->randomGen.rand(origin.x-depth, origin.x + depth);
-			ranY = currentGame->randomGen.rand(origin.y-depth, origin.y + depth);
-		} while(((ranX >= (origin.x+1 - depth)) && (ranX < (origin.x + depth))) && ((ranY >= (origin.y+1 - depth)) && (ranY < (origin.y + depth))));
-
-		if(tileExists(ranX,ranY) && !getTile(ranX,ranY)->hasAGroundObject() && getTile(ranX,ranY)->hasSpice()) {
-			found = true;
-			destination.x = ranX;
-			destination.y = ranY;
-		}
+	Coord spicePos = spiceIndex.findNearestSpice(origin, true, true);
+	if(spicePos.isInvalid()) {
+		return false;	//there is no free spice left anywhere on map
+	}
 
-		counter++;
-		if(counter >= 100) {
-            //if hasn't found a spot on tempObject layer in 100 tries, goto next
-			counter = 0;
-			depth++;
-		}
+	destination = spicePos;
 
-		if(depth > std::max(sizeX, sizeY)) {
-			return false;	//there is possibly no spice left anywhere on map
-		}
-	} while (!found);
-
-	if((depth > 1) && (getTile(origin)->hasSpice())) {
+	int depth = std::max(abs(spicePos.x - origin.x), abs(spicePos.y - origin.y));
+	if((depth > 1) && tileExists(origin) && (getTile(origin)->hasSpice())) {
 		destination = origin;
 	}
 
@@ -627,7 +655,14 @@ void Map::viewMap(int playerTeam, const Coord& location, int maxViewRange) {
                 for(int i = 0; i < NUM_HOUSES; i++) {
                     House* pHouse = currentGame->getHouse(i);
                     if((pHouse != NULL) && (pHouse->getTeam() == playerTeam)) {
-                        getTile(check)->setExplored(i,currentGame->getGameCycleCount());
+                        Tile* pTile = getTile(check);
+                        if(i == radarTileTracker.getHouseID()) {
+                            bool bWasHidden = !pTile->isExplored(i) || pTile->isFogged(i);
+                            pTile->setExplored(i,currentGame->getGameCycleCount());
+                            radarTileTracker.tileSeen(check, bWasHidden);
+                        } else {
+                            pTile->setExplored(i,currentGame->getGameCycleCount());
+                        }
                     }
                 }
 			}
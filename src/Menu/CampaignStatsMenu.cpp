@@ -459,7 +459,7 @@ void CampaignStatsMenu::calculateScore(int level)
 
 	totalScore += ((int) totalHumanCredits) / 100;
 
-    for(RobustList<StructureBase*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+    for(DenseList<StructureBase*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
         StructureBase* pStructure = *iter;
         if(pStructure->getOwner()->isAI() == false) {
             totalScore += currentGame->objectData.data[pStructure->getItemID()][pStructure->getOriginalHouseID()].price / 100;
@@ -468,7 +468,7 @@ void CampaignStatsMenu::calculateScore(int level)
 
     totalScore -= ((totalTime/60) + 1);
 
-    for(RobustList<UnitBase*>::const_iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
+    for(DenseList<UnitBase*>::const_iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
         UnitBase* pUnit = *iter;
         if(pUnit->getItemID() == Unit_Harvester) {
             Harvester* pHarvester = (Harvester*) pUnit;
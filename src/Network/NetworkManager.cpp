@@ -620,6 +620,40 @@ void NetworkManager::handlePacket(ENetPeer* peer, ENetPacketIStream& packetStrea
 				}
 			} break;
 
+			case NETWORKPACKET_SYNCCHECK: {
+			    PeerData* peerData = (PeerData*) peer->data;
+
+                Uint32 cycle = packetStream.readUint32();
+                Uint32 hash = packetStream.readUint32();
+
+				if(pOnReceiveSyncCheck) {
+                    pOnReceiveSyncCheck(peerData->name, cycle, hash);
+				}
+			} break;
+
+			case NETWORKPACKET_SYNCREQUEST: {
+			    PeerData* peerData = (PeerData*) peer->data;
+
+                Uint32 cycle = packetStream.readUint32();
+                Sint32 bucket = packetStream.readSint32();
+
+				if(pOnReceiveSyncRequest) {
+                    pOnReceiveSyncRequest(peerData->name, cycle, bucket);
+				}
+			} break;
+
+			case NETWORKPACKET_SYNCRESPONSE: {
+			    PeerData* peerData = (PeerData*) peer->data;
+
+                Uint32 cycle = packetStream.readUint32();
+                Sint32 bucket = packetStream.readSint32();
+                std::vector<Uint32> hashes = packetStream.readUint32Vector();
+
+				if(pOnReceiveSyncResponse) {
+                    pOnReceiveSyncResponse(peerData->name, cycle, bucket, hashes);
+				}
+			} break;
+
 			default: {
 				fprintf(stderr,"NetworkManager: Unknown packet type %d\n", packetType);
 			};
@@ -711,12 +745,19 @@ void NetworkManager::sendStartGame(unsigned int timeLeft) {
 	}
 }
 
-void NetworkManager::sendCommandList(const CommandList& commandList) {
-	ENetPacketOStream packetStream(ENET_PACKET_FLAG_UNSEQUENCED);
-	packetStream.writeUint32(NETWORKPACKET_COMMANDLIST);
-	commandList.save(packetStream);
-
-    sendPacketToAllConnectedPeers(packetStream, 1);
+void NetworkManager::sendCommandList(const std::string& peerName, const CommandList& commandList) {
+	std::list<ENetPeer*>::iterator iter;
+	for(iter = peerList.begin(); iter != peerList.end(); ++iter) {
+        PeerData* peerData = (PeerData*) (*iter)->data;
+        if((peerData != NULL) && (peerData->name == peerName)) {
+            ENetPacketOStream packetStream(ENET_PACKET_FLAG_UNSEQUENCED);
+            packetStream.writeUint32(NETWORKPACKET_COMMANDLIST);
+            commandList.save(packetStream);
+
+            sendPacketToPeer(*iter, packetStream, 1);
+            return;
+        }
+	}
 }
 
 void NetworkManager::sendSelectedList(const std::set<Uint32>& selectedList, int groupListIndex) {
@@ -728,6 +769,48 @@ void NetworkManager::sendSelectedList(const std::set<Uint32>& selectedList, int
     sendPacketToAllConnectedPeers(packetStream, 0);
 }
 
+void NetworkManager::sendSyncCheck(Uint32 cycle, Uint32 hash) {
+	ENetPacketOStream packetStream(ENET_PACKET_FLAG_RELIABLE);
+	packetStream.writeUint32(NETWORKPACKET_SYNCCHECK);
+	packetStream.writeUint32(cycle);
+	packetStream.writeUint32(hash);
+
+    sendPacketToAllConnectedPeers(packetStream, 0);
+}
+
+void NetworkManager::sendSyncRequest(const std::string& peerName, Uint32 cycle, Sint32 bucket) {
+	std::list<ENetPeer*>::iterator iter;
+	for(iter = peerList.begin(); iter != peerList.end(); ++iter) {
+        PeerData* peerData = (PeerData*) (*iter)->data;
+        if((peerData != NULL) && (peerData->name == peerName)) {
+            ENetPacketOStream packetStream(ENET_PACKET_FLAG_RELIABLE);
+            packetStream.writeUint32(NETWORKPACKET_SYNCREQUEST);
+            packetStream.writeUint32(cycle);
+            packetStream.writeSint32(bucket);
+
+            sendPacketToPeer(*iter, packetStream, 0);
+            return;
+        }
+	}
+}
+
+void NetworkManager::sendSyncResponse(const std::string& peerName, Uint32 cycle, Sint32 bucket, const std::vector<Uint32>& hashes) {
+	std::list<ENetPeer*>::iterator iter;
+	for(iter = peerList.begin(); iter != peerList.end(); ++iter) {
+        PeerData* peerData = (PeerData*) (*iter)->data;
+        if((peerData != NULL) && (peerData->name == peerName)) {
+            ENetPacketOStream packetStream(ENET_PACKET_FLAG_RELIABLE);
+            packetStream.writeUint32(NETWORKPACKET_SYNCRESPONSE);
+            packetStream.writeUint32(cycle);
+            packetStream.writeSint32(bucket);
+            packetStream.writeUint32Vector(hashes);
+
+            sendPacketToPeer(*iter, packetStream, 0);
+            return;
+        }
+	}
+}
+
 int NetworkManager::getMaxPeerRoundTripTime() {
     int maxPeerRTT = 0;
 
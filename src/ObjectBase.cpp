@@ -80,8 +80,8 @@ ObjectBase::ObjectBase(House* newOwner) : originalHouseID(newOwner->getHouseID()
 	location = Coord::Invalid();
     oldLocation = Coord::Invalid();
 	destination = Coord::Invalid();
-	realX = 0.0f;
-	realY = 0.0f;
+	realX = 0;
+	realY = 0;
 
     drawnAngle = 0;
 	angle = (float) drawnAngle;
@@ -114,8 +114,8 @@ ObjectBase::ObjectBase(InputStream& stream) {
 	oldLocation.y = stream.readSint32();
 	destination.x = stream.readSint32();
 	destination.y = stream.readSint32();
-	realX = stream.readFloat();
-	realY = stream.readFloat();
+	realX = stream.readFixPoint();
+	realY = stream.readFixPoint();
 
     angle = stream.readFloat();
     drawnAngle = stream.readSint8();
@@ -176,8 +176,8 @@ void ObjectBase::save(OutputStream& stream) const {
 	stream.writeSint32(oldLocation.y);
 	stream.writeSint32(destination.x);
 	stream.writeSint32(destination.y);
-	stream.writeFloat(realX);
-	stream.writeFloat(realY);
+	stream.writeFixPoint(realX);
+	stream.writeFixPoint(realY);
 
     stream.writeFloat(angle);
     stream.writeSint8(drawnAngle);
@@ -204,7 +204,7 @@ void ObjectBase::save(OutputStream& stream) const {
     \return the center point in world coordinates
 */
 Coord ObjectBase::getCenterPoint() const {
-    return Coord(lround(realX), lround(realY));
+    return Coord(realX.roundToInt(), realY.roundToInt());
 }
 
 Coord ObjectBase::getClosestCenterPoint(const Coord& objectLocation) const {
@@ -328,7 +328,7 @@ bool ObjectBase::canAttack(const ObjectBase* object) const {
 }
 
 bool ObjectBase::isOnScreen() const {
-    Coord position = Coord((int) getRealX(), (int) getRealY());
+    Coord position = Coord(getRealX().toInt(), getRealY().toInt());
     Coord size = Coord(graphic[currentZoomlevel]->w/numImagesX, graphic[currentZoomlevel]->h/numImagesY);
 
 	if(screenborder->isInsideScreen(position,size) == true){
@@ -373,94 +373,15 @@ Coord ObjectBase::getClosestPoint(const Coord& point) const {
 }
 
 const StructureBase* ObjectBase::findClosestTargetStructure() const {
-
-	StructureBase	*closestStructure = NULL;
-	float			closestDistance = INFINITY;
-
-    RobustList<StructureBase*>::const_iterator iter;
-    for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
-        StructureBase* tempStructure = *iter;
-
-        if(canAttack(tempStructure)) {
-			Coord closestPoint = tempStructure->getClosestPoint(getLocation());
-			float structureDistance = blockDistance(getLocation(), closestPoint);
-
-			if(tempStructure->getItemID() == Structure_Wall) {
-					structureDistance += 20000000.0f; //so that walls are targeted very last
-            }
-
-            if(structureDistance < closestDistance)	{
-                closestDistance = structureDistance;
-                closestStructure = tempStructure;
-            }
-        }
-	}
-
-	return closestStructure;
+	return static_cast<StructureBase*>(currentGameMap->getSpatialObjectIndex().findClosestTarget(this, SpatialObjectIndex::Search_Structures));
 }
 
 const UnitBase* ObjectBase::findClosestTargetUnit() const {
-	UnitBase	*closestUnit = NULL;
-	float		closestDistance = INFINITY;
-
-    RobustList<UnitBase*>::const_iterator iter;
-    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
-        UnitBase* tempUnit = *iter;
-
-		if(canAttack(tempUnit)) {
-			Coord closestPoint = tempUnit->getClosestPoint(getLocation());
-			float unitDistance = blockDistance(getLocation(), closestPoint);
-
-			if(unitDistance < closestDistance) {
-                closestDistance = unitDistance;
-				closestUnit = tempUnit;
-            }
-        }
-	}
-
-	return closestUnit;
+	return static_cast<UnitBase*>(currentGameMap->getSpatialObjectIndex().findClosestTarget(this, SpatialObjectIndex::Search_Units));
 }
 
 const ObjectBase* ObjectBase::findClosestTarget() const {
-
-	ObjectBase	*closestObject = NULL;
-	float			closestDistance = INFINITY;
-
-    RobustList<StructureBase*>::const_iterator iter1;
-    for(iter1 = structureList.begin(); iter1 != structureList.end(); ++iter1) {
-        StructureBase* tempStructure = *iter1;
-
-        if(canAttack(tempStructure)) {
-			Coord closestPoint = tempStructure->getClosestPoint(getLocation());
-			float structureDistance = blockDistance(getLocation(), closestPoint);
-
-			if(tempStructure->getItemID() == Structure_Wall) {
-					structureDistance += 20000000.0f; //so that walls are targeted very last
-            }
-
-            if(structureDistance < closestDistance)	{
-                closestDistance = structureDistance;
-                closestObject = tempStructure;
-            }
-        }
-	}
-
-    RobustList<UnitBase*>::const_iterator iter2;
-    for(iter2 = unitList.begin(); iter2 != unitList.end(); ++iter2) {
-        UnitBase* tempUnit = *iter2;
-
-		if(canAttack(tempUnit)) {
-			Coord closestPoint = tempUnit->getClosestPoint(getLocation());
-			float unitDistance = blockDistance(getLocation(), closestPoint);
-
-			if(unitDistance < closestDistance) {
-                closestDistance = unitDistance;
-				closestObject = tempUnit;
-            }
-        }
-	}
-
-	return closestObject;
+	return currentGameMap->getSpatialObjectIndex().findClosestTarget(this, SpatialObjectIndex::Search_All);
 }
 
 const ObjectBase* ObjectBase::findTarget() const {
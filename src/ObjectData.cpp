@@ -41,7 +41,7 @@ ObjectData::ObjectData()
             data[i][h].weapondamage = 0;
             data[i][h].weaponrange = 0;
             data[i][h].weaponreloadtime = 0;
-            data[i][h].maxspeed = 0.0f;
+            data[i][h].maxspeed = 0;
             data[i][h].turnspeed = 0.0f;
             data[i][h].buildtime = 0;
             data[i][h].infspawnprop = 0;
@@ -74,7 +74,7 @@ void ObjectData::loadFromINIFile(std::string filename)
         structureDefaultData[h].weapondamage = loadIntValue(objectDataFile, "default structure", "WeaponDamage", houseChar[h]);
         structureDefaultData[h].weaponrange = loadIntValue(objectDataFile, "default structure", "WeaponRange", houseChar[h]);
         structureDefaultData[h].weaponreloadtime = loadIntValue(objectDataFile, "default structure", "WeaponReloadTime", houseChar[h]);
-        structureDefaultData[h].maxspeed = loadFloatValue(objectDataFile, "default structure", "MaxSpeed", houseChar[h]);
+        structureDefaultData[h].maxspeed = FixPoint::fromFloat(loadFloatValue(objectDataFile, "default structure", "MaxSpeed", houseChar[h]));
         structureDefaultData[h].turnspeed = loadFloatValue(objectDataFile, "default structure", "TurnSpeed", houseChar[h]);
         structureDefaultData[h].buildtime = loadIntValue(objectDataFile, "default structure", "BuildTime", houseChar[h]);
         structureDefaultData[h].infspawnprop = loadIntValue(objectDataFile, "default structure", "InfSpawnProp", houseChar[h]);
@@ -95,7 +95,7 @@ void ObjectData::loadFromINIFile(std::string filename)
         unitDefaultData[h].weapondamage = loadIntValue(objectDataFile, "default unit", "WeaponDamage", houseChar[h]);
         unitDefaultData[h].weaponrange = loadIntValue(objectDataFile, "default unit", "WeaponRange", houseChar[h]);
         unitDefaultData[h].weaponreloadtime = loadIntValue(objectDataFile, "default unit", "WeaponReloadTime", houseChar[h]);
-        unitDefaultData[h].maxspeed = loadFloatValue(objectDataFile, "default unit", "MaxSpeed", houseChar[h]);
+        unitDefaultData[h].maxspeed = FixPoint::fromFloat(loadFloatValue(objectDataFile, "default unit", "MaxSpeed", houseChar[h]));
         unitDefaultData[h].turnspeed = loadFloatValue(objectDataFile, "default unit", "TurnSpeed", houseChar[h]);
         unitDefaultData[h].buildtime = loadIntValue(objectDataFile, "default unit", "BuildTime", houseChar[h]);
         unitDefaultData[h].infspawnprop = loadIntValue(objectDataFile, "default unit", "InfSpawnProp", houseChar[h]);
@@ -143,7 +143,7 @@ void ObjectData::loadFromINIFile(std::string filename)
             data[itemID][h].weapondamage = loadIntValue(objectDataFile, sectionName, "WeaponDamage", houseChar[h], defaultData.weapondamage);
             data[itemID][h].weaponrange = loadIntValue(objectDataFile, sectionName, "WeaponRange", houseChar[h], defaultData.weaponrange);
             data[itemID][h].weaponreloadtime = loadIntValue(objectDataFile, sectionName, "WeaponReloadTime", houseChar[h], defaultData.weaponreloadtime);
-            data[itemID][h].maxspeed = loadFloatValue(objectDataFile, sectionName, "MaxSpeed", houseChar[h], defaultData.maxspeed);
+            data[itemID][h].maxspeed = FixPoint::fromFloat(loadFloatValue(objectDataFile, sectionName, "MaxSpeed", houseChar[h], defaultData.maxspeed.toFloat()));
             data[itemID][h].turnspeed = loadFloatValue(objectDataFile, sectionName, "TurnSpeed", houseChar[h], defaultData.turnspeed);
             data[itemID][h].buildtime = loadIntValue(objectDataFile, sectionName, "BuildTime", houseChar[h], defaultData.buildtime);
             data[itemID][h].infspawnprop = loadIntValue(objectDataFile, sectionName, "InfSpawnProp", houseChar[h], defaultData.infspawnprop);
@@ -167,7 +167,7 @@ void ObjectData::save(OutputStream& stream) const
             stream.writeSint32(data[i][h].weapondamage);
             stream.writeSint32(data[i][h].weaponrange);
             stream.writeSint32(data[i][h].weaponreloadtime);
-            stream.writeFloat(data[i][h].maxspeed);
+            stream.writeFixPoint(data[i][h].maxspeed);
             stream.writeFloat(data[i][h].turnspeed);
             stream.writeSint32(data[i][h].buildtime);
             stream.writeSint32(data[i][h].infspawnprop);
@@ -191,7 +191,7 @@ void ObjectData::load(InputStream& stream)
             data[i][h].weapondamage = stream.readSint32();
             data[i][h].weaponrange = stream.readSint32();
             data[i][h].weaponreloadtime = stream.readSint32();
-            data[i][h].maxspeed = stream.readFloat();
+            data[i][h].maxspeed = stream.readFixPoint();
             data[i][h].turnspeed = stream.readFloat();
             data[i][h].buildtime = stream.readSint32();
             data[i][h].infspawnprop = stream.readSint32();
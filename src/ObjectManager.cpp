@@ -22,19 +22,52 @@
 #include <Game.h>
 #include <ObjectBase.h>
 
+#include <algorithm>
+
 void ObjectManager::save(OutputStream& stream) const {
-    stream.writeUint32(nextFreeObjectID);
+    stream.writeUint32(slots.size());
+    for(size_t i = 1; i < slots.size(); i++) {
+        stream.writeUint32(slots[i].objectID);
+    }
+
+    stream.writeUint32(freeSlots.size());
+    std::deque<Uint32>::const_iterator freeIter;
+    for(freeIter = freeSlots.begin(); freeIter != freeSlots.end(); ++freeIter) {
+        stream.writeUint32(*freeIter);
+    }
 
-    stream.writeUint32(objectMap.size());
-    ObjectMap::const_iterator iter;
-    for(iter = objectMap.begin(); iter != objectMap.end(); ++iter) {
+    // save the objects in the order they were added, so that they are added to the unit and structure lists in the same order when loading
+    std::vector< std::pair<Uint32,ObjectBase*> > objects;
+    for(size_t i = 1; i < slots.size(); i++) {
+        if(slots[i].pObject != NULL) {
+            objects.push_back( std::pair<Uint32,ObjectBase*>(slots[i].creationNumber, slots[i].pObject) );
+        }
+    }
+    std::sort(objects.begin(), objects.end());
+
+    stream.writeUint32(objects.size());
+    std::vector< std::pair<Uint32,ObjectBase*> >::const_iterator iter;
+    for(iter = objects.begin(); iter != objects.end(); ++iter) {
         stream.writeUint32(iter->second->getObjectID());
         currentGame->saveObject(stream, iter->second);
     }
 }
 
 void ObjectManager::load(InputStream& stream) {
-    nextFreeObjectID = stream.readUint32();
+    Uint32 numSlots = stream.readUint32();
+    slots.clear();
+    slots.resize(numSlots);
+    for(Uint32 i = 1; i < numSlots; i++) {
+        slots[i].objectID = stream.readUint32();
+    }
+
+    freeSlots.clear();
+    Uint32 numFreeSlots = stream.readUint32();
+    for(Uint32 i = 0; i < numFreeSlots; i++) {
+        freeSlots.push_back(stream.readUint32());
+    }
+
+    nextCreationNumber = 1;
 
     Uint32 numObjects = stream.readUint32();
     for(Uint32 i=0;i<numObjects;i++) {
@@ -45,19 +78,60 @@ void ObjectManager::load(InputStream& stream) {
 			fprintf(stderr,"ObjectManager::load(): The loaded object has a different ID than expected (%d!=%d)!\n",objectID,pObject->getObjectID());
 		}
 
-        objectMap.insert( std::pair<Uint32,ObjectBase*>(objectID, pObject) );
+        Uint32 slotIndex = objectID & OBJECTSLOTMASK;
+        if((slotIndex == 0) || (slotIndex >= slots.size()) || (slots[slotIndex].objectID != objectID) || (slots[slotIndex].pObject != NULL)) {
+            fprintf(stderr,"ObjectManager::load(): The loaded object has an invalid ID (%d)!\n",objectID);
+            continue;
+        }
+
+        slots[slotIndex].pObject = pObject;
+        slots[slotIndex].creationNumber = nextCreationNumber++;
     }
 }
 
 Uint32 ObjectManager::addObject(ObjectBase* pObject) {
-    std::pair<ObjectMap::iterator,bool> insertPosition;
+    Uint32 slotIndex;
 
-    insertPosition = objectMap.insert( std::pair<Uint32,ObjectBase*>(nextFreeObjectID, pObject) );
-
-    if(insertPosition.second == false) {
-        // there is already such an object in the list
-        return NONE;
+    if(freeSlots.empty() == false) {
+        slotIndex = freeSlots.front();
+        freeSlots.pop_front();
+    } else if(slots.size() < MAXOBJECTSLOTS) {
+        slotIndex = slots.size();
+        slots.push_back(ObjectSlot());
     } else {
-        return nextFreeObjectID++;  // Caution: Old value is returned but value is incremented afterwards
+        // there are no free slots left
+        return NONE;
     }
+
+    ObjectSlot& slot = slots[slotIndex];
+    slot.pObject = pObject;
+    slot.objectID = getNextObjectID(slotIndex);
+    slot.creationNumber = nextCreationNumber++;
+
+    return slot.objectID;
+}
+
+bool ObjectManager::removeObject(Uint32 objectID) {
+    Uint32 slotIndex = objectID & OBJECTSLOTMASK;
+
+    if((slotIndex >= slots.size()) || (slots[slotIndex].pObject == NULL) || (slots[slotIndex].objectID != objectID)) {
+        return false;
+    }
+
+    slots[slotIndex].pObject = NULL;
+
+    // the generation must not wrap around, otherwise old ids would refer to new objects
+    if((objectID >> OBJECTSLOTBITS) < MAXOBJECTGENERATION) {
+        freeSlots.push_back(slotIndex);
+    }
+    return true;
+}
+
+Uint32 ObjectManager::getNextObjectID(Uint32 slotIndex) const {
+    const ObjectSlot& slot = slots[slotIndex];
+
+    // a new slot starts with generation 0
+    Uint32 generation = (slot.objectID == NONE) ? 0 : (slot.objectID >> OBJECTSLOTBITS) + 1;
+
+    return ((generation << OBJECTSLOTBITS) | slotIndex);
 }
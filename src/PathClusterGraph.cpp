@@ -0,0 +1,394 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <PathClusterGraph.h>
+
+#include <Map.h>
+#include <units/UnitBase.h>
+
+#include <queue>
+#include <functional>
+#include <algorithm>
+
+/// entrances that are shorter than this are represented by one transition in the middle, longer ones by two transitions at both ends
+#define MAX_SINGLE_TRANSITION_ENTRANCE  6
+
+typedef std::pair<float, int> QueueEntry;
+typedef std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > PriorityQueue;
+
+PathClusterGraph::PathClusterGraph(Map* pMap)
+ : pMap(pMap), mapSizeX(0), mapSizeY(0), numClustersX(0), numClustersY(0) {
+}
+
+PathClusterGraph::~PathClusterGraph() {
+}
+
+PathClusterGraph::MOVEMENTCLASS PathClusterGraph::getMovementClass(const UnitBase* pUnit) {
+    if(pUnit->isAFlyingUnit()) {
+        return MovementClass_Air;
+    } else if(pUnit->getItemID() == Unit_Sandworm) {
+        return MovementClass_Sandworm;
+    } else if(pUnit->isInfantry()) {
+        return MovementClass_Infantry;
+    } else if(pUnit->isTracked()) {
+        return MovementClass_Tracked;
+    } else {
+        return MovementClass_Wheeled;
+    }
+}
+
+void PathClusterGraph::invalidateTile(int x, int y) {
+    checkMapSize();
+
+    if(!pMap->tileExists(x,y)) {
+        return;
+    }
+
+    int clusterX = x / PATHCLUSTERSIZE;
+    int clusterY = y / PATHCLUSTERSIZE;
+
+    // a tile at the border of a cluster also affects the entrances of the neighbour cluster
+    std::vector<int> affectedClusters;
+    affectedClusters.push_back(clusterY*numClustersX + clusterX);
+    if((x % PATHCLUSTERSIZE == 0) && (clusterX > 0)) {
+        affectedClusters.push_back(clusterY*numClustersX + clusterX - 1);
+    }
+    if((x % PATHCLUSTERSIZE == PATHCLUSTERSIZE - 1) && (clusterX < numClustersX - 1)) {
+        affectedClusters.push_back(clusterY*numClustersX + clusterX + 1);
+    }
+    if((y % PATHCLUSTERSIZE == 0) && (clusterY > 0)) {
+        affectedClusters.push_back((clusterY - 1)*numClustersX + clusterX);
+    }
+    if((y % PATHCLUSTERSIZE == PATHCLUSTERSIZE - 1) && (clusterY < numClustersY - 1)) {
+        affectedClusters.push_back((clusterY + 1)*numClustersX + clusterX);
+    }
+
+    for(int movementClass = 0; movementClass < NUM_MOVEMENTCLASSES; movementClass++) {
+        for(std::vector<int>::const_iterator iter = affectedClusters.begin(); iter != affectedClusters.end(); ++iter) {
+            clusters[movementClass][*iter].bDirty = true;
+        }
+    }
+}
+
+bool PathClusterGraph::findAbstractPath(const UnitBase* pUnit, const Coord& start, const Coord& destination, std::vector<Coord>& waypoints) {
+    waypoints.clear();
+
+    MOVEMENTCLASS movementClass = getMovementClass(pUnit);
+    if(movementClass == MovementClass_Air) {
+        // air units can fly everywhere
+        return false;
+    }
+
+    checkMapSize();
+
+    if(!pMap->tileExists(start) || !pMap->tileExists(destination)) {
+        return false;
+    }
+
+    int startCluster = getClusterIndex(start);
+    int destinationCluster = getClusterIndex(destination);
+    if(startCluster == destinationCluster) {
+        return false;
+    }
+
+    std::vector<Cluster>& classClusters = clusters[movementClass];
+
+    // repair all clusters that have changed since the last search
+    for(int i = 0; i < (int) classClusters.size(); i++) {
+        if(classClusters[i].bDirty) {
+            rebuildCluster(pUnit, movementClass, i);
+        }
+    }
+
+    // number all entrances consecutively
+    std::vector<int> firstNode(classClusters.size() + 1);
+    std::vector<int> nodeCluster;
+    firstNode[0] = 0;
+    for(int i = 0; i < (int) classClusters.size(); i++) {
+        firstNode[i+1] = firstNode[i] + classClusters[i].entrances.size();
+        nodeCluster.insert(nodeCluster.end(), classClusters[i].entrances.size(), i);
+    }
+    const int goalNode = firstNode[classClusters.size()];
+
+    std::vector<float> g(goalNode + 1, INFINITY);
+    std::vector<int> parent(goalNode + 1, INVALID);
+    std::vector<bool> closed(goalNode + 1, false);
+    PriorityQueue openList;
+
+    // connect the start to the entrances of its cluster
+    std::vector<float> costs;
+    calculateClusterCosts(pUnit, movementClass, start, costs);
+    const Cluster& firstCluster = classClusters[startCluster];
+    Coord firstClusterTopLeft = Coord((startCluster % numClustersX) * PATHCLUSTERSIZE, (startCluster / numClustersX) * PATHCLUSTERSIZE);
+    int firstClusterWidth = std::min(PATHCLUSTERSIZE, mapSizeX - firstClusterTopLeft.x);
+    for(int i = 0; i < (int) firstCluster.entrances.size(); i++) {
+        Coord local = firstCluster.entrances[i].location - firstClusterTopLeft;
+        float cost = costs[local.y*firstClusterWidth + local.x];
+        if(cost < INFINITY) {
+            int node = firstNode[startCluster] + i;
+            g[node] = cost;
+            openList.push(QueueEntry(cost + blockDistance(firstCluster.entrances[i].location, destination), node));
+        }
+    }
+
+    // connect the entrances of the destination cluster to the destination
+    std::vector<float> goalCosts;
+    calculateClusterCosts(pUnit, movementClass, destination, goalCosts);
+    Coord lastClusterTopLeft = Coord((destinationCluster % numClustersX) * PATHCLUSTERSIZE, (destinationCluster / numClustersX) * PATHCLUSTERSIZE);
+    int lastClusterWidth = std::min(PATHCLUSTERSIZE, mapSizeX - lastClusterTopLeft.x);
+
+    while(!openList.empty()) {
+        int currentNode = openList.top().second;
+        openList.pop();
+
+        if(closed[currentNode]) {
+            continue;
+        }
+        closed[currentNode] = true;
+
+        if(currentNode == goalNode) {
+            break;
+        }
+
+        int clusterIndex = nodeCluster[currentNode];
+        const Cluster& cluster = classClusters[clusterIndex];
+        int numEntrances = cluster.entrances.size();
+        int entranceIndex = currentNode - firstNode[clusterIndex];
+        const Entrance& entrance = cluster.entrances[entranceIndex];
+        float currentG = g[currentNode];
+
+        // move to another entrance of the same cluster
+        for(int i = 0; i < numEntrances; i++) {
+            float distance = cluster.distances[entranceIndex*numEntrances + i];
+            int nextNode = firstNode[clusterIndex] + i;
+            if((distance < INFINITY) && (currentG + distance < g[nextNode])) {
+                g[nextNode] = currentG + distance;
+                parent[nextNode] = currentNode;
+                openList.push(QueueEntry(g[nextNode] + blockDistance(cluster.entrances[i].location, destination), nextNode));
+            }
+        }
+
+        // move into the neighbour cluster
+        int neighbourCluster = getClusterIndex(entrance.outside);
+        int neighbourEntrance = findEntrance(movementClass, neighbourCluster, entrance.outside);
+        if(neighbourEntrance != INVALID) {
+            float cost = pUnit->getTerrainDifficulty((TERRAINTYPE) pMap->getTile(entrance.outside)->getType());
+            int nextNode = firstNode[neighbourCluster] + neighbourEntrance;
+            if(currentG + cost < g[nextNode]) {
+                g[nextNode] = currentG + cost;
+                parent[nextNode] = currentNode;
+                openList.push(QueueEntry(g[nextNode] + blockDistance(entrance.outside, destination), nextNode));
+            }
+        }
+
+        // move to the destination
+        if(clusterIndex == destinationCluster) {
+            Coord local = entrance.location - lastClusterTopLeft;
+            float cost = goalCosts[local.y*lastClusterWidth + local.x];
+            if((cost < INFINITY) && (currentG + cost < g[goalNode])) {
+                g[goalNode] = currentG + cost;
+                parent[goalNode] = currentNode;
+                openList.push(QueueEntry(g[goalNode], goalNode));
+            }
+        }
+    }
+
+    if(parent[goalNode] == INVALID) {
+        // destination is not reachable
+        return false;
+    }
+
+    waypoints.push_back(destination);
+    for(int node = parent[goalNode]; node != INVALID; node = parent[node]) {
+        int clusterIndex = nodeCluster[node];
+        waypoints.push_back(classClusters[clusterIndex].entrances[node - firstNode[clusterIndex]].location);
+    }
+    std::reverse(waypoints.begin(), waypoints.end());
+
+    return true;
+}
+
+void PathClusterGraph::checkMapSize() {
+    if((mapSizeX == pMap->getSizeX()) && (mapSizeY == pMap->getSizeY())) {
+        return;
+    }
+
+    mapSizeX = pMap->getSizeX();
+    mapSizeY = pMap->getSizeY();
+    numClustersX = (mapSizeX + PATHCLUSTERSIZE - 1) / PATHCLUSTERSIZE;
+    numClustersY = (mapSizeY + PATHCLUSTERSIZE - 1) / PATHCLUSTERSIZE;
+
+    Cluster emptyCluster;
+    emptyCluster.bDirty = true;
+    for(int movementClass = 0; movementClass < NUM_MOVEMENTCLASSES; movementClass++) {
+        clusters[movementClass].assign(numClustersX*numClustersY, emptyCluster);
+    }
+}
+
+bool PathClusterGraph::isStaticallyPassable(MOVEMENTCLASS movementClass, int x, int y) const {
+    if(!pMap->tileExists(x,y)) {
+        return false;
+    }
+
+    const Tile* pTile = pMap->getTile(x,y);
+
+    switch(movementClass) {
+        case MovementClass_Tracked:
+        case MovementClass_Wheeled:     return (!pTile->isMountain() && !pTile->hasAStructure());
+        case MovementClass_Infantry:    return !pTile->hasAStructure();
+        case MovementClass_Sandworm:    return !pTile->isRock();
+        case MovementClass_Air:
+        default:                        return true;
+    }
+}
+
+void PathClusterGraph::rebuildCluster(const UnitBase* pUnit, MOVEMENTCLASS movementClass, int clusterIndex) {
+    Cluster& cluster = clusters[movementClass][clusterIndex];
+
+    int clusterX = clusterIndex % numClustersX;
+    int clusterY = clusterIndex / numClustersX;
+    Coord topLeft = Coord(clusterX * PATHCLUSTERSIZE, clusterY * PATHCLUSTERSIZE);
+    int width = std::min(PATHCLUSTERSIZE, mapSizeX - topLeft.x);
+    int height = std::min(PATHCLUSTERSIZE, mapSizeY - topLeft.y);
+
+    cluster.entrances.clear();
+
+    if(clusterY > 0) {
+        addBorderEntrances(movementClass, cluster, topLeft, Coord(1,0), Coord(0,-1), width);
+    }
+    if(clusterY < numClustersY - 1) {
+        addBorderEntrances(movementClass, cluster, topLeft + Coord(0, height - 1), Coord(1,0), Coord(0,1), width);
+    }
+    if(clusterX > 0) {
+        addBorderEntrances(movementClass, cluster, topLeft, Coord(0,1), Coord(-1,0), height);
+    }
+    if(clusterX < numClustersX - 1) {
+        addBorderEntrances(movementClass, cluster, topLeft + Coord(width - 1, 0), Coord(0,1), Coord(1,0), height);
+    }
+
+    int numEntrances = cluster.entrances.size();
+    cluster.distances.assign(numEntrances*numEntrances, INFINITY);
+
+    std::vector<float> costs;
+    for(int i = 0; i < numEntrances; i++) {
+        calculateClusterCosts(pUnit, movementClass, cluster.entrances[i].location, costs);
+
+        for(int j = 0; j < numEntrances; j++) {
+            if(i != j) {
+                Coord local = cluster.entrances[j].location - topLeft;
+                cluster.distances[i*numEntrances + j] = costs[local.y*width + local.x];
+            }
+        }
+    }
+
+    cluster.bDirty = false;
+}
+
+void PathClusterGraph::addBorderEntrances(MOVEMENTCLASS movementClass, Cluster& cluster, const Coord& borderStart, const Coord& step, const Coord& outsideOffset, int length) {
+    int runStart = INVALID;
+
+    for(int i = 0; i <= length; i++) {
+        Coord location = borderStart + step*i;
+        Coord outside = location + outsideOffset;
+
+        bool bPassable = (i < length)
+                            && isStaticallyPassable(movementClass, location.x, location.y)
+                            && isStaticallyPassable(movementClass, outside.x, outside.y);
+
+        if(bPassable && (runStart == INVALID)) {
+            runStart = i;
+        } else if(!bPassable && (runStart != INVALID)) {
+            int runLength = i - runStart;
+
+            Entrance entrance;
+            if(runLength < MAX_SINGLE_TRANSITION_ENTRANCE) {
+                entrance.location = borderStart + step*(runStart + runLength/2);
+                entrance.outside = entrance.location + outsideOffset;
+                cluster.entrances.push_back(entrance);
+            } else {
+                entrance.location = borderStart + step*runStart;
+                entrance.outside = entrance.location + outsideOffset;
+                cluster.entrances.push_back(entrance);
+
+                entrance.location = borderStart + step*(i - 1);
+                entrance.outside = entrance.location + outsideOffset;
+                cluster.entrances.push_back(entrance);
+            }
+
+            runStart = INVALID;
+        }
+    }
+}
+
+void PathClusterGraph::calculateClusterCosts(const UnitBase* pUnit, MOVEMENTCLASS movementClass, const Coord& source, std::vector<float>& costs) const {
+    Coord topLeft = Coord((source.x / PATHCLUSTERSIZE) * PATHCLUSTERSIZE, (source.y / PATHCLUSTERSIZE) * PATHCLUSTERSIZE);
+    int width = std::min(PATHCLUSTERSIZE, mapSizeX - topLeft.x);
+    int height = std::min(PATHCLUSTERSIZE, mapSizeY - topLeft.y);
+
+    costs.assign(width*height, INFINITY);
+
+    PriorityQueue openList;
+    Coord local = source - topLeft;
+    costs[local.y*width + local.x] = 0.0f;
+    openList.push(QueueEntry(0.0f, local.y*width + local.x));
+
+    while(!openList.empty()) {
+        float currentCost = openList.top().first;
+        int currentIndex = openList.top().second;
+        openList.pop();
+
+        if(currentCost > costs[currentIndex]) {
+            // outdated entry
+            continue;
+        }
+
+        Coord current = topLeft + Coord(currentIndex % width, currentIndex / width);
+
+        for(int angle = 0; angle < NUM_ANGLES; angle++) {
+            Coord next = pMap->getMapPos(angle, current);
+            Coord nextLocal = next - topLeft;
+
+            if((nextLocal.x < 0) || (nextLocal.x >= width) || (nextLocal.y < 0) || (nextLocal.y >= height)
+                || !isStaticallyPassable(movementClass, next.x, next.y)) {
+                continue;
+            }
+
+            float cost = pUnit->getTerrainDifficulty((TERRAINTYPE) pMap->getTile(next)->getType());
+            if((next.x != current.x) && (next.y != current.y)) {
+                cost *= DIAGONALCOST;
+            }
+
+            int nextIndex = nextLocal.y*width + nextLocal.x;
+            if(currentCost + cost < costs[nextIndex]) {
+                costs[nextIndex] = currentCost + cost;
+                openList.push(QueueEntry(costs[nextIndex], nextIndex));
+            }
+        }
+    }
+}
+
+int PathClusterGraph::findEntrance(MOVEMENTCLASS movementClass, int clusterIndex, const Coord& location) const {
+    const std::vector<Entrance>& entrances = clusters[movementClass][clusterIndex].entrances;
+
+    for(int i = 0; i < (int) entrances.size(); i++) {
+        if(entrances[i].location == location) {
+            return i;
+        }
+    }
+
+    return INVALID;
+}
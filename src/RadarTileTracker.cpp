@@ -0,0 +1,120 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <RadarTileTracker.h>
+
+#include <Map.h>
+#include <Tile.h>
+
+RadarTileTracker::RadarTileTracker(Map* pMap)
+ : pMap(pMap), houseID(INVALID), bAllTilesDirty(true) {
+}
+
+RadarTileTracker::~RadarTileTracker() {
+}
+
+void RadarTileTracker::reset() {
+    houseID = INVALID;
+    bAllTilesDirty = true;
+
+    dirtyFlags.clear();
+    dirtyTiles.clear();
+    fogScheduledFlags.clear();
+    fogExpiryQueue = std::priority_queue<FogExpiry, std::vector<FogExpiry>, std::greater<FogExpiry> >();
+}
+
+void RadarTileTracker::startTracking(int houseID) {
+    reset();
+
+    this->houseID = houseID;
+
+    int numTiles = pMap->getSizeX()*pMap->getSizeY();
+    dirtyFlags.resize(numTiles, false);
+    fogScheduledFlags.resize(numTiles, false);
+
+    // all explored tiles may be fogged in the future
+    for(int i = 0; i < numTiles; i++) {
+        if(pMap->getTile(i % pMap->getSizeX(), i / pMap->getSizeX())->isExplored(houseID)) {
+            scheduleFogExpiry(i);
+        }
+    }
+}
+
+void RadarTileTracker::setTileDirty(const Coord& location) {
+    if((houseID == INVALID) || bAllTilesDirty || !pMap->tileExists(location)) {
+        return;
+    }
+
+    int tileIndex = location.y*pMap->getSizeX() + location.x;
+    if(dirtyFlags[tileIndex] == false) {
+        dirtyFlags[tileIndex] = true;
+        dirtyTiles.push_back(location);
+    }
+}
+
+void RadarTileTracker::tileSeen(const Coord& location, bool bWasHidden) {
+    if((houseID == INVALID) || !pMap->tileExists(location)) {
+        return;
+    }
+
+    if(bWasHidden) {
+        setTileDirty(location);
+    }
+
+    scheduleFogExpiry(location.y*pMap->getSizeX() + location.x);
+}
+
+void RadarTileTracker::updateFog(Uint32 gameCycle) {
+    if(houseID == INVALID) {
+        return;
+    }
+
+    while(!fogExpiryQueue.empty() && (fogExpiryQueue.top().first <= gameCycle)) {
+        int tileIndex = fogExpiryQueue.top().second;
+        fogExpiryQueue.pop();
+
+        Tile* pTile = pMap->getTile(tileIndex % pMap->getSizeX(), tileIndex / pMap->getSizeX());
+        Uint32 expiry = pTile->getLastAccess(houseID) + FOGTIME;
+
+        if(expiry <= gameCycle) {
+            fogScheduledFlags[tileIndex] = false;
+            setTileDirty(pTile->location);
+        } else {
+            // the tile was seen again in the meantime
+            fogExpiryQueue.push(FogExpiry(expiry, tileIndex));
+        }
+    }
+}
+
+void RadarTileTracker::clearDirtyTiles() {
+    std::vector<Coord>::const_iterator iter;
+    for(iter = dirtyTiles.begin(); iter != dirtyTiles.end(); ++iter) {
+        dirtyFlags[iter->y*pMap->getSizeX() + iter->x] = false;
+    }
+
+    dirtyTiles.clear();
+    bAllTilesDirty = false;
+}
+
+void RadarTileTracker::scheduleFogExpiry(int tileIndex) {
+    if(fogScheduledFlags[tileIndex] == false) {
+        fogScheduledFlags[tileIndex] = true;
+
+        Tile* pTile = pMap->getTile(tileIndex % pMap->getSizeX(), tileIndex / pMap->getSizeX());
+        fogExpiryQueue.push(FogExpiry(pTile->getLastAccess(houseID) + FOGTIME, tileIndex));
+    }
+}
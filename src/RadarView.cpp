@@ -34,7 +34,8 @@
 
 
 RadarView::RadarView()
- : RadarViewBase(), currentRadarMode(Mode_RadarOff), animFrame(NUM_STATIC_FRAMES - 1), animCounter(NUM_STATIC_FRAME_TIME)
+ : RadarViewBase(), currentRadarMode(Mode_RadarOff), animFrame(NUM_STATIC_FRAMES - 1), animCounter(NUM_STATIC_FRAME_TIME),
+   bLastRadarOn(false), bLastDebug(false), bLastFogOfWar(false)
 {
     radarStaticAnimation = pGFXManager->getUIGraphic(UI_RadarAnimation);
 
@@ -186,30 +187,58 @@ void RadarView:: switchRadarMode(bool bOn) {
 }
 
 void RadarView::updateRadarSurface(int mapSizeX, int mapSizeY, int scale, int offsetX, int offsetY) {
+    RadarTileTracker& radarTileTracker = currentGameMap->getRadarTileTracker();
 
-    // Lock radarSurface for direct access to the pixels
-    if(!SDL_MUSTLOCK(radarSurface) || (SDL_LockSurface(radarSurface) == 0)) {
-        for(int x = 0; x <  mapSizeX; x++) {
-            for(int y = 0; y <  mapSizeY; y++) {
+    bool bRadarOn = pLocalHouse->hasRadarOn();
+    bool bFogOfWar = currentGame->getGameInitSettings().getGameOptions().fogOfWar;
 
-                Tile* pTile = currentGameMap->getTile(x,y);
-
-                /* Selecting the right color is handled in Tile::getRadarColor() */
-                Uint32 color = pTile->getRadarColor(pLocalHouse, pLocalHouse->hasRadarOn());
+    if((radarTileTracker.getHouseID() != pLocalHouse->getHouseID()) || (bRadarOn != bLastRadarOn) || (debug != bLastDebug) || (bFogOfWar != bLastFogOfWar)) {
+        // the color of every tile might have changed
+        radarTileTracker.startTracking(pLocalHouse->getHouseID());
+        bLastRadarOn = bRadarOn;
+        bLastDebug = debug;
+        bLastFogOfWar = bFogOfWar;
+    }
 
-                for(int j = 0; j < scale; j++) {
-                    Uint8* p = (Uint8 *) radarSurface->pixels + (offsetY + scale*y + j) * radarSurface->pitch + (offsetX + scale*x);
+    if(bFogOfWar && !debug) {
+        radarTileTracker.updateFog(currentGame->getGameCycleCount());
+    }
 
-                    for(int i = 0; i < scale; i++, p++) {
-                        // Do not use putPixel here to avoid overhead
-                        *p = color;
-                    }
+    // Lock radarSurface for direct access to the pixels
+    if(!SDL_MUSTLOCK(radarSurface) || (SDL_LockSurface(radarSurface) == 0)) {
+        if(radarTileTracker.areAllTilesDirty()) {
+            for(int x = 0; x <  mapSizeX; x++) {
+                for(int y = 0; y <  mapSizeY; y++) {
+                    drawRadarTile(x, y, scale, offsetX, offsetY);
                 }
             }
+        } else {
+            const std::vector<Coord>& dirtyTiles = radarTileTracker.getDirtyTiles();
+            for(std::vector<Coord>::const_iterator iter = dirtyTiles.begin(); iter != dirtyTiles.end(); ++iter) {
+                drawRadarTile(iter->x, iter->y, scale, offsetX, offsetY);
+            }
         }
 
-        if(SDL_MUSTLOCK(screen)) {
-            SDL_UnlockSurface(screen);
+        radarTileTracker.clearDirtyTiles();
+
+        if(SDL_MUSTLOCK(radarSurface)) {
+            SDL_UnlockSurface(radarSurface);
+        }
+    }
+}
+
+void RadarView::drawRadarTile(int x, int y, int scale, int offsetX, int offsetY) {
+    Tile* pTile = currentGameMap->getTile(x,y);
+
+    /* Selecting the right color is handled in Tile::getRadarColor() */
+    Uint32 color = pTile->getRadarColor(pLocalHouse, pLocalHouse->hasRadarOn());
+
+    for(int j = 0; j < scale; j++) {
+        Uint8* p = (Uint8 *) radarSurface->pixels + (offsetY + scale*y + j) * radarSurface->pitch + (offsetX + scale*x);
+
+        for(int i = 0; i < scale; i++, p++) {
+            // Do not use putPixel here to avoid overhead
+            *p = color;
         }
     }
 }
@@ -0,0 +1,79 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <RenderList.h>
+
+#include <Tile.h>
+#include <ObjectBase.h>
+#include <structures/StructureBase.h>
+
+RenderList::RenderList() {
+}
+
+RenderList::~RenderList() {
+}
+
+void RenderList::clear() {
+    for(int i = 0; i < NUM_RENDERLAYERS; i++) {
+        layers[i].clear();
+    }
+}
+
+void RenderList::draw(RENDERLAYER layer) const {
+    const std::vector<RenderItem>& items = layers[layer];
+
+    std::vector<RenderItem>::const_iterator iter;
+    switch(layer) {
+        case RenderLayer_Ground: {
+            for(iter = items.begin(); iter != items.end(); ++iter) {
+                iter->pTile->blitGround(iter->xPos, iter->yPos);
+            }
+        } break;
+
+        case RenderLayer_DeadUnits: {
+            for(iter = items.begin(); iter != items.end(); ++iter) {
+                iter->pTile->blitDeadUnits(iter->xPos, iter->yPos);
+            }
+        } break;
+
+        case RenderLayer_Structures: {
+            for(iter = items.begin(); iter != items.end(); ++iter) {
+                StructureBase* pStructure = static_cast<StructureBase*>(iter->pObject);
+                pStructure->setFogged(iter->bFogged);
+                pStructure->blitToScreen();
+            }
+        } break;
+
+        case RenderLayer_SelectionRects: {
+            for(iter = items.begin(); iter != items.end(); ++iter) {
+                if(iter->pObject->isSelected()) {
+                    iter->pObject->drawSelectionBox();
+                }
+
+                if(iter->pObject->isSelectedByOtherPlayer()) {
+                    iter->pObject->drawOtherPlayerSelectionBox();
+                }
+            }
+        } break;
+
+        default: {
+            for(iter = items.begin(); iter != items.end(); ++iter) {
+                iter->pObject->blitToScreen();
+            }
+        } break;
+    }
+}
@@ -0,0 +1,218 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SpatialObjectIndex.h>
+
+#include <globals.h>
+#include <Game.h>
+#include <ObjectManager.h>
+#include <ObjectBase.h>
+#include <mmath.h>
+#include <data.h>
+
+#include <math.h>
+#include <algorithm>
+
+SpatialObjectIndex::ObjectTiles::ObjectTiles() : objectID(NONE) {
+}
+
+SpatialObjectIndex::SpatialObjectIndex(int mapSizeX, int mapSizeY)
+ : mapSizeX(0), mapSizeY(0), numBucketsX(0), numBucketsY(0) {
+    reset(mapSizeX, mapSizeY);
+}
+
+SpatialObjectIndex::~SpatialObjectIndex() {
+}
+
+void SpatialObjectIndex::reset(int mapSizeX, int mapSizeY) {
+    this->mapSizeX = mapSizeX;
+    this->mapSizeY = mapSizeY;
+    numBucketsX = (mapSizeX + SPATIALINDEXBUCKETSIZE - 1) / SPATIALINDEXBUCKETSIZE;
+    numBucketsY = (mapSizeY + SPATIALINDEXBUCKETSIZE - 1) / SPATIALINDEXBUCKETSIZE;
+
+    buckets.clear();
+    buckets.resize(numBucketsX*numBucketsY);
+    objectTiles.clear();
+}
+
+void SpatialObjectIndex::addObject(const Coord& location, Uint32 objectID) {
+    if((location.x < 0) || (location.x >= mapSizeX) || (location.y < 0) || (location.y >= mapSizeY)) {
+        return;
+    }
+
+    Uint32 slotIndex = objectID & OBJECTSLOTMASK;
+    if(slotIndex >= objectTiles.size()) {
+        objectTiles.resize(slotIndex + 1);
+    }
+
+    ObjectTiles& tilesOfObject = objectTiles[slotIndex];
+    if(tilesOfObject.objectID != objectID) {
+        // the slot belonged to an older object that is not on the map anymore
+        tilesOfObject.objectID = objectID;
+        tilesOfObject.tiles.clear();
+    }
+    tilesOfObject.tiles.push_back(location);
+
+    std::vector<Entry>& bucket = buckets[getBucketIndex(location)];
+
+    std::vector<Entry>::iterator iter;
+    for(iter = bucket.begin(); iter != bucket.end(); ++iter) {
+        if(iter->objectID == objectID) {
+            iter->count++;
+            return;
+        }
+    }
+
+    Entry entry;
+    entry.objectID = objectID;
+    entry.count = 1;
+    bucket.push_back(entry);
+}
+
+void SpatialObjectIndex::removeObject(const Coord& location, Uint32 objectID, int count) {
+    if((count <= 0) || (location.x < 0) || (location.x >= mapSizeX) || (location.y < 0) || (location.y >= mapSizeY)) {
+        return;
+    }
+
+    Uint32 slotIndex = objectID & OBJECTSLOTMASK;
+    if((slotIndex < objectTiles.size()) && (objectTiles[slotIndex].objectID == objectID)) {
+        std::vector<Coord>& tiles = objectTiles[slotIndex].tiles;
+        int numRemoved = 0;
+        for(size_t i = 0; (i < tiles.size()) && (numRemoved < count); ) {
+            if(tiles[i] == location) {
+                tiles[i] = tiles.back();
+                tiles.pop_back();
+                numRemoved++;
+            } else {
+                i++;
+            }
+        }
+    }
+
+    std::vector<Entry>& bucket = buckets[getBucketIndex(location)];
+
+    for(size_t i = 0; i < bucket.size(); i++) {
+        if(bucket[i].objectID == objectID) {
+            bucket[i].count -= count;
+            if(bucket[i].count <= 0) {
+                // the order inside a bucket does not matter
+                bucket[i] = bucket.back();
+                bucket.pop_back();
+            }
+            return;
+        }
+    }
+}
+
+void SpatialObjectIndex::getObjectTiles(Uint32 objectID, std::vector<Coord>& tiles) const {
+    const ObjectTiles* pTilesOfObject = findObjectTiles(objectID);
+    if(pTilesOfObject != NULL) {
+        tiles.insert(tiles.end(), pTilesOfObject->tiles.begin(), pTilesOfObject->tiles.end());
+    }
+}
+
+const SpatialObjectIndex::ObjectTiles* SpatialObjectIndex::findObjectTiles(Uint32 objectID) const {
+    Uint32 slotIndex = objectID & OBJECTSLOTMASK;
+    if((slotIndex >= objectTiles.size()) || (objectTiles[slotIndex].objectID != objectID)) {
+        return NULL;
+    }
+    return &objectTiles[slotIndex];
+}
+
+ObjectBase* SpatialObjectIndex::findClosestTarget(const ObjectBase* pSearcher, int searchFlags) const {
+    if((pSearcher == NULL) || (numBucketsX <= 0) || (numBucketsY <= 0)) {
+        return NULL;
+    }
+
+    const Coord origin = pSearcher->getLocation();
+
+    // start searching in the bucket of the nearest tile on the map
+    const int startBucketX = std::min(std::max(origin.x, 0), mapSizeX-1) / SPATIALINDEXBUCKETSIZE;
+    const int startBucketY = std::min(std::max(origin.y, 0), mapSizeY-1) / SPATIALINDEXBUCKETSIZE;
+
+    ObjectBase* pClosestObject = NULL;
+    float closestDistance = INFINITY;
+
+    for(int ring = 0; ; ring++) {
+        // every tile inside a bucket of this ring is at least this far away (blockDistance() is never shorter than the chebyshev distance)
+        if((ring > 0) && ((float) ((ring-1)*SPATIALINDEXBUCKETSIZE + 1) > closestDistance)) {
+            break;
+        }
+
+        if((startBucketX - ring < 0) && (startBucketY - ring < 0) && (startBucketX + ring >= numBucketsX) && (startBucketY + ring >= numBucketsY)) {
+            // the whole map is already searched
+            break;
+        }
+
+        for(int by = std::max(startBucketY - ring, 0); by <= std::min(startBucketY + ring, numBucketsY-1); by++) {
+            const bool bFullRow = (by == startBucketY - ring) || (by == startBucketY + ring);
+            const int bxStep = bFullRow ? 1 : 2*ring;
+
+            for(int bx = startBucketX - ring; bx <= startBucketX + ring; bx += std::max(bxStep, 1)) {
+                if((bx < 0) || (bx >= numBucketsX)) {
+                    continue;
+                }
+
+                // skip the bucket if even its closest tile is farther away than the best target found so far
+                Coord closestTileInBucket(  std::min(std::max(origin.x, bx*SPATIALINDEXBUCKETSIZE), std::min((bx+1)*SPATIALINDEXBUCKETSIZE, mapSizeX) - 1),
+                                            std::min(std::max(origin.y, by*SPATIALINDEXBUCKETSIZE), std::min((by+1)*SPATIALINDEXBUCKETSIZE, mapSizeY) - 1));
+                if(blockDistance(origin, closestTileInBucket) > closestDistance) {
+                    continue;
+                }
+
+                const std::vector<Entry>& bucket = buckets[by*numBucketsX + bx];
+                std::vector<Entry>::const_iterator iter;
+                for(iter = bucket.begin(); iter != bucket.end(); ++iter) {
+                    ObjectBase* pObject = currentGame->getObjectManager().getObject(iter->objectID);
+
+                    if((pObject == NULL)
+                        || (pObject->isAStructure() && ((searchFlags & Search_Structures) == 0))
+                        || (!pObject->isAStructure() && ((searchFlags & Search_Units) == 0))
+                        || !pSearcher->canAttack(pObject)) {
+                        continue;
+                    }
+
+                    float distance = blockDistance(origin, pObject->getClosestPoint(origin));
+
+                    if(pObject->getItemID() == Structure_Wall) {
+                        distance += 20000000.0f; //so that walls are targeted very last
+                    }
+
+                    // break ties like a scan over the structure list and then the unit list (both in creation order) would
+                    bool bCloser;
+                    if(pClosestObject == NULL) {
+                        bCloser = (distance < closestDistance);
+                    } else if(distance != closestDistance) {
+                        bCloser = (distance < closestDistance);
+                    } else if(pObject->isAStructure() != pClosestObject->isAStructure()) {
+                        bCloser = pObject->isAStructure();
+                    } else {
+                        const ObjectManager& objectManager = currentGame->getObjectManager();
+                        bCloser = (objectManager.getCreationNumber(pObject->getObjectID()) < objectManager.getCreationNumber(pClosestObject->getObjectID()));
+                    }
+
+                    if(bCloser) {
+                        closestDistance = distance;
+                        pClosestObject = pObject;
+                    }
+                }
+            }
+        }
+    }
+
+    return pClosestObject;
+}
@@ -0,0 +1,153 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <SpiceIndex.h>
+
+#include <Map.h>
+#include <Tile.h>
+
+#include <stdlib.h>
+#include <limits.h>
+#include <algorithm>
+
+SpiceIndex::SpiceIndex(Map* pMap)
+ : pMap(pMap), sizeX(0), sizeY(0), numBucketsX(0), numBucketsY(0), numSpiceTiles(0) {
+}
+
+SpiceIndex::~SpiceIndex() {
+}
+
+void SpiceIndex::reset() {
+    sizeX = pMap->getSizeX();
+    sizeY = pMap->getSizeY();
+    numBucketsX = (sizeX + SPICEINDEXBUCKETSIZE - 1) / SPICEINDEXBUCKETSIZE;
+    numBucketsY = (sizeY + SPICEINDEXBUCKETSIZE - 1) / SPICEINDEXBUCKETSIZE;
+    numSpiceTiles = 0;
+
+    spiceFlags.clear();
+    spiceFlags.resize(sizeX*sizeY, false);
+    bucketCounts.clear();
+    bucketCounts.resize(numBucketsX*numBucketsY, 0);
+
+    for(int y = 0; y < sizeY; y++) {
+        for(int x = 0; x < sizeX; x++) {
+            if(pMap->getTile(x,y)->isSpice()) {
+                spiceFlags[y*sizeX + x] = true;
+                bucketCounts[getBucketIndex(x,y)]++;
+                numSpiceTiles++;
+            }
+        }
+    }
+}
+
+void SpiceIndex::onTerrainChanged(const Coord& location) {
+    if(!pMap->tileExists(location) || spiceFlags.empty()) {
+        return;
+    }
+
+    const bool bSpice = pMap->getTile(location)->isSpice();
+    const int tileIndex = location.y*sizeX + location.x;
+
+    if(spiceFlags[tileIndex] != bSpice) {
+        spiceFlags[tileIndex] = bSpice;
+
+        const int delta = bSpice ? 1 : -1;
+        bucketCounts[getBucketIndex(location.x, location.y)] += delta;
+        numSpiceTiles += delta;
+    }
+}
+
+Coord SpiceIndex::findNearestSpice(const Coord& origin, bool bFreeTilesOnly, bool bExcludeOrigin) const {
+    if((numSpiceTiles <= 0) || (numBucketsX <= 0) || (numBucketsY <= 0)) {
+        return Coord::Invalid();
+    }
+
+    // start searching in the bucket of the nearest tile on the map
+    const int startBucketX = std::min(std::max(origin.x, 0), sizeX-1) / SPICEINDEXBUCKETSIZE;
+    const int startBucketY = std::min(std::max(origin.y, 0), sizeY-1) / SPICEINDEXBUCKETSIZE;
+
+    int closestTileIndex = -1;
+    int closestDistance = INT_MAX;
+
+    for(int ring = 0; ; ring++) {
+        // every tile inside a bucket of this ring is at least this far away
+        if((ring > 0) && ((ring-1)*SPICEINDEXBUCKETSIZE + 1 > closestDistance)) {
+            break;
+        }
+
+        if((startBucketX - ring < 0) && (startBucketY - ring < 0) && (startBucketX + ring >= numBucketsX) && (startBucketY + ring >= numBucketsY)) {
+            // the whole map is already searched
+            break;
+        }
+
+        for(int by = std::max(startBucketY - ring, 0); by <= std::min(startBucketY + ring, numBucketsY-1); by++) {
+            const bool bFullRow = (by == startBucketY - ring) || (by == startBucketY + ring);
+            const int bxStep = bFullRow ? 1 : 2*ring;
+
+            for(int bx = startBucketX - ring; bx <= startBucketX + ring; bx += std::max(bxStep, 1)) {
+                if((bx < 0) || (bx >= numBucketsX) || (bucketCounts[by*numBucketsX + bx] == 0)) {
+                    continue;
+                }
+
+                const int minX = bx*SPICEINDEXBUCKETSIZE;
+                const int maxX = std::min((bx+1)*SPICEINDEXBUCKETSIZE, sizeX) - 1;
+                const int minY = by*SPICEINDEXBUCKETSIZE;
+                const int maxY = std::min((by+1)*SPICEINDEXBUCKETSIZE, sizeY) - 1;
+
+                // skip the bucket if even its closest tile is farther away than the best tile found so far
+                const int bucketDistance = std::max(abs(std::min(std::max(origin.x, minX), maxX) - origin.x),
+                                                    abs(std::min(std::max(origin.y, minY), maxY) - origin.y));
+                if(bucketDistance > closestDistance) {
+                    continue;
+                }
+
+                for(int y = minY; y <= maxY; y++) {
+                    for(int x = minX; x <= maxX; x++) {
+                        const int tileIndex = y*sizeX + x;
+                        if(spiceFlags[tileIndex] == false) {
+                            continue;
+                        }
+
+                        const int distance = std::max(abs(x - origin.x), abs(y - origin.y));
+                        if((distance > closestDistance) || ((distance == closestDistance) && (tileIndex > closestTileIndex))) {
+                            continue;
+                        }
+
+                        if(bExcludeOrigin && (distance == 0)) {
+                            continue;
+                        }
+
+                        const Tile* pTile = pMap->getTile(x,y);
+                        if(!pTile->hasSpice() || (bFreeTilesOnly && pTile->hasAGroundObject())) {
+                            continue;
+                        }
+
+                        closestDistance = distance;
+                        closestTileIndex = tileIndex;
+                    }
+                }
+            }
+        }
+    }
+
+    if(closestTileIndex < 0) {
+        return Coord::Invalid();
+    }
+
+    return Coord(closestTileIndex % sizeX, closestTileIndex / sizeX);
+}
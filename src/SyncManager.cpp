@@ -0,0 +1,288 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <SyncManager.h>
+
+#include <globals.h>
+
+#include <FileClasses/TextManager.h>
+#include <misc/string_util.h>
+
+#include <Game.h>
+#include <House.h>
+#include <ObjectBase.h>
+#include <units/UnitBase.h>
+#include <structures/StructureBase.h>
+#include <Network/NetworkManager.h>
+#include <sand.h>
+
+#include <algorithm>
+#include <set>
+#include <string.h>
+
+#define FNVOFFSETBASIS  2166136261u
+#define FNVPRIME        16777619u
+
+/**
+    Adds a value to a FNV-1a hash.
+    \param  hash    the hash so far
+    \param  value   the value to add
+    \return the new hash
+*/
+static inline Uint32 hashUint32(Uint32 hash, Uint32 value) {
+    for(int i = 0; i < 4; i++) {
+        hash ^= (value >> (8*i)) & 0xFF;
+        hash *= FNVPRIME;
+    }
+    return hash;
+}
+
+/**
+    Adds the bit pattern of a float to a FNV-1a hash.
+    \param  hash    the hash so far
+    \param  value   the value to add
+    \return the new hash
+*/
+static inline Uint32 hashFloat(Uint32 hash, float value) {
+    Uint32 bits;
+    memcpy(&bits, &value, sizeof(Uint32));
+    return hashUint32(hash, bits);
+}
+
+/**
+    Computes the hash of the simulation relevant state of an object.
+    \param  pObject the object to hash
+    \return the hash
+*/
+static Uint32 hashObject(const ObjectBase* pObject) {
+    Uint32 hash = FNVOFFSETBASIS;
+    hash = hashUint32(hash, pObject->getObjectID());
+    hash = hashUint32(hash, pObject->getItemID());
+    hash = hashUint32(hash, pObject->getOwner()->getHouseID());
+    hash = hashUint32(hash, pObject->getLocation().x);
+    hash = hashUint32(hash, pObject->getLocation().y);
+    hash = hashUint32(hash, pObject->getRealX().getRaw());
+    hash = hashUint32(hash, pObject->getRealY().getRaw());
+    hash = hashFloat(hash, pObject->getHealth());
+    hash = hashUint32(hash, pObject->getDestination().x);
+    hash = hashUint32(hash, pObject->getDestination().y);
+    hash = hashUint32(hash, (pObject->getTarget() != NULL) ? pObject->getTarget()->getObjectID() : NONE);
+    return hash;
+}
+
+SyncManager::SyncManager() : bDesync(false) {
+}
+
+SyncManager::~SyncManager() {
+}
+
+void SyncManager::update(Uint32 gameCycle) {
+    if(bDesync || (pNetworkManager == NULL) || (gameCycle % SYNCCHECKINTERVAL != 0)) {
+        return;
+    }
+
+    checkpoints.push_back(Checkpoint());
+    if(checkpoints.size() > SYNCCHECKMAXCHECKPOINTS) {
+        checkpoints.pop_front();
+    }
+
+    Checkpoint& checkpoint = checkpoints.back();
+    computeCheckpoint(checkpoint);
+
+    pNetworkManager->sendSyncCheck(checkpoint.cycle, checkpoint.hash);
+
+    // compare with the peers that were faster than us
+    std::multimap<Uint32, std::pair<std::string, Uint32> >::iterator iter = remoteHashes.begin();
+    while(iter != remoteHashes.end()) {
+        if(iter->first == checkpoint.cycle) {
+            compareHash(iter->second.first, checkpoint, iter->second.second);
+        }
+
+        if(iter->first <= checkpoint.cycle) {
+            remoteHashes.erase(iter++);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void SyncManager::onReceiveSyncCheck(const std::string& peerName, Uint32 cycle, Uint32 hash) {
+    if(bDesync) {
+        return;
+    }
+
+    const Checkpoint* pCheckpoint = getCheckpoint(cycle);
+    if(pCheckpoint != NULL) {
+        compareHash(peerName, *pCheckpoint, hash);
+    } else if(checkpoints.empty() || (cycle > checkpoints.back().cycle)) {
+        // we have not reached this game cycle yet
+        remoteHashes.insert(std::make_pair(cycle, std::make_pair(peerName, hash)));
+    }
+}
+
+void SyncManager::onReceiveSyncRequest(const std::string& peerName, Uint32 cycle, Sint32 bucket) {
+    const Checkpoint* pCheckpoint = getCheckpoint(cycle);
+    if((pCheckpoint == NULL) || (pNetworkManager == NULL) || (bucket >= SYNCCHECKBUCKETS)) {
+        return;
+    }
+
+    std::vector<Uint32> hashes;
+    if(bucket < 0) {
+        hashes.push_back(pCheckpoint->houseHash);
+        hashes.insert(hashes.end(), pCheckpoint->bucketHashes, pCheckpoint->bucketHashes + SYNCCHECKBUCKETS);
+    } else {
+        std::vector< std::pair<Uint32, Uint32> >::const_iterator iter;
+        for(iter = pCheckpoint->objectHashes.begin(); iter != pCheckpoint->objectHashes.end(); ++iter) {
+            if((Sint32) (iter->first & (SYNCCHECKBUCKETS - 1)) == bucket) {
+                hashes.push_back(iter->first);
+                hashes.push_back(iter->second);
+            }
+        }
+    }
+
+    pNetworkManager->sendSyncResponse(peerName, cycle, bucket, hashes);
+}
+
+void SyncManager::onReceiveSyncResponse(const std::string& peerName, Uint32 cycle, Sint32 bucket, const std::vector<Uint32>& hashes) {
+    const Checkpoint* pCheckpoint = getCheckpoint(cycle);
+    if((pCheckpoint == NULL) || (pNetworkManager == NULL)) {
+        fprintf(stderr, "SyncManager: The game state of game cycle %d is not available anymore!\n", cycle);
+        return;
+    }
+
+    if(bucket < 0) {
+        if(hashes.size() != SYNCCHECKBUCKETS + 1) {
+            return;
+        }
+
+        if(hashes[0] != pCheckpoint->houseHash) {
+            fprintf(stderr, "SyncManager: The credits of the houses or the random generator differ from '%s' in game cycle %d!\n", peerName.c_str(), cycle);
+        }
+
+        // narrow the search down to the buckets that differ
+        for(int i = 0; i < SYNCCHECKBUCKETS; i++) {
+            if(hashes[i+1] != pCheckpoint->bucketHashes[i]) {
+                pNetworkManager->sendSyncRequest(peerName, cycle, i);
+            }
+        }
+    } else {
+        std::map<Uint32, Uint32> remoteObjectHashes;
+        for(size_t i = 0; i + 1 < hashes.size(); i += 2) {
+            remoteObjectHashes[hashes[i]] = hashes[i+1];
+        }
+
+        std::set<Uint32> objectIDs;
+        std::vector< std::pair<Uint32, Uint32> >::const_iterator iter;
+        for(iter = pCheckpoint->objectHashes.begin(); iter != pCheckpoint->objectHashes.end(); ++iter) {
+            if((Sint32) (iter->first & (SYNCCHECKBUCKETS - 1)) != bucket) {
+                continue;
+            }
+
+            std::map<Uint32, Uint32>::iterator remoteIter = remoteObjectHashes.find(iter->first);
+            if(remoteIter == remoteObjectHashes.end()) {
+                objectIDs.insert(iter->first);
+            } else {
+                if(remoteIter->second != iter->second) {
+                    objectIDs.insert(iter->first);
+                }
+                remoteObjectHashes.erase(remoteIter);
+            }
+        }
+
+        // the remaining objects only exist on the peer
+        std::map<Uint32, Uint32>::const_iterator remoteIter;
+        for(remoteIter = remoteObjectHashes.begin(); remoteIter != remoteObjectHashes.end(); ++remoteIter) {
+            objectIDs.insert(remoteIter->first);
+        }
+
+        std::set<Uint32>::const_iterator idIter;
+        for(idIter = objectIDs.begin(); idIter != objectIDs.end(); ++idIter) {
+            // the object may have changed since the sync check but it is only printed to get an idea what went wrong
+            ObjectBase* pObject = currentGame->getObjectManager().getObject(*idIter);
+            if(pObject == NULL) {
+                fprintf(stderr, "SyncManager: Object %d differs from '%s' in game cycle %d (not existing anymore)\n", *idIter, peerName.c_str(), cycle);
+            } else {
+                fprintf(stderr, "SyncManager: Object %d differs from '%s' in game cycle %d: %s of house %d at (%d,%d) with health %f\n",
+                        *idIter, peerName.c_str(), cycle, getItemNameByID(pObject->getItemID()).c_str(), pObject->getOwner()->getHouseID(),
+                        pObject->getLocation().x, pObject->getLocation().y, pObject->getHealth());
+            }
+        }
+    }
+}
+
+void SyncManager::computeCheckpoint(Checkpoint& checkpoint) {
+    checkpoint.cycle = currentGame->getGameCycleCount();
+
+    checkpoint.houseHash = hashUint32(FNVOFFSETBASIS, currentGame->randomGen.getSeed());
+    for(int i = 0; i < NUM_HOUSES; i++) {
+        House* pHouse = currentGame->getHouse(i);
+        if(pHouse != NULL) {
+            checkpoint.houseHash = hashUint32(checkpoint.houseHash, i);
+            checkpoint.houseHash = hashFloat(checkpoint.houseHash, pHouse->getStoredCredits());
+            checkpoint.houseHash = hashFloat(checkpoint.houseHash, pHouse->getStartingCredits());
+        }
+    }
+
+    checkpoint.objectHashes.clear();
+    for(DenseList<UnitBase*>::const_iterator iter = unitList.begin(); iter != unitList.end(); ++iter) {
+        checkpoint.objectHashes.push_back(std::make_pair((*iter)->getObjectID(), hashObject(*iter)));
+    }
+    for(DenseList<StructureBase*>::const_iterator iter = structureList.begin(); iter != structureList.end(); ++iter) {
+        checkpoint.objectHashes.push_back(std::make_pair((*iter)->getObjectID(), hashObject(*iter)));
+    }
+    std::sort(checkpoint.objectHashes.begin(), checkpoint.objectHashes.end());
+
+    for(int i = 0; i < SYNCCHECKBUCKETS; i++) {
+        checkpoint.bucketHashes[i] = FNVOFFSETBASIS;
+    }
+
+    std::vector< std::pair<Uint32, Uint32> >::const_iterator iter;
+    for(iter = checkpoint.objectHashes.begin(); iter != checkpoint.objectHashes.end(); ++iter) {
+        Uint32& bucketHash = checkpoint.bucketHashes[iter->first & (SYNCCHECKBUCKETS - 1)];
+        bucketHash = hashUint32(bucketHash, iter->first);
+        bucketHash = hashUint32(bucketHash, iter->second);
+    }
+
+    checkpoint.hash = hashUint32(FNVOFFSETBASIS, checkpoint.houseHash);
+    for(int i = 0; i < SYNCCHECKBUCKETS; i++) {
+        checkpoint.hash = hashUint32(checkpoint.hash, checkpoint.bucketHashes[i]);
+    }
+}
+
+const SyncManager::Checkpoint* SyncManager::getCheckpoint(Uint32 cycle) const {
+    std::deque<Checkpoint>::const_iterator iter;
+    for(iter = checkpoints.begin(); iter != checkpoints.end(); ++iter) {
+        if(iter->cycle == cycle) {
+            return &(*iter);
+        }
+    }
+    return NULL;
+}
+
+void SyncManager::compareHash(const std::string& peerName, const Checkpoint& checkpoint, Uint32 hash) {
+    if(bDesync || (hash == checkpoint.hash)) {
+        return;
+    }
+
+    bDesync = true;
+
+    fprintf(stderr, "SyncManager: Game is asynchronous in game cycle %d! The game state hash of '%s' differs: %.8X != %.8X\n", checkpoint.cycle, peerName.c_str(), hash, checkpoint.hash);
+    currentGame->addToNewsTicker(strprintf(_("Game is out of sync with '%s'!"), peerName.c_str()));
+
+    pNetworkManager->sendSyncRequest(peerName, checkpoint.cycle, -1);
+}
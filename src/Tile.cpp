@@ -27,7 +27,7 @@
 #include <House.h>
 #include <SoundPlayer.h>
 #include <ScreenBorder.h>
-#include <ConcatIterator.h>
+#include <RenderList.h>
 #include <Explosion.h>
 
 #include <structures/StructureBase.h>
@@ -201,28 +201,32 @@ void Tile::save(OutputStream& stream) const {
     }
 
     if(!assignedAirUnitList.empty()) {
-        stream.writeUint32List(assignedAirUnitList);
+        stream.writeUint32List(assignedAirUnitList.toList());
     }
 
 	if(!assignedInfantryList.empty()) {
-        stream.writeUint32List(assignedInfantryList);
+        stream.writeUint32List(assignedInfantryList.toList());
 	}
 
 	if(!assignedUndergroundUnitList.empty()) {
-	    stream.writeUint32List(assignedUndergroundUnitList);
+	    stream.writeUint32List(assignedUndergroundUnitList.toList());
 	}
 
 	if(!assignedNonInfantryGroundObjectList.empty()) {
-	    stream.writeUint32List(assignedNonInfantryGroundObjectList);
+	    stream.writeUint32List(assignedNonInfantryGroundObjectList.toList());
 	}
 }
 
 void Tile::assignAirUnit(Uint32 newObjectID) {
 	assignedAirUnitList.push_back(newObjectID);
+	currentGameMap->getSpatialObjectIndex().addObject(location, newObjectID);
+	currentGameMap->getRadarTileTracker().setTileDirty(location);
 }
 
 void Tile::assignNonInfantryGroundObject(Uint32 newObjectID) {
 	assignedNonInfantryGroundObjectList.push_back(newObjectID);
+	currentGameMap->getSpatialObjectIndex().addObject(location, newObjectID);
+	currentGameMap->getRadarTileTracker().setTileDirty(location);
 }
 
 int Tile::assignInfantry(Uint32 newObjectID, Sint8 currentPosition) {
@@ -235,7 +239,7 @@ int Tile::assignInfantry(Uint32 newObjectID, Sint8 currentPosition) {
 			used[i] = false;
 
 
-		std::list<Uint32>::const_iterator iter;
+		InfantryList::const_iterator iter;
 		for(iter = assignedInfantryList.begin(); iter != assignedInfantryList.end() ;++iter) {
 			InfantryBase* infant = (InfantryBase*) currentGame->getObjectManager().getObject(*iter);
 			if(infant == NULL) {
@@ -258,12 +262,33 @@ int Tile::assignInfantry(Uint32 newObjectID, Sint8 currentPosition) {
 	}
 
 	assignedInfantryList.push_back(newObjectID);
+	currentGameMap->getSpatialObjectIndex().addObject(location, newObjectID);
+	currentGameMap->getRadarTileTracker().setTileDirty(location);
 	return i;
 }
 
 
 void Tile::assignUndergroundUnit(Uint32 newObjectID) {
 	assignedUndergroundUnitList.push_back(newObjectID);
+	currentGameMap->getSpatialObjectIndex().addObject(location, newObjectID);
+	currentGameMap->getRadarTileTracker().setTileDirty(location);
+}
+
+void Tile::addObjectsToIndex(SpatialObjectIndex& index) const {
+	std::vector<Uint32> objectIDs;
+	getObjectIDs(objectIDs);
+
+	std::vector<Uint32>::const_iterator iter;
+	for(iter = objectIDs.begin(); iter != objectIDs.end(); ++iter) {
+		index.addObject(location, *iter);
+	}
+}
+
+void Tile::getObjectIDs(std::vector<Uint32>& objectIDs) const {
+	objectIDs.insert(objectIDs.end(), assignedInfantryList.begin(), assignedInfantryList.end());
+	objectIDs.insert(objectIDs.end(), assignedNonInfantryGroundObjectList.begin(), assignedNonInfantryGroundObjectList.end());
+	objectIDs.insert(objectIDs.end(), assignedUndergroundUnitList.begin(), assignedUndergroundUnitList.end());
+	objectIDs.insert(objectIDs.end(), assignedAirUnitList.begin(), assignedAirUnitList.end());
 }
 
 void Tile::blitGround(int xPos, int yPos) {
@@ -311,44 +336,6 @@ void Tile::blitGround(int xPos, int yPos) {
 
 }
 
-void Tile::blitStructures(int xPos, int yPos) {
-	if (hasANonInfantryGroundObject() && getNonInfantryGroundObject()->isAStructure()) {
-		//if got a structure, draw the structure, and dont draw any terrain because wont be seen
-		bool	done = false;	//only draw it once
-		StructureBase* structure = (StructureBase*) getNonInfantryGroundObject();
-
-		for(int i = structure->getX(); (i < structure->getX() + structure->getStructureSizeX()) && !done;  i++) {
-            for(int j = structure->getY(); (j < structure->getY() + structure->getStructureSizeY()) && !done;  j++) {
-                if(screenborder->isTileInsideScreen(Coord(i,j))
-                    && currentGameMap->tileExists(i, j) && (currentGameMap->getTile(i, j)->isExplored(pLocalHouse->getHouseID()) || debug))
-                {
-
-                    structure->setFogged(isFogged(pLocalHouse->getHouseID()));
-
-                    if ((i == location.x) && (j == location.y)) {
-                        //only this tile will draw it, so will be drawn only once
-                        structure->blitToScreen();
-                    }
-
-                    done = true;
-                }
-            }
-        }
-	}
-}
-
-void Tile::blitUndergroundUnits(int xPos, int yPos) {
-	if(hasAnUndergroundUnit() && !isFogged(pLocalHouse->getHouseID())) {
-	    UnitBase* current = getUndergroundUnit();
-
-	    if(current->isVisible(pLocalHouse->getTeam())) {
-		    if(location == current->getLocation()) {
-                current->blitToScreen();
-		    }
-		}
-	}
-}
-
 void Tile::blitDeadUnits(int xPos, int yPos) {
 	if(!isFogged(pLocalHouse->getHouseID())) {
 	    for(std::vector<DEADUNITTYPE>::const_iterator iter = deadUnits.begin(); iter != deadUnits.end(); ++iter) {
@@ -404,146 +391,120 @@ void Tile::blitDeadUnits(int xPos, int yPos) {
 	}
 }
 
-void Tile::blitInfantry(int xPos, int yPos) {
-	if(hasInfantry() && !isFogged(pLocalHouse->getHouseID())) {
-		std::list<Uint32>::const_iterator iter;
-		for(iter = assignedInfantryList.begin(); iter != assignedInfantryList.end() ;++iter) {
-			InfantryBase* current = (InfantryBase*) currentGame->getObjectManager().getObject(*iter);
+/**
+    Adds all objects in [first, last) to a layer of renderList that are visible for the local player and located at location.
+    \param renderList  the render list to add the objects to
+    \param layer       the layer to add the objects to
+    \param first       the first object id
+    \param last        the end of the object ids
+    \param location    the location of the tile
+*/
+static void addVisibleObjects(RenderList& renderList, RenderList::RENDERLAYER layer, const Uint32* first, const Uint32* last, const Coord& location) {
+    for(const Uint32* pObjectID = first; pObjectID != last; ++pObjectID) {
+        ObjectBase* current = currentGame->getObjectManager().getObject(*pObjectID);
+
+        if((current != NULL) && current->isVisible(pLocalHouse->getTeam()) && (location == current->getLocation())) {
+            renderList.addObject(layer, current);
+        }
+    }
+}
 
-			if(current == NULL) {
-				continue;
-			}
+void Tile::addToRenderList(RenderList& renderList, int xPos, int yPos) {
+    const int localHouseID = pLocalHouse->getHouseID();
+    const bool bFogged = isFogged(localHouseID);
 
-			if(current->isVisible(pLocalHouse->getTeam())) {
-			    if(location == current->getLocation()) {
-                    current->blitToScreen();
-			    }
-			}
-		}
-	}
-}
+    renderList.addTile(RenderList::RenderLayer_Ground, this, xPos, yPos);
 
-void Tile::blitNonInfantryGroundUnits(int xPos, int yPos) {
-	if(hasANonInfantryGroundObject() && !isFogged(pLocalHouse->getHouseID())) {
-        std::list<Uint32>::const_iterator iter;
-		for(iter = assignedNonInfantryGroundObjectList.begin(); iter != assignedNonInfantryGroundObjectList.end() ;++iter) {
-			ObjectBase* current =  currentGame->getObjectManager().getObject(*iter);
+    if (hasANonInfantryGroundObject() && getNonInfantryGroundObject()->isAStructure()) {
+		//if got a structure, draw the structure, and dont draw any terrain because wont be seen
+		bool	done = false;	//only draw it once
+		StructureBase* structure = (StructureBase*) getNonInfantryGroundObject();
 
-            if(current->isAUnit() && current->isVisible(pLocalHouse->getTeam())) {
-                if(location == current->getLocation()) {
-                    current->blitToScreen();
+		for(int i = structure->getX(); (i < structure->getX() + structure->getStructureSizeX()) && !done;  i++) {
+            for(int j = structure->getY(); (j < structure->getY() + structure->getStructureSizeY()) && !done;  j++) {
+                if(screenborder->isTileInsideScreen(Coord(i,j))
+                    && currentGameMap->tileExists(i, j) && (currentGameMap->getTile(i, j)->isExplored(localHouseID) || debug))
+                {
+                    if ((i == location.x) && (j == location.y)) {
+                        //only this tile will draw it, so will be drawn only once
+                        renderList.addObject(RenderList::RenderLayer_Structures, structure, bFogged);
+                    }
+
+                    done = true;
                 }
             }
-		}
+        }
 	}
-}
-
 
-void Tile::blitAirUnits(int xPos, int yPos) {
-	if(hasAnAirUnit()) {
-		std::list<Uint32>::const_iterator iter;
-		for(iter = assignedAirUnitList.begin(); iter != assignedAirUnitList.end() ;++iter) {
-			AirUnit* airUnit = (AirUnit*) currentGame->getObjectManager().getObject(*iter);
-
-			if(airUnit == NULL) {
-				continue;
-			}
+    if(bFogged == false) {
+        if(hasAnUndergroundUnit()) {
+            addVisibleObjects(renderList, RenderList::RenderLayer_UndergroundUnits, assignedUndergroundUnitList.begin(), assignedUndergroundUnitList.begin() + 1, location);
+        }
 
-			if(!isFogged(pLocalHouse->getHouseID()) || airUnit->getOwner() == pLocalHouse) {
-                if(airUnit->isVisible(pLocalHouse->getTeam())) {
-                    if(location == airUnit->getLocation()) {
-                        airUnit->blitToScreen();
-                    }
-                }
-			}
-		}
-	}
-}
+        if(!deadUnits.empty()) {
+            renderList.addTile(RenderList::RenderLayer_DeadUnits, this, xPos, yPos);
+        }
 
-void Tile::blitSelectionRects(int xPos, int yPos) {
-    // draw underground selection rectangles
-    if(hasAnUndergroundUnit() && !isFogged(pLocalHouse->getHouseID())) {
-	    UnitBase* current = getUndergroundUnit();
+        addVisibleObjects(renderList, RenderList::RenderLayer_Infantry, assignedInfantryList.begin(), assignedInfantryList.end(), location);
 
-        if(current != NULL) {
-            if(current->isVisible(pLocalHouse->getTeam()) && (location == current->getLocation())) {
-                if(current->isSelected()) {
-                    current->drawSelectionBox();
-                }
+        ObjectList::const_iterator iter;
+        for(iter = assignedNonInfantryGroundObjectList.begin(); iter != assignedNonInfantryGroundObjectList.end(); ++iter) {
+            ObjectBase* current = currentGame->getObjectManager().getObject(*iter);
 
-                if(current->isSelectedByOtherPlayer()) {
-                    current->drawOtherPlayerSelectionBox();
-                }
+            if((current != NULL) && current->isAUnit() && current->isVisible(pLocalHouse->getTeam()) && (location == current->getLocation())) {
+                renderList.addObject(RenderList::RenderLayer_NonInfantryGroundUnits, current);
             }
         }
-	}
-
+    }
 
-    // draw infantry selection rectangles
-    if(hasInfantry() && !isFogged(pLocalHouse->getHouseID())) {
-		std::list<Uint32>::const_iterator iter;
-		for(iter = assignedInfantryList.begin(); iter != assignedInfantryList.end() ;++iter) {
-			InfantryBase* current = dynamic_cast<InfantryBase*>(currentGame->getObjectManager().getObject(*iter));
+    ObjectList::const_iterator airIter;
+    for(airIter = assignedAirUnitList.begin(); airIter != assignedAirUnitList.end(); ++airIter) {
+        ObjectBase* airUnit = currentGame->getObjectManager().getObject(*airIter);
 
-			if(current == NULL) {
-				continue;
-			}
-
-            if(current->isVisible(pLocalHouse->getTeam()) && (location == current->getLocation())) {
-                if(current->isSelected()) {
-                    current->drawSelectionBox();
-                }
+        if(airUnit == NULL) {
+            continue;
+        }
 
-                if(current->isSelectedByOtherPlayer()) {
-                    current->drawOtherPlayerSelectionBox();
-                }
+        if(!bFogged || airUnit->getOwner() == pLocalHouse) {
+            if(airUnit->isVisible(pLocalHouse->getTeam()) && (location == airUnit->getLocation())) {
+                renderList.addObject(RenderList::RenderLayer_AirUnits, airUnit);
             }
-		}
-	}
+        }
+    }
 
-    // draw non infantry ground object selection rectangles
-	if(hasANonInfantryGroundObject() && !isFogged(pLocalHouse->getHouseID())) {
-	    std::list<Uint32>::const_iterator iter;
-		for(iter = assignedNonInfantryGroundObjectList.begin(); iter != assignedNonInfantryGroundObjectList.end() ;++iter) {
-            ObjectBase* current = currentGame->getObjectManager().getObject(*iter);
+    // selection rectangles of underground units, infantry, non infantry ground objects and air units (in this order)
+    if(!bFogged && (debug || isExplored(localHouseID))) {
+        if(hasAnUndergroundUnit()) {
+            addVisibleObjects(renderList, RenderList::RenderLayer_SelectionRects, assignedUndergroundUnitList.begin(), assignedUndergroundUnitList.begin() + 1, location);
+        }
+        addVisibleObjects(renderList, RenderList::RenderLayer_SelectionRects, assignedInfantryList.begin(), assignedInfantryList.end(), location);
+        addVisibleObjects(renderList, RenderList::RenderLayer_SelectionRects, assignedNonInfantryGroundObjectList.begin(), assignedNonInfantryGroundObjectList.end(), location);
+        addVisibleObjects(renderList, RenderList::RenderLayer_SelectionRects, assignedAirUnitList.begin(), assignedAirUnitList.end(), location);
+    }
+}
 
-            if(current == NULL) {
-				continue;
-			}
 
-            if(current->isVisible(pLocalHouse->getTeam()) && (location == current->getLocation())) {
-                if(current->isSelected()) {
-                    current->drawSelectionBox();
-                }
+void Tile::assignDeadUnit(Uint8 type, Uint8 house, const Coord& position) {
+    DEADUNITTYPE newDeadUnit;
+    newDeadUnit.type = type;
+    newDeadUnit.house = house;
+    newDeadUnit.onSand = isSand() || isDunes();
+    newDeadUnit.realPos = position;
+    newDeadUnit.timer = 2000;
 
-                if(current->isSelectedByOtherPlayer()) {
-                    current->drawOtherPlayerSelectionBox();
-                }
-            }
-		}
-	}
+    deadUnits.push_back(newDeadUnit);
 
-    // draw air unit selection rectangles
-	if(hasAnAirUnit() && !isFogged(pLocalHouse->getHouseID())) {
-		std::list<Uint32>::const_iterator iter;
-		for(iter = assignedAirUnitList.begin(); iter != assignedAirUnitList.end() ;++iter) {
-			AirUnit* airUnit = dynamic_cast<AirUnit*>(currentGame->getObjectManager().getObject(*iter));
+    currentGameMap->addActiveTile(location);
+}
 
-			if(airUnit == NULL) {
-				continue;
-			}
 
-            if(airUnit->isVisible(pLocalHouse->getTeam()) && (location == airUnit->getLocation())) {
-                if(airUnit->isSelected()) {
-                    airUnit->drawSelectionBox();
-                }
+void Tile::setTrack(Uint8 direction) {
+    if(type == Terrain_Sand || type == Terrain_Dunes
+        || type == Terrain_Spice || type == Terrain_ThickSpice) {
+        tracksCounter[direction] = 5000;
 
-                if(airUnit->isSelectedByOtherPlayer()) {
-                    airUnit->drawOtherPlayerSelectionBox();
-                }
-            }
-		}
-	}
+        currentGameMap->addActiveTile(location);
+    }
 }
 
 
@@ -554,14 +515,12 @@ void Tile::clearTerrain() {
 
 
 void Tile::selectAllPlayersUnits(int houseID, ObjectBase** lastCheckedObject, ObjectBase** lastSelectedObject) {
-	ConcatIterator<Uint32> iterator;
-	iterator.addList(assignedInfantryList);
-	iterator.addList(assignedNonInfantryGroundObjectList);
-	iterator.addList(assignedUndergroundUnitList);
-	iterator.addList(assignedAirUnitList);
-
-	while(!iterator.isIterationFinished()) {
-		*lastCheckedObject = currentGame->getObjectManager().getObject(*iterator);
+	std::vector<Uint32> objectIDs;
+	getObjectIDs(objectIDs);
+
+	std::vector<Uint32>::const_iterator iter;
+	for(iter = objectIDs.begin(); iter != objectIDs.end(); ++iter) {
+		*lastCheckedObject = currentGame->getObjectManager().getObject(*iter);
 		if (((*lastCheckedObject)->getOwner()->getHouseID() == houseID)
 			&& !(*lastCheckedObject)->isSelected()
 			&& (*lastCheckedObject)->isAUnit()
@@ -572,20 +531,17 @@ void Tile::selectAllPlayersUnits(int houseID, ObjectBase** lastCheckedObject, Ob
 			currentGame->selectionChanged();
 			*lastSelectedObject = *lastCheckedObject;
 		}
-		++iterator;
 	}
 }
 
 
 void Tile::selectAllPlayersUnitsOfType(int houseID, int itemID, ObjectBase** lastCheckedObject, ObjectBase** lastSelectedObject) {
-	ConcatIterator<Uint32> iterator;
-	iterator.addList(assignedInfantryList);
-	iterator.addList(assignedNonInfantryGroundObjectList);
-	iterator.addList(assignedUndergroundUnitList);
-	iterator.addList(assignedAirUnitList);
-
-	while(!iterator.isIterationFinished()) {
-		*lastCheckedObject = currentGame->getObjectManager().getObject(*iterator);
+	std::vector<Uint32> objectIDs;
+	getObjectIDs(objectIDs);
+
+	std::vector<Uint32>::const_iterator iter;
+	for(iter = objectIDs.begin(); iter != objectIDs.end(); ++iter) {
+		*lastCheckedObject = currentGame->getObjectManager().getObject(*iter);
 		if (((*lastCheckedObject)->getOwner()->getHouseID() == houseID)
 			&& !(*lastCheckedObject)->isSelected()
 			&& ((*lastCheckedObject)->getItemID() == itemID)) {
@@ -595,26 +551,35 @@ void Tile::selectAllPlayersUnitsOfType(int houseID, int itemID, ObjectBase** las
 			currentGame->selectionChanged();
 			*lastSelectedObject = *lastCheckedObject;
 		}
-		++iterator;
 	}
 }
 
 
+template<int N>
+void Tile::unassignFromList(TileObjectList<N>& objectList, Uint32 objectID) {
+	unsigned int numRemoved = objectList.remove(objectID);
+
+	if(numRemoved > 0) {
+		currentGameMap->getSpatialObjectIndex().removeObject(location, objectID, numRemoved);
+		currentGameMap->getRadarTileTracker().setTileDirty(location);
+	}
+}
+
 void Tile::unassignAirUnit(Uint32 objectID) {
-	assignedAirUnitList.remove(objectID);
+	unassignFromList(assignedAirUnitList, objectID);
 }
 
 
 void Tile::unassignNonInfantryGroundObject(Uint32 objectID) {
-	assignedNonInfantryGroundObjectList.remove(objectID);
+	unassignFromList(assignedNonInfantryGroundObjectList, objectID);
 }
 
 void Tile::unassignUndergroundUnit(Uint32 objectID) {
-	assignedUndergroundUnitList.remove(objectID);
+	unassignFromList(assignedUndergroundUnitList, objectID);
 }
 
 void Tile::unassignInfantry(Uint32 objectID, int currentPosition) {
-	assignedInfantryList.remove(objectID);
+	unassignFromList(assignedInfantryList, objectID);
 }
 
 void Tile::unassignObject(Uint32 objectID) {
@@ -639,9 +604,11 @@ void Tile::setType(int newType) {
 		if (isRock()) {
 			sandRegion = NONE;
 			if (hasAnUndergroundUnit())	{
+				// iterate over a copy as the list is changed while destroying the units
+				const ObjectList undergroundUnits = assignedUndergroundUnitList;
 				ObjectBase* current;
-				std::list<Uint32>::const_iterator iter;
-				iter = assignedUndergroundUnitList.begin();
+				ObjectList::const_iterator iter;
+				iter = undergroundUnits.begin();
 
 				do {
 					current = currentGame->getObjectManager().getObject(*iter);
@@ -652,14 +619,15 @@ void Tile::setType(int newType) {
 
 					unassignUndergroundUnit(current->getObjectID());
 					current->destroy();
-				} while(iter != assignedUndergroundUnitList.end());
+				} while(iter != undergroundUnits.end());
 			}
 
 			if(type == Terrain_Mountain) {
 				if(hasANonInfantryGroundObject()) {
+					const ObjectList nonInfantryGroundObjects = assignedNonInfantryGroundObjectList;
 					ObjectBase* current;
-					std::list<Uint32>::const_iterator iter;
-					iter = assignedNonInfantryGroundObjectList.begin();
+					ObjectList::const_iterator iter;
+					iter = nonInfantryGroundObjects.begin();
 
 					do {
 						current = currentGame->getObjectManager().getObject(*iter);
@@ -670,7 +638,7 @@ void Tile::setType(int newType) {
 
 						unassignNonInfantryGroundObject(current->getObjectID());
 						current->destroy();
-					} while(iter != assignedNonInfantryGroundObjectList.end());
+					} while(iter != nonInfantryGroundObjects.end());
 				}
 			}
 		}
@@ -683,14 +651,29 @@ void Tile::setType(int newType) {
 			}
 		}
 	}
+
+	currentGameMap->getPathClusterGraph().invalidateTile(location);
+	currentGameMap->getRadarTileTracker().setTileDirty(location);
+	currentGameMap->getBuildSiteGrid().onTerrainChanged(location);
+	currentGameMap->getSpiceIndex().onTerrainChanged(location);
+}
+
+void Tile::setOwner(int newOwner) {
+	if(newOwner != owner) {
+		int oldOwner = owner;
+		owner = newOwner;
+		currentGameMap->getBuildSiteGrid().onTileOwnerChanged(location, oldOwner, newOwner);
+	}
 }
 
 
 void Tile::squash() {
 	if(hasInfantry()) {
+		// iterate over a copy as the list is changed while squashing the infantry
+		const InfantryList infantryUnits = assignedInfantryList;
 		InfantryBase* current;
-		std::list<Uint32>::const_iterator iter;
-		iter = assignedInfantryList.begin();
+		InfantryList::const_iterator iter;
+		iter = infantryUnits.begin();
 
 		do {
 			current = (InfantryBase*) currentGame->getObjectManager().getObject(*iter);
@@ -700,7 +683,7 @@ void Tile::squash() {
 				continue;
 
 			current->squash();
-		} while(iter != assignedInfantryList.end());
+		} while(iter != infantryUnits.end());
 	}
 }
 
@@ -735,6 +718,8 @@ float Tile::harvestSpice() {
 
 
 void Tile::setSpice(float newSpice) {
+	int oldType = type;
+
 	if(newSpice <= 0.0f) {
 		type = Terrain_Sand;
 	} else if(newSpice >= RANDOMTHICKSPICEMIN) {
@@ -743,6 +728,16 @@ void Tile::setSpice(float newSpice) {
 		type = Terrain_Spice;
 	}
 	spice = newSpice;
+
+	// the amount of spice only matters to harvesters; everything else only depends on the terrain type
+	if(type == oldType) {
+		return;
+	}
+
+	currentGameMap->getPathClusterGraph().invalidateTile(location);
+	currentGameMap->getRadarTileTracker().setTileDirty(location);
+	currentGameMap->getBuildSiteGrid().onTerrainChanged(location);
+	currentGameMap->getSpiceIndex().onTerrainChanged(location);
 }
 
 
@@ -813,7 +808,7 @@ ObjectBase* Tile::getObjectAt(int x, int y) {
 		atPos.x = x;
 		atPos.y = y;
 
-		std::list<Uint32>::const_iterator iter;
+		InfantryList::const_iterator iter;
 		for(iter = assignedInfantryList.begin(); iter != assignedInfantryList.end() ;++iter) {
 			infantry = (InfantryBase*) currentGame->getObjectManager().getObject(*iter);
 			if(infantry == NULL)
@@ -834,17 +829,14 @@ ObjectBase* Tile::getObjectAt(int x, int y) {
 
 
 ObjectBase* Tile::getObjectWithID(Uint32 objectID) {
-	ConcatIterator<Uint32> iterator;
-	iterator.addList(assignedInfantryList);
-	iterator.addList(assignedNonInfantryGroundObjectList);
-	iterator.addList(assignedUndergroundUnitList);
-	iterator.addList(assignedAirUnitList);
-
-	while(!iterator.isIterationFinished()) {
-		if(*iterator == objectID) {
-			return currentGame->getObjectManager().getObject(*iterator);
+	std::vector<Uint32> objectIDs;
+	getObjectIDs(objectIDs);
+
+	std::vector<Uint32>::const_iterator iter;
+	for(iter = objectIDs.begin(); iter != objectIDs.end(); ++iter) {
+		if(*iter == objectID) {
+			return currentGame->getObjectManager().getObject(*iter);
 		}
-		++iterator;
 	}
 
 	return NULL;
@@ -984,7 +976,7 @@ bool Tile::isFogged(int houseID) {
 
 	if(currentGame->getGameInitSettings().getGameOptions().fogOfWar == false) {
 		return false;
-	} else if((currentGame->getGameCycleCount() - lastAccess[houseID]) >= MILLI2CYCLES(10*1000)) {
+	} else if((currentGame->getGameCycleCount() - lastAccess[houseID]) >= FOGTIME) {
 		return true;
 	} else {
 		return false;
@@ -77,6 +77,7 @@ void realign_buttons();
 
 void printUsage() {
     fprintf(stderr, "Usage:\n\tdunelegacy [--showlog] [--fullscreen|--window] [--PlayerName=X] [--ServerPort=X]\n");
+    fprintf(stderr, "\tdunelegacy --benchmark=REPLAYFILE [--benchmark-cycles=X]\n");
 }
 
 void setVideoMode()
@@ -339,6 +340,8 @@ int quickload=0;
 	}
 
 	bool bShowDebug = false;
+	std::string benchmarkReplayFile;
+	Uint32 benchmarkCycles = 0;
     for(int i=1; i < argc; i++) {
 	    //check for overiding params
 	    std::string parameter(argv[i]);
@@ -349,6 +352,12 @@ int quickload=0;
 		if(parameter == "--showlog") {
 		    // special parameter which does not overwrite settings
             bShowDebug = true;
+		} else if(parameter.find("--benchmark=") == 0) {
+		    // run a replay without video output and print the results to stdout
+		    benchmarkReplayFile = parameter.substr(strlen("--benchmark="));
+		    bShowDebug = true;
+		} else if(parameter.find("--benchmark-cycles=") == 0) {
+		    benchmarkCycles = atol(argv[i] + strlen("--benchmark-cycles="));
 		} else if((parameter == "-f") || (parameter == "--fullscreen") || (parameter == "-w") || (parameter == "--window") || (parameter.find("--PlayerName=") == 0) || (parameter.find("--ServerPort=") == 0)) {
             // normal parameter for overwriting settings
             // handle later
@@ -498,6 +507,14 @@ int quickload=0;
 		}
 
         if(bFirstInit == true) {
+            if(benchmarkReplayFile.empty() == false) {
+                // nothing is shown or played during a benchmark
+                char videoDriverEnv[] = "SDL_VIDEODRIVER=dummy";
+                SDL_putenv(videoDriverEnv);
+                char audioDriverEnv[] = "SDL_AUDIODRIVER=dummy";
+                SDL_putenv(audioDriverEnv);
+            }
+
             fprintf(stdout, "initializing SDL..... \t\t"); fflush(stdout);
             if(SDL_Init(SDL_INIT_TIMER | SDL_INIT_VIDEO) < 0) {
                 fprintf(stderr, "ERROR: Couldn't initialise SDL: %s\n", SDL_GetError());
@@ -605,7 +622,7 @@ int quickload=0;
             }
 
             // Playing intro
-            if(((bFirstGamestart == true) || (settings.general.playIntro == true)) && (bFirstInit==true)) {
+            if(((bFirstGamestart == true) || (settings.general.playIntro == true)) && (bFirstInit==true) && benchmarkReplayFile.empty()) {
                 fprintf(stdout, "playing intro.....");fflush(stdout);
                 Intro* pIntro = new Intro();
                 pIntro->run();
@@ -615,6 +632,11 @@ int quickload=0;
 
             bFirstInit = false;
 
+            if(benchmarkReplayFile.empty() == false) {
+                benchmarkReplay(benchmarkReplayFile, benchmarkCycles);
+                bExitGame = true;
+            }
+
             if (quickload) {
 		quickload=0;
 		     char tmp[FILENAME_MAX];
@@ -624,13 +646,16 @@ int quickload=0;
 			 startSinglePlayerGame(GameInitSettings(savepath));
 		       } catch (std::exception& e) {};
             }
-            fprintf(stdout, "starting main menu...");fflush(stdout);
-            MainMenu * myMenu = new MainMenu();
-            fprintf(stdout, "\t\tfinished\n"); fflush(stdout);
-            if(myMenu->showMenu() == MENU_QUIT_DEFAULT) {
-                bExitGame = true;
+
+            if(bExitGame == false) {
+                fprintf(stdout, "starting main menu...");fflush(stdout);
+                MainMenu * myMenu = new MainMenu();
+                fprintf(stdout, "\t\tfinished\n"); fflush(stdout);
+                if(myMenu->showMenu() == MENU_QUIT_DEFAULT) {
+                    bExitGame = true;
+                }
+                delete myMenu;
             }
-            delete myMenu;
 
             fprintf(stdout, "Deinitialize....."); fflush(stdout);
 
@@ -119,21 +119,28 @@ std::list<FileInfo> getFileList(std::string directory, std::string extension, bo
 		do {
 			std::string filename = fdata.name;
 
-            if(filename.length() < extension.length()+1) {
-                continue;
-			}
+            bool bMatches;
+            if(extension.empty()) {
+                bMatches = ((fdata.attrib & _A_SUBDIR) == 0);
+            } else {
+                if(filename.length() < extension.length()+1) {
+                    continue;
+                }
 
-			if(filename[filename.length() - extension.length() - 1] != '.') {
-                continue;
-			}
+                if(filename[filename.length() - extension.length() - 1] != '.') {
+                    continue;
+                }
 
-			std::string ext = filename.substr(filename.length() - extension.length());
+                std::string ext = filename.substr(filename.length() - extension.length());
 
-			if(bIgnoreCase == true) {
-				convertToLower(ext);
+                if(bIgnoreCase == true) {
+                    convertToLower(ext);
+                }
+
+                bMatches = (ext == extension);
             }
 
-			if(ext == extension) {
+			if(bMatches) {
                 // on win32 we get an ansi-encoded filename
                 WCHAR szwFilename[MAX_PATH];
                 char szFilename[MAX_PATH];
@@ -168,6 +175,15 @@ std::list<FileInfo> getFileList(std::string directory, std::string extension, bo
 	while((curEntry = readdir(dir)) != NULL) {
 			std::string filename = curEntry->d_name;
 
+			if(extension.empty()) {
+			    std::string fullpath = directory + "/" + filename;
+			    struct stat fdata;
+			    if((stat(fullpath.c_str(), &fdata) == 0) && S_ISREG(fdata.st_mode)) {
+                    Files.push_back(FileInfo(filename, fdata.st_size, fdata.st_mtime));
+			    }
+                continue;
+			}
+
 			if(filename.length() < extension.length()+1) {
                 continue;
 			}
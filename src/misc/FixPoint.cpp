@@ -0,0 +1,182 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <misc/FixPoint.h>
+
+/// sin(i*2*pi/256)*65536 for i in [0;64] (the first quarter of the circle)
+static const Sint32 sinTable[65] = {
+          0,    1608,    3216,    4821,    6424,    8022,    9616,   11204,
+      12785,   14359,   15924,   17479,   19024,   20557,   22078,   23586,
+      25080,   26558,   28020,   29466,   30893,   32303,   33692,   35062,
+      36410,   37736,   39040,   40320,   41576,   42806,   44011,   45190,
+      46341,   47464,   48559,   49624,   50660,   51665,   52639,   53581,
+      54491,   55368,   56212,   57022,   57798,   58538,   59244,   59914,
+      60547,   61145,   61705,   62228,   62714,   63162,   63572,   63944,
+      64277,   64571,   64827,   65043,   65220,   65358,   65457,   65516,
+      65536
+};
+
+/// atan(i/256)/(2*pi)*256*65536 for i in [0;256] (the angle in 256th of a full circle)
+static const Sint32 atanTable[257] = {
+          0,   10430,   20860,   31290,   41718,   52145,   62571,   72994,
+      83416,   93835,  104251,  114664,  125073,  135479,  145880,  156277,
+     166669,  177056,  187438,  197815,  208185,  218549,  228906,  239256,
+     249600,  259935,  270263,  280583,  290894,  301197,  311491,  321775,
+     332050,  342315,  352570,  362814,  373047,  383270,  393481,  403681,
+     413869,  424044,  434208,  444358,  454496,  464620,  474731,  484829,
+     494912,  504981,  515035,  525075,  535100,  545109,  555103,  565081,
+     575043,  584989,  594918,  604831,  614727,  624606,  634467,  644311,
+     654136,  663944,  673734,  683505,  693257,  702990,  712705,  722400,
+     732076,  741732,  751368,  760984,  770579,  780155,  789709,  799243,
+     808756,  818248,  827718,  837168,  846595,  856001,  865384,  874746,
+     884085,  893402,  902696,  911968,  921217,  930443,  939645,  948825,
+     957981,  967114,  976223,  985308,  994370, 1003407, 1012421, 1021410,
+    1030375, 1039316, 1048232, 1057123, 1065990, 1074832, 1083649, 1092442,
+    1101209, 1109951, 1118668, 1127359, 1136026, 1144667, 1153282, 1161872,
+    1170436, 1178975, 1187488, 1195975, 1204436, 1212871, 1221280, 1229664,
+    1238021, 1246352, 1254658, 1262937, 1271189, 1279416, 1287616, 1295790,
+    1303938, 1312059, 1320154, 1328223, 1336265, 1344281, 1352271, 1360234,
+    1368170, 1376081, 1383964, 1391822, 1399652, 1407457, 1415234, 1422986,
+    1430711, 1438409, 1446081, 1453727, 1461346, 1468939, 1476505, 1484045,
+    1491559, 1499046, 1506507, 1513942, 1521350, 1528733, 1536089, 1543419,
+    1550722, 1558000, 1565251, 1572477, 1579676, 1586849, 1593997, 1601118,
+    1608214, 1615284, 1622328, 1629346, 1636338, 1643305, 1650246, 1657162,
+    1664052, 1670917, 1677757, 1684570, 1691359, 1698123, 1704861, 1711574,
+    1718262, 1724925, 1731563, 1738176, 1744764, 1751327, 1757866, 1764380,
+    1770869, 1777334, 1783774, 1790190, 1796582, 1802949, 1809292, 1815611,
+    1821906, 1828177, 1834423, 1840646, 1846846, 1853021, 1859173, 1865301,
+    1871405, 1877486, 1883544, 1889578, 1895590, 1901578, 1907542, 1913484,
+    1919403, 1925299, 1931173, 1937023, 1942851, 1948656, 1954439, 1960199,
+    1965938, 1971653, 1977347, 1983018, 1988668, 1994295, 1999901, 2005485,
+    2011047, 2016588, 2022107, 2027604, 2033080, 2038535, 2043968, 2049381,
+    2054772, 2060142, 2065491, 2070820, 2076127, 2081414, 2086681, 2091927,
+    2097152
+};
+
+/**
+    Looks up the sine of a whole angle step.
+    \param  step    the angle in the range [0;256]
+    \return the sine as raw FixPoint value
+*/
+static inline Sint32 sinOfStep(int step) {
+    if(step <= 64) {
+        return sinTable[step];
+    } else if(step <= 128) {
+        return sinTable[128 - step];
+    } else if(step <= 192) {
+        return -sinTable[step - 128];
+    } else {
+        return -sinTable[256 - step];
+    }
+}
+
+/**
+    Integer square root.
+    \param  x   the number
+    \return the largest integer r with r*r <= x
+*/
+static Uint64 isqrt(Uint64 x) {
+    Uint64 result = 0;
+    Uint64 bit = ((Uint64) 1) << 62;
+
+    while(bit > x) {
+        bit >>= 2;
+    }
+
+    while(bit != 0) {
+        if(x >= result + bit) {
+            x -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return result;
+}
+
+FixPoint FixPoint::sqrt(const FixPoint& x) {
+    if(x.value <= 0) {
+        return FixPoint();
+    }
+
+    return fromRaw((Sint32) isqrt(((Uint64) x.value) << FIXPOINT_FRACBITS));
+}
+
+FixPoint FixPoint::hypot(const FixPoint& x, const FixPoint& y) {
+    // the raw squares have 32 fractional bits, so the root has 16 fractional bits
+    Uint64 sum = (Uint64) ((Sint64) x.value * (Sint64) x.value) + (Uint64) ((Sint64) y.value * (Sint64) y.value);
+    return fromRaw((Sint32) isqrt(sum));
+}
+
+FixPoint FixPoint::sin(const FixPoint& angle) {
+    // reduce to [0;256) by masking the two's complement representation
+    Uint32 reducedAngle = ((Uint32) angle.value) & ((256 << FIXPOINT_FRACBITS) - 1);
+
+    int step = reducedAngle >> FIXPOINT_FRACBITS;
+    Sint64 fraction = reducedAngle & (FIXPOINT_ONE - 1);
+
+    Sint32 s0 = sinOfStep(step);
+    Sint32 s1 = sinOfStep(step + 1);
+
+    return fromRaw(s0 + (Sint32) (((s1 - s0) * fraction) >> FIXPOINT_FRACBITS));
+}
+
+FixPoint FixPoint::cos(const FixPoint& angle) {
+    return sin(angle + FixPoint(64));
+}
+
+FixPoint FixPoint::atan2(const FixPoint& y, const FixPoint& x) {
+    Sint64 absX = (x.value < 0) ? -((Sint64) x.value) : x.value;
+    Sint64 absY = (y.value < 0) ? -((Sint64) y.value) : y.value;
+
+    if((absX == 0) && (absY == 0)) {
+        return FixPoint();
+    }
+
+    // reduce to the first octant where the ratio is in [0;1]
+    bool bSwapped = (absY > absX);
+    Sint64 ratio = bSwapped ? ((absX << 16) / absY) : ((absY << 16) / absX);
+
+    int index = (int) (ratio >> 8);
+    Sint64 fraction = ratio & 0xFF;
+    Sint32 angle;
+    if(index >= 256) {
+        angle = atanTable[256];
+    } else {
+        angle = atanTable[index] + (Sint32) (((atanTable[index+1] - atanTable[index]) * fraction) >> 8);
+    }
+
+    if(bSwapped) {
+        angle = (64 << FIXPOINT_FRACBITS) - angle;
+    }
+
+    if(x.value < 0) {
+        angle = (128 << FIXPOINT_FRACBITS) - angle;
+    }
+
+    if(y.value < 0) {
+        angle = (256 << FIXPOINT_FRACBITS) - angle;
+        if(angle >= (256 << FIXPOINT_FRACBITS)) {
+            angle = 0;
+        }
+    }
+
+    return fromRaw(angle);
+}
@@ -80,6 +80,38 @@ void IFileStream::close()
 	}
 }
 
+Uint32 IFileStream::getPosition()
+{
+    if(fp == NULL) {
+        return 0;
+    }
+
+    return ftell(fp);
+}
+
+bool IFileStream::setPosition(Uint32 position)
+{
+    if(fp == NULL) {
+        return false;
+    }
+
+    return (fseek(fp, position, SEEK_SET) == 0);
+}
+
+Uint32 IFileStream::getSize()
+{
+    if(fp == NULL) {
+        return 0;
+    }
+
+    long position = ftell(fp);
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, position, SEEK_SET);
+
+    return size;
+}
+
 std::string IFileStream::readString()
 {
 	Uint32 length;
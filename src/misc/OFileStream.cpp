@@ -86,6 +86,14 @@ void OFileStream::flush() {
     }
 }
 
+Uint32 OFileStream::getPosition() {
+    if(fp == NULL) {
+        return 0;
+    }
+
+    return ftell(fp);
+}
+
 void OFileStream::writeString(const std::string& str)
 {
 	writeUint32(str.length());
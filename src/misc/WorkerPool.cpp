@@ -0,0 +1,144 @@
+/*
+ *  This file is part of Dune Legacy.
+ *
+ *  Dune Legacy is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Dune Legacy is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Dune Legacy.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <misc/WorkerPool.h>
+
+#include <stdexcept>
+#include <algorithm>
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+WorkerPool::WorkerPool(int numThreads)
+ : pTasks(NULL), nextTask(0), numUnfinishedTasks(0), bQuit(false) {
+
+	mutex = SDL_CreateMutex();
+	if(mutex == NULL) {
+		throw std::runtime_error("Unable to create mutex");
+	}
+
+	tasksAvailable = SDL_CreateCond();
+	tasksFinished = SDL_CreateCond();
+	if((tasksAvailable == NULL) || (tasksFinished == NULL)) {
+		throw std::runtime_error("Unable to create condition variable");
+	}
+
+	for(int i = 0; i < numThreads; i++) {
+		SDL_Thread* pThread = SDL_CreateThread(threadMain, (void*) this);
+		if(pThread == NULL) {
+			fprintf(stderr, "WorkerPool: Unable to create thread! Using %d worker threads instead of %d.\n", i, numThreads);
+			break;
+		}
+		threads.push_back(pThread);
+	}
+}
+
+WorkerPool::~WorkerPool() {
+	SDL_LockMutex(mutex);
+	bQuit = true;
+	SDL_CondBroadcast(tasksAvailable);
+	SDL_UnlockMutex(mutex);
+
+	for(size_t i = 0; i < threads.size(); i++) {
+		SDL_WaitThread(threads[i], NULL);
+	}
+
+	SDL_DestroyCond(tasksFinished);
+	SDL_DestroyCond(tasksAvailable);
+	SDL_DestroyMutex(mutex);
+}
+
+void WorkerPool::run(const std::vector<std::function<void ()> >& tasks) {
+	if(threads.empty() || (tasks.size() <= 1)) {
+		// waking up the workers is not worth it
+		for(size_t i = 0; i < tasks.size(); i++) {
+			tasks[i]();
+		}
+		return;
+	}
+
+	SDL_LockMutex(mutex);
+
+	pTasks = &tasks;
+	nextTask = 0;
+	numUnfinishedTasks = tasks.size();
+	SDL_CondBroadcast(tasksAvailable);
+
+	runTasks();
+
+	while(numUnfinishedTasks > 0) {
+		SDL_CondWait(tasksFinished, mutex);
+	}
+
+	pTasks = NULL;
+
+	SDL_UnlockMutex(mutex);
+}
+
+int WorkerPool::getNumCPUs() {
+#ifdef _WIN32
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	return std::max((int) systemInfo.dwNumberOfProcessors, 1);
+#else
+	long numCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+	return (numCPUs > 0) ? (int) numCPUs : 1;
+#endif
+}
+
+int WorkerPool::threadMain(void* data) {
+	WorkerPool* pWorkerPool = static_cast<WorkerPool*>(data);
+
+	SDL_LockMutex(pWorkerPool->mutex);
+
+	while(true) {
+		while((pWorkerPool->bQuit == false) && ((pWorkerPool->pTasks == NULL) || (pWorkerPool->nextTask >= pWorkerPool->pTasks->size()))) {
+			SDL_CondWait(pWorkerPool->tasksAvailable, pWorkerPool->mutex);
+		}
+
+		if(pWorkerPool->bQuit) {
+			break;
+		}
+
+		pWorkerPool->runTasks();
+	}
+
+	SDL_UnlockMutex(pWorkerPool->mutex);
+
+	return 0;
+}
+
+void WorkerPool::runTasks() {
+	while((pTasks != NULL) && (nextTask < pTasks->size())) {
+		const std::function<void ()>& task = (*pTasks)[nextTask];
+		nextTask++;
+
+		SDL_UnlockMutex(mutex);
+		task();
+		SDL_LockMutex(mutex);
+
+		numUnfinishedTasks--;
+		if(numUnfinishedTasks == 0) {
+			SDL_CondBroadcast(tasksFinished);
+		}
+	}
+}
@@ -20,6 +20,7 @@
 #include <globals.h>
 
 #include <stdexcept>
+#include <algorithm>
 
 
 Uint32 getPixel(SDL_Surface *surface, int x, int y) {
@@ -207,6 +208,99 @@ void mapColor(SDL_Surface *surface, Uint8 colorMap[256]) {
 	}
 }
 
+std::vector<MaskSpan> createMaskSpans(SDL_Surface* source, const SDL_Rect& rect, Uint8 maskColor) {
+    std::vector<MaskSpan> spans;
+
+	if(SDL_LockSurface(source) != 0) {
+	    throw std::runtime_error("createMaskSpans(): Cannot lock image!");
+	}
+
+    for(int y = 0; y < rect.h; y++) {
+        Uint8 *p = (Uint8 *)source->pixels + ((rect.y + y) * source->pitch) + rect.x;
+
+        int x = 0;
+        while(x < rect.w) {
+            if(p[x] != maskColor) {
+                x++;
+                continue;
+            }
+
+            MaskSpan span;
+            span.x = x;
+            span.y = y;
+            while((x < rect.w) && (p[x] == maskColor)) {
+                x++;
+            }
+            span.length = x - span.x;
+            spans.push_back(span);
+        }
+    }
+
+    SDL_UnlockSurface(source);
+
+    return spans;
+}
+
+void mapColorMasked(SDL_Surface* dest, int x, int y, const std::vector<MaskSpan>& spans, const Uint8 colorMap[256]) {
+    const int clipLeft = dest->clip_rect.x;
+    const int clipTop = dest->clip_rect.y;
+    const int clipRight = dest->clip_rect.x + dest->clip_rect.w;
+    const int clipBottom = dest->clip_rect.y + dest->clip_rect.h;
+
+	if(!SDL_MUSTLOCK(dest) || (SDL_LockSurface(dest) == 0)) {
+	    std::vector<MaskSpan>::const_iterator iter;
+        for(iter = spans.begin(); iter != spans.end(); ++iter) {
+            int spanY = y + iter->y;
+            if((spanY < clipTop) || (spanY >= clipBottom)) {
+                continue;
+            }
+
+            int spanStart = std::max(x + iter->x, clipLeft);
+            int spanEnd = std::min(x + iter->x + iter->length, clipRight);
+
+            Uint8 *p = (Uint8 *)dest->pixels + (spanY * dest->pitch) + spanStart;
+            for(int i = spanStart; i < spanEnd; i++, ++p) {
+                *p = colorMap[*p];
+            }
+        }
+
+        if(SDL_MUSTLOCK(dest)) {
+			SDL_UnlockSurface(dest);
+		}
+	}
+}
+
+void createBlendColorMap(SDL_Surface* dest, SDL_Surface* pBlendSurface, Uint8 colorMap[256]) {
+    // Let SDL blend a single pixel of every color so that the result is exactly the same as blitting pBlendSurface directly
+    SDL_Surface* pColors;
+    if((pColors = SDL_CreateRGBSurface(SDL_SWSURFACE, 256, 1, 8, 0, 0, 0, 0)) == NULL) {
+        throw std::runtime_error("createBlendColorMap(): Cannot create surface!");
+    }
+    SDL_SetColors(pColors, dest->format->palette->colors, 0, dest->format->palette->ncolors);
+
+    for(int i = 0; i < 256; i++) {
+        putPixel(pColors, i, 0, i);
+    }
+
+    SDL_Rect source = { 0, 0, 1, 1 };
+    for(int i = 0; i < 256; i++) {
+        SDL_Rect destination = { i, 0, 1, 1 };
+        SDL_BlitSurface(pBlendSurface, &source, pColors, &destination);
+    }
+
+	if(SDL_LockSurface(pColors) != 0) {
+	    SDL_FreeSurface(pColors);
+	    throw std::runtime_error("createBlendColorMap(): Cannot lock image!");
+	}
+
+    for(int i = 0; i < 256; i++) {
+        colorMap[i] = ((Uint8*) pColors->pixels)[i];
+    }
+
+    SDL_UnlockSurface(pColors);
+    SDL_FreeSurface(pColors);
+}
+
 
 SDL_Surface* copySurface(SDL_Surface* inSurface) {
 	//return SDL_DisplayFormat(inSurface);
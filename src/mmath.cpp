@@ -100,6 +100,21 @@ float destinationAngle(const Coord& p1, const Coord& p2)
 }
 
 
+FixPoint destinationAngle(const FixPoint& x, const FixPoint& y, const FixPoint& to_x, const FixPoint& to_y)
+{
+    FixPoint diffX = to_x - x;
+    FixPoint diffY = to_y - y;
+
+    if((diffX == 0) && (diffY == 0)) {
+        // like the float version
+        return FixPoint(64);
+    }
+
+    // the y-axis of the world coordinates points down
+    return FixPoint::atan2(-diffY, diffX);
+}
+
+
 float distanceFrom(const Coord& p1, const Coord& p2)
 {
 	float	first = (p1.x - p2.x);
@@ -120,6 +135,11 @@ float distanceFrom(float x, float y, float to_x, float to_y)
 	return z;
 }
 
+FixPoint distanceFrom(const FixPoint& x, const FixPoint& y, const FixPoint& to_x, const FixPoint& to_y)
+{
+    return FixPoint::hypot(x - to_x, y - to_y);
+}
+
 float blockDistance(const Coord& p1, const Coord& p2)
 {
 	int xDis = abs(p1.x - p2.x),
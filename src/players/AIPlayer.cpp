@@ -83,11 +83,15 @@ void AIPlayer::save(OutputStream& stream) const {
 
 
 void AIPlayer::update() {
-    if( (getGameCylceCount() + getHouse()->getHouseID()) % AIUPDATEINTERVAL != 0) {
-        // we are not updating this AI player this cycle
-        return;
-    }
+    // everything is done in onThink()
+}
+
+bool AIPlayer::wantsToThink() const {
+    // all AI players think in the same cycle, so that they can think in parallel
+    return (getGameCylceCount() % AIUPDATEINTERVAL == 0);
+}
 
+void AIPlayer::onThink() {
     checkAllUnits();
 
 	if(buildTimer <= 0) {
@@ -140,8 +144,9 @@ void AIPlayer::onDamage(const ObjectBase* pObject, int damage, Uint32 damagerID)
 }
 
 void AIPlayer::scrambleUnitsAndDefend(const ObjectBase* pIntruder) {
-    RobustList<const UnitBase*>::const_iterator iter;
-    for(iter = getUnitList().begin(); iter != getUnitList().end(); ++iter) {
+    const std::vector<const UnitBase*>& units = getUnitList();
+    std::vector<const UnitBase*>::const_iterator iter;
+    for(iter = units.begin(); iter != units.end(); ++iter) {
         const UnitBase* pUnit = *iter;
         if(pUnit->isRespondable() && (pUnit->getOwner() == getHouse())) {
 
@@ -172,8 +177,9 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
         maxX = getMap().getSizeX() - 1;
         maxY = getMap().getSizeY() - 1;
     } else {
-        RobustList<const StructureBase*>::const_iterator iter;
-        for(iter = getStructureList().begin(); iter != getStructureList().end(); ++iter) {
+        const std::vector<const StructureBase*>& structures = getStructureList();
+        std::vector<const StructureBase*>::const_iterator iter;
+        for(iter = structures.begin(); iter != structures.end(); ++iter) {
             const StructureBase* structure = *iter;
             if (structure->getOwner() == getHouse()) {
                 if (structure->getX() < minX)
@@ -198,6 +204,25 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
 	if (minY < 0) minY = 0;
 	if (maxY >= getMap().getSizeY()) maxY = getMap().getSizeY() - structureSizeY;
 
+    // collect the locations needed for rating the candidates once instead of for every candidate
+    std::vector<Coord> enemyStructureLocations;
+    const std::vector<const StructureBase*>& structures = getStructureList();
+    std::vector<const StructureBase*>::const_iterator structureIter;
+    for(structureIter = structures.begin(); structureIter != structures.end(); ++structureIter) {
+        if((*structureIter)->getOwner()->getTeam() != getHouse()->getTeam()) {
+            enemyStructureLocations.push_back((*structureIter)->getLocation());
+        }
+    }
+
+    std::vector<Coord> ownUnitLocations;
+    const std::vector<const UnitBase*>& units = getUnitList();
+    std::vector<const UnitBase*>::const_iterator unitIter;
+    for(unitIter = units.begin(); unitIter != units.end(); ++unitIter) {
+        if((*unitIter)->getOwner() == getHouse()) {
+            ownUnitLocations.push_back((*unitIter)->getLocation());
+        }
+    }
+
     float bestrating = 0.0f;
 	Coord bestLocation = Coord::Invalid();
 	int count = 0;
@@ -219,8 +244,8 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
 
                 case Structure_Refinery: {
                     // place near spice
-                    Coord spicePos;
-                    if(getMap().findSpice(spicePos, pos)) {
+                    Coord spicePos = getMap().getSpiceIndex().findNearestSpice(pos, false);
+                    if(spicePos.isValid()) {
                         rating = 10000000.0f - blockDistance(pos, spicePos);
                     } else {
                         rating = 10000000.0f;
@@ -231,14 +256,11 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
                 case Structure_ConstructionYard: {
                     float nearestUnit = 10000000.0f;
 
-                    RobustList<const UnitBase*>::const_iterator iter;
-                    for(iter = getUnitList().begin(); iter != getUnitList().end(); ++iter) {
-                        const UnitBase* pUnit = *iter;
-                        if(pUnit->getOwner() == getHouse()) {
-                            float tmp = blockDistance(pos, pUnit->getLocation());
-                            if(tmp < nearestUnit) {
-                                nearestUnit = tmp;
-                            }
+                    std::vector<Coord>::const_iterator iter;
+                    for(iter = ownUnitLocations.begin(); iter != ownUnitLocations.end(); ++iter) {
+                        float tmp = blockDistance(pos, *iter);
+                        if(tmp < nearestUnit) {
+                            nearestUnit = tmp;
                         }
                     }
 
@@ -255,17 +277,9 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
 
                     float nearestSand = 10000000.0f;
 
-                    for(int y = 0 ; y < currentGameMap->getSizeY(); y++) {
-                        for(int x = 0; x < currentGameMap->getSizeX(); x++) {
-                            int type = currentGameMap->getTile(x,y)->getType();
-
-                            if(type != Terrain_Rock || type != Terrain_Slab || type != Terrain_Mountain) {
-                                float tmp = blockDistance(pos, Coord(x,y));
-                                if(tmp < nearestSand) {
-                                    nearestSand = tmp;
-                                }
-                            }
-                        }
+                    Coord sandPos = getMap().getBuildSiteGrid().getNearestSand(pos);
+                    if(sandPos.isValid()) {
+                        nearestSand = blockDistance(pos, sandPos);
                     }
 
                     rating = 10000000.0f - nearestSand;
@@ -278,15 +292,11 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
                     // place towards enemy
                     float nearestEnemy = 10000000.0f;
 
-                    RobustList<const StructureBase*>::const_iterator iter2;
-                    for(iter2 = getStructureList().begin(); iter2 != getStructureList().end(); ++iter2) {
-                        const StructureBase* pStructure = *iter2;
-                        if(pStructure->getOwner()->getTeam() != getHouse()->getTeam()) {
-
-                            float tmp = blockDistance(pos, pStructure->getLocation());
-                            if(tmp < nearestEnemy) {
-                                nearestEnemy = tmp;
-                            }
+                    std::vector<Coord>::const_iterator iter2;
+                    for(iter2 = enemyStructureLocations.begin(); iter2 != enemyStructureLocations.end(); ++iter2) {
+                        float tmp = blockDistance(pos, *iter2);
+                        if(tmp < nearestEnemy) {
+                            nearestEnemy = tmp;
                         }
                     }
 
@@ -303,15 +313,11 @@ Coord AIPlayer::findPlaceLocation(Uint32 itemID) {
                     // place at a save place
                     float nearestEnemy = 10000000.0f;
 
-                    RobustList<const StructureBase*>::const_iterator iter2;
-                    for(iter2 = getStructureList().begin(); iter2 != getStructureList().end(); ++iter2) {
-                        const StructureBase* pStructure = *iter2;
-                        if(pStructure->getOwner()->getTeam() != getHouse()->getTeam()) {
-
-                            float tmp = blockDistance(pos, pStructure->getLocation());
-                            if(tmp < nearestEnemy) {
-                                nearestEnemy = tmp;
-                            }
+                    std::vector<Coord>::const_iterator iter2;
+                    for(iter2 = enemyStructureLocations.begin(); iter2 != enemyStructureLocations.end(); ++iter2) {
+                        float tmp = blockDistance(pos, *iter2);
+                        if(tmp < nearestEnemy) {
+                            nearestEnemy = tmp;
                         }
                     }
 
@@ -359,8 +365,9 @@ int AIPlayer::getNumAdjacentStructureTiles(Coord pos, int structureSizeX, int st
 void AIPlayer::build() {
 	bool bConstructionYardChecked = false;
 
-    RobustList<const StructureBase*>::const_iterator iter;
-    for(iter = getStructureList().begin(); iter != getStructureList().end(); ++iter) {
+    const std::vector<const StructureBase*>& structures = getStructureList();
+    std::vector<const StructureBase*>::const_iterator iter;
+    for(iter = structures.begin(); iter != structures.end(); ++iter) {
         const StructureBase* pStructure = *iter;
 
         //if this players structure, and its a heavy factory, build something
@@ -448,33 +455,43 @@ void AIPlayer::build() {
                         if(isAllowedToArm() && pStarPort->okToOrder())	{
                             const Choam& choam = getHouse()->getChoam();
 
+                            // the orders are executed after thinking, so we have to keep track of the credits spent
+                            int credits = getHouse()->getCredits();
+
                             if(getHouse()->getNumItems(Unit_Harvester) < getMaxHarvester() && choam.getNumAvailable(Unit_Harvester) > 0) {
-                                if(getHouse()->getCredits() > 300) {
+                                if(credits > 300) {
                                     doProduceItem(pBuilder, Unit_Harvester);
-                                    if(getHouse()->getCredits() > 300 && choam.getNumAvailable(Unit_Harvester) > 0) {
+                                    credits -= choam.getPrice(Unit_Harvester);
+                                    if(credits > 300 && choam.getNumAvailable(Unit_Harvester) > 1) {
                                         doProduceItem(pBuilder, Unit_Harvester);
                                     }
                                     doPlaceOrder(pStarPort);
                                 }
                             } else if(getHouse()->getNumItems(Unit_Carryall) < (getHouse()->getNumItems(Unit_Harvester)+1)/2 && choam.getNumAvailable(Unit_Carryall) > 0) {
-                                if(getHouse()->getCredits() > 800) {
+                                if(credits > 800) {
                                     doProduceItem(pBuilder, Unit_Carryall);
                                     doPlaceOrder(pStarPort);
                                 }
                             } else {
                                 // order max 6 units
                                 int num = 6;
-                                while((num > 0) && (getHouse()->getCredits() > 2000)) {
+                                while((num > 0) && (credits > 2000)) {
+                                    Uint32 itemID = NONE;
                                     if(pStarPort->isAvailableToBuild(Unit_SiegeTank) && choam.getNumAvailable(Unit_SiegeTank) > 0 && choam.isCheap(Unit_SiegeTank)) {
-                                        doProduceItem(pBuilder, Unit_SiegeTank);
+                                        itemID = Unit_SiegeTank;
                                     } else if(pStarPort->isAvailableToBuild(Unit_Launcher) && choam.getNumAvailable(Unit_Launcher) > 0 && choam.isCheap(Unit_Launcher)) {
-                                        doProduceItem(pBuilder, Unit_Launcher);
+                                        itemID = Unit_Launcher;
                                     } else if(pStarPort->isAvailableToBuild(Unit_Tank) && choam.getNumAvailable(Unit_Tank) > 0 && choam.isCheap(Unit_Tank)) {
-                                        doProduceItem(pBuilder, Unit_Tank);
+                                        itemID = Unit_Tank;
                                     } else if(pStarPort->isAvailableToBuild(Unit_Quad) && choam.getNumAvailable(Unit_Quad) > 0 && choam.isCheap(Unit_Quad)) {
-                                        doProduceItem(pBuilder, Unit_Quad);
+                                        itemID = Unit_Quad;
                                     } else if(pStarPort->isAvailableToBuild(Unit_Trike) && choam.getNumAvailable(Unit_Trike) > 0 && choam.isCheap(Unit_Trike)) {
-                                        doProduceItem(pBuilder, Unit_Trike);
+                                        itemID = Unit_Trike;
+                                    }
+
+                                    if(itemID != NONE) {
+                                        doProduceItem(pBuilder, itemID);
+                                        credits -= choam.getPrice(itemID);
                                     }
                                     num--;
                                 }
@@ -648,8 +665,9 @@ void AIPlayer::build() {
 void AIPlayer::attack() {
     Coord destination;
     const UnitBase* pLeaderUnit = NULL;
-    RobustList<const UnitBase*>::const_iterator iter;
-    for(iter = getUnitList().begin(); iter != getUnitList().end(); ++iter) {
+    const std::vector<const UnitBase*>& units = getUnitList();
+    std::vector<const UnitBase*>::const_iterator iter;
+    for(iter = units.begin(); iter != units.end(); ++iter) {
         const UnitBase *pUnit = *iter;
         if (pUnit->isRespondable()
             && (pUnit->getOwner() == getHouse())
@@ -690,26 +708,37 @@ void AIPlayer::attack() {
 }
 
 void AIPlayer::checkAllUnits() {
-    RobustList<const UnitBase*>::const_iterator iter;
-    for(iter = getUnitList().begin(); iter != getUnitList().end(); ++iter) {
+    const std::vector<const UnitBase*>& units = getUnitList();
+
+    // collect our harvesters that are not on rock once instead of searching them for every sandworm
+    std::vector<const Harvester*> harvestersOnSand;
+    std::vector<const UnitBase*>::const_iterator iter;
+    for(iter = units.begin(); iter != units.end(); ++iter) {
+        const UnitBase* pUnit = *iter;
+
+        if(pUnit->getOwner() == getHouse() && pUnit->getItemID() == Unit_Harvester) {
+            const Harvester* pHarvester = dynamic_cast<const Harvester*>(pUnit);
+            if( pHarvester != NULL
+                && getMap().tileExists(pHarvester->getLocation())
+                && !getMap().getTile(pHarvester->getLocation())->isRock()) {
+                harvestersOnSand.push_back(pHarvester);
+            }
+        }
+    }
+
+    for(iter = units.begin(); iter != units.end(); ++iter) {
         const UnitBase* pUnit = *iter;
 
         if(pUnit->getItemID() == Unit_Sandworm) {
-                RobustList<const UnitBase*>::const_iterator iter2;
-                for(iter2 = getUnitList().begin(); iter2 != getUnitList().end(); ++iter2) {
-                    const UnitBase* pUnit2 = *iter2;
-
-                    if(pUnit2->getOwner() == getHouse() && pUnit2->getItemID() == Unit_Harvester) {
-                        const Harvester* pHarvester = dynamic_cast<const Harvester*>(pUnit2);
-                        if( pHarvester != NULL
-                            && getMap().tileExists(pHarvester->getLocation())
-                            && !getMap().getTile(pHarvester->getLocation())->isRock()
-                            && blockDistance(pUnit->getLocation(), pHarvester->getLocation()) <= 5) {
-                            doReturn(pHarvester);
-                            scrambleUnitsAndDefend(pUnit);
-                        }
-                    }
+            std::vector<const Harvester*>::const_iterator iter2;
+            for(iter2 = harvestersOnSand.begin(); iter2 != harvestersOnSand.end(); ++iter2) {
+                const Harvester* pHarvester = *iter2;
+
+                if(blockDistance(pUnit->getLocation(), pHarvester->getLocation()) <= 5) {
+                    doReturn(pHarvester);
+                    scrambleUnitsAndDefend(pUnit);
                 }
+            }
         }
 
         if(pUnit->getOwner() != getHouse()) {
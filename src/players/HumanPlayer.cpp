@@ -37,6 +37,7 @@ HumanPlayer::HumanPlayer(InputStream& stream, House* associatedHouse) : Player(s
 
 void HumanPlayer::init() {
     nextExpectedCommandsCycle = 0;
+    acknowledgedCommandsCycle = 0;
 }
 
 HumanPlayer::~HumanPlayer() {
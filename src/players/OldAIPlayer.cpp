@@ -79,11 +79,26 @@ void OldAIPlayer::save(OutputStream& stream) const {
 
 
 void OldAIPlayer::update() {
+	if(attackTimer > 0) {
+	    attackTimer--;
+	}
+
+	if(buildTimer > 0) {
+		buildTimer--;
+	}
+}
+
+bool OldAIPlayer::wantsToThink() const {
+    return (buildTimer == 0) || (attackTimer <= 0);
+}
+
+void OldAIPlayer::onThink() {
 	bool bConstructionYardChecked = false;
 	if(buildTimer == 0) {
 
-		RobustList<const StructureBase*>::const_iterator iter;
-		for(iter = getStructureList().begin(); iter != getStructureList().end(); ++iter) {
+		const std::vector<const StructureBase*>& structures = getStructureList();
+		std::vector<const StructureBase*>::const_iterator iter;
+		for(iter = structures.begin(); iter != structures.end(); ++iter) {
             const StructureBase* pStructure = *iter;
 
             //if this players structure, and its a heavy factory, build something
@@ -285,10 +300,22 @@ void OldAIPlayer::update() {
                         case Structure_StarPort: {
                             const StarPort* pStarPort = dynamic_cast<const StarPort*>(pBuilder);
                             if(pStarPort->okToOrder())	{
+                                // the orders are executed after thinking, so we choose the random units ourselves and keep track of the credits spent
+                                std::vector<BuildItem> orderableItems;
+                                std::list<BuildItem>::const_iterator buildItemIter;
+                                for(buildItemIter = pStarPort->getBuildList().begin(); buildItemIter != pStarPort->getBuildList().end(); ++buildItemIter) {
+                                    if((buildItemIter->itemID != Unit_Harvester) && (buildItemIter->itemID != Unit_MCV) && (buildItemIter->itemID != Unit_Carryall)) {
+                                        orderableItems.push_back(*buildItemIter);
+                                    }
+                                }
+
                                 // order max 6 units
                                 int num = 6;
-                                while((num > 0) && (getHouse()->getCredits() > 2000)) {
-                                    doBuildRandom(pStarPort);
+                                int credits = getHouse()->getCredits();
+                                while((num > 0) && (credits > 2000) && !orderableItems.empty()) {
+                                    const BuildItem& buildItem = orderableItems[getRandomGen().rand(0, (int) orderableItems.size() - 1)];
+                                    doProduceItem(pStarPort, buildItem.itemID);
+                                    credits -= buildItem.price;
                                     num--;
                                 }
                                 doPlaceOrder(pStarPort);
@@ -311,13 +338,12 @@ void OldAIPlayer::update() {
 	}
 
 
-	if(attackTimer > 0) {
-	    attackTimer--;
-	} else {
+	if(attackTimer <= 0) {
         Coord destination;
         const UnitBase* pLeaderUnit = NULL;
-        RobustList<const UnitBase*>::const_iterator iter;
-	    for(iter = getUnitList().begin(); iter != getUnitList().end(); ++iter) {
+        const std::vector<const UnitBase*>& units = getUnitList();
+        std::vector<const UnitBase*>::const_iterator iter;
+	    for(iter = units.begin(); iter != units.end(); ++iter) {
             const UnitBase *pUnit = *iter;
             if (pUnit->isRespondable()
                 && (pUnit->getOwner() == getHouse())
@@ -353,12 +379,8 @@ void OldAIPlayer::update() {
             }
         }
 
-		//reset timer for next attack
-		attackTimer = getRandomGen().rand(10000, 20000);
-	}
-
-	if(buildTimer > 0) {
-		buildTimer--;
+		//reset timer for next attack (update() will count down the first cycle right after thinking)
+		attackTimer = getRandomGen().rand(10000, 20000) + 1;
 	}
 }
 
@@ -370,7 +392,7 @@ void OldAIPlayer::onDecrementStructures(int itemID, const Coord& location) {
 	//rebuild the structure if its the original gameType
 
 	if (((currentGame->gameType == GAMETYPE_CAMPAIGN) || (currentGame->gameType == GAMETYPE_SKIRMISH)) && !structureList.empty()) {
-		RobustList<StructureBase*>::const_iterator iter;
+		DenseList<StructureBase*>::const_iterator iter;
 		for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
 			StructureBase* structure = *iter;
 			if ((structure->getItemID() == Structure_ConstructionYard) && (structure->getOwner() == this)) {
@@ -448,8 +470,9 @@ void OldAIPlayer::setAttackTimer(int newAttackTimer) {
 }
 
 void OldAIPlayer::scrambleUnitsAndDefend(Uint32 intruderID) {
-    RobustList<const UnitBase*>::const_iterator iter;
-    for(iter = getUnitList().begin(); iter != getUnitList().end(); ++iter) {
+    const std::vector<const UnitBase*>& units = getUnitList();
+    std::vector<const UnitBase*>::const_iterator iter;
+    for(iter = units.begin(); iter != units.end(); ++iter) {
         const UnitBase* pUnit = *iter;
         if(pUnit->isRespondable() && (pUnit->getOwner() == getHouse())) {
 
@@ -476,8 +499,9 @@ Coord OldAIPlayer::findPlaceLocation(Uint32 itemID) {
     int minY = getMap().getSizeY();
     int maxY = -1;
 
-    RobustList<const StructureBase*>::const_iterator iter;
-    for(iter = getStructureList().begin(); iter != getStructureList().end(); ++iter) {
+    const std::vector<const StructureBase*>& structures = getStructureList();
+    std::vector<const StructureBase*>::const_iterator iter;
+    for(iter = structures.begin(); iter != structures.end(); ++iter) {
 		const StructureBase* structure = *iter;
 		if (structure->getOwner() == getHouse()) {
 			if (structure->getX() < minX)
@@ -500,6 +524,14 @@ Coord OldAIPlayer::findPlaceLocation(Uint32 itemID) {
 	if (minY < 0) minY = 0;
 	if (maxY >= getMap().getSizeY()) maxY = getMap().getSizeY() - structureSizeY;
 
+    // collect the locations of the enemy structures once instead of for every candidate
+    std::vector<Coord> enemyStructureLocations;
+    for(iter = structures.begin(); iter != structures.end(); ++iter) {
+        if((*iter)->getOwner()->getTeam() != getHouse()->getTeam()) {
+            enemyStructureLocations.push_back((*iter)->getLocation());
+        }
+    }
+
     float bestrating = 0.0f;
 	count = 0;
 	do {
@@ -515,8 +547,8 @@ Coord OldAIPlayer::findPlaceLocation(Uint32 itemID) {
 		    switch(itemID) {
                 case Structure_Refinery: {
                     // place near spice
-                    Coord spicePos;
-                    if(getMap().findSpice(spicePos, pos)) {
+                    Coord spicePos = getMap().getSpiceIndex().findNearestSpice(pos, false);
+                    if(spicePos.isValid()) {
                         rating = 10000000.0f - blockDistance(pos, spicePos);
                     } else {
                         rating = 10000000.0f;
@@ -534,17 +566,9 @@ Coord OldAIPlayer::findPlaceLocation(Uint32 itemID) {
 
                     float nearestSand = 10000000.0f;
 
-                    for(int y = 0 ; y < currentGameMap->getSizeY(); y++) {
-                        for(int x = 0; x < currentGameMap->getSizeX(); x++) {
-                            int type = currentGameMap->getTile(x,y)->getType();
-
-                            if(type != Terrain_Rock || type != Terrain_Slab || type != Terrain_Mountain) {
-                                float tmp = blockDistance(pos, Coord(x,y));
-                                if(tmp < nearestSand) {
-                                    nearestSand = tmp;
-                                }
-                            }
-                        }
+                    Coord sandPos = getMap().getBuildSiteGrid().getNearestSand(pos);
+                    if(sandPos.isValid()) {
+                        nearestSand = blockDistance(pos, sandPos);
                     }
 
                     rating = 10000000.0f - nearestSand;
@@ -556,15 +580,11 @@ Coord OldAIPlayer::findPlaceLocation(Uint32 itemID) {
                     // place towards enemy
                     float nearestEnemy = 10000000.0f;
 
-                    RobustList<const StructureBase*>::const_iterator iter2;
-                    for(iter2 = getStructureList().begin(); iter2 != getStructureList().end(); ++iter2) {
-                        const StructureBase* pStructure = *iter2;
-                        if(pStructure->getOwner()->getTeam() != getHouse()->getTeam()) {
-
-                            float tmp = blockDistance(pos, pStructure->getLocation());
-                            if(tmp < nearestEnemy) {
-                                nearestEnemy = tmp;
-                            }
+                    std::vector<Coord>::const_iterator iter2;
+                    for(iter2 = enemyStructureLocations.begin(); iter2 != enemyStructureLocations.end(); ++iter2) {
+                        float tmp = blockDistance(pos, *iter2);
+                        if(tmp < nearestEnemy) {
+                            nearestEnemy = tmp;
                         }
                     }
 
@@ -581,15 +601,11 @@ Coord OldAIPlayer::findPlaceLocation(Uint32 itemID) {
                     // place at a save place
                     float nearestEnemy = 10000000.0f;
 
-                    RobustList<const StructureBase*>::const_iterator iter2;
-                    for(iter2 = getStructureList().begin(); iter2 != getStructureList().end(); ++iter2) {
-                        const StructureBase* pStructure = *iter2;
-                        if(pStructure->getOwner()->getTeam() != getHouse()->getTeam()) {
-
-                            float tmp = blockDistance(pos, pStructure->getLocation());
-                            if(tmp < nearestEnemy) {
-                                nearestEnemy = tmp;
-                            }
+                    std::vector<Coord>::const_iterator iter2;
+                    for(iter2 = enemyStructureLocations.begin(); iter2 != enemyStructureLocations.end(); ++iter2) {
+                        float tmp = blockDistance(pos, *iter2);
+                        if(tmp < nearestEnemy) {
+                            nearestEnemy = tmp;
                         }
                     }
 
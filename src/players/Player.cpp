@@ -37,12 +37,19 @@
 
 #include <globals.h>
 
-Player::Player(House* associatedHouse, std::string playername) : pHouse(associatedHouse), playerID(0), playername(playername) {
+std::vector<const StructureBase*> Player::frozenStructureList;
+std::vector<const UnitBase*> Player::frozenUnitList;
+Uint32 Player::frozenStructureListModificationCount = 0;
+Uint32 Player::frozenUnitListModificationCount = 0;
+
+Player::Player(House* associatedHouse, std::string playername) : pHouse(associatedHouse), playerID(0), playername(playername), bThinking(false) {
+    randomGen.setSeed(currentGame->randomGen.rand());
 }
 
-Player::Player(InputStream& stream, House* associatedHouse) : pHouse(associatedHouse) {
+Player::Player(InputStream& stream, House* associatedHouse) : pHouse(associatedHouse), bThinking(false) {
     playerID = stream.readUint8();
     playername = stream.readString();
+    randomGen.setSeed(stream.readUint32());
 }
 
 Player::~Player() {
@@ -52,10 +59,66 @@ Player::~Player() {
 void Player::save(OutputStream& stream) const {
     stream.writeUint8(playerID);
     stream.writeString(playername);
+    stream.writeUint32(randomGen.getSeed());
+}
+
+void Player::think() {
+    bThinking = true;
+    onThink();
+    bThinking = false;
+}
+
+void Player::executeDeferredActions() {
+    std::vector<DeferredAction> actions;
+    actions.swap(deferredActions);
+
+    std::vector<DeferredAction>::const_iterator iter;
+    for(iter = actions.begin(); iter != actions.end(); ++iter) {
+        if(((iter->objectIDs[0] != NONE) && (getObject(iter->objectIDs[0]) == NULL))
+            || ((iter->objectIDs[1] != NONE) && (getObject(iter->objectIDs[1]) == NULL))) {
+            // an object this action refers to was destroyed in the meantime
+            continue;
+        }
+
+        iter->action();
+    }
+}
+
+void Player::freezeObjectLists() {
+    freezeStructureList();
+    freezeUnitList();
+}
+
+void Player::freezeStructureList() {
+    frozenStructureList.clear();
+    frozenStructureListModificationCount = structureList.getModificationCount();
+
+    DenseList<StructureBase*>::const_iterator iter;
+    for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
+        frozenStructureList.push_back(*iter);
+    }
+}
+
+void Player::freezeUnitList() {
+    frozenUnitList.clear();
+    frozenUnitListModificationCount = unitList.getModificationCount();
+
+    DenseList<UnitBase*>::const_iterator iter;
+    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
+        frozenUnitList.push_back(*iter);
+    }
+}
+
+void Player::deferAction(const std::function<void ()>& action, const ObjectBase* pObject1, const ObjectBase* pObject2) {
+    DeferredAction deferredAction;
+    deferredAction.action = action;
+    deferredAction.objectIDs[0] = (pObject1 != NULL) ? pObject1->getObjectID() : NONE;
+    deferredAction.objectIDs[1] = (pObject2 != NULL) ? pObject2->getObjectID() : NONE;
+    deferredActions.push_back(deferredAction);
 }
 
 Random& Player::getRandomGen() const {
-    return currentGame->randomGen;
+    return randomGen;
 }
 
 const GameInitSettings& Player::getGameInitSettings() const {
@@ -74,12 +137,20 @@ const ObjectBase* Player::getObject(Uint32 objectID) const {
     return currentGame->getObjectManager().getObject(objectID);
 }
 
-const RobustList<const StructureBase*>& Player::getStructureList() const {
-    return reinterpret_cast<const RobustList<const StructureBase*>&>(structureList);
+const std::vector<const StructureBase*>& Player::getStructureList() const {
+    if((bThinking == false) && (frozenStructureListModificationCount != structureList.getModificationCount())) {
+        // structures have been created or destroyed since the list was frozen
+        freezeStructureList();
+    }
+    return frozenStructureList;
 }
 
-const RobustList<const UnitBase*>& Player::getUnitList() const {
-    return reinterpret_cast<const RobustList<const UnitBase*>&>(unitList);
+const std::vector<const UnitBase*>& Player::getUnitList() const {
+    if((bThinking == false) && (frozenUnitListModificationCount != unitList.getModificationCount())) {
+        // units have been created or destroyed since the list was frozen
+        freezeUnitList();
+    }
+    return frozenUnitList;
 }
 
 const House* Player::getHouse(int houseID) const {
@@ -90,6 +161,11 @@ const House* Player::getHouse(int houseID) const {
 }
 
 void Player::doRepair(const ObjectBase* pObject) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doRepair, this, pObject), pObject);
+        return;
+    }
+
     if(pObject->getOwner() == getHouse()) {
         const_cast<ObjectBase*>(pObject)->doRepair();
     } else {
@@ -98,6 +174,11 @@ void Player::doRepair(const ObjectBase* pObject) {
 }
 
 void Player::doSetDeployPosition(const StructureBase* pStructure, int x, int y) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doSetDeployPosition, this, pStructure, x, y), pStructure);
+        return;
+    }
+
     if(pStructure->getOwner() == getHouse()) {
         const_cast<StructureBase*>(pStructure)->doSetDeployPosition(x, y);
     } else {
@@ -106,6 +187,11 @@ void Player::doSetDeployPosition(const StructureBase* pStructure, int x, int y)
 }
 
 bool Player::doUpgrade(const BuilderBase* pBuilder) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doUpgrade, this, pBuilder), pBuilder);
+        return true;
+    }
+
     if(pBuilder->getOwner() == getHouse()) {
         return const_cast<BuilderBase*>(pBuilder)->doUpgrade();
     } else {
@@ -115,6 +201,11 @@ bool Player::doUpgrade(const BuilderBase* pBuilder) {
 }
 
 void Player::doProduceItem(const BuilderBase* pBuilder, Uint32 itemID) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doProduceItem, this, pBuilder, itemID), pBuilder);
+        return;
+    }
+
     if(pBuilder->getOwner() == getHouse()) {
         const_cast<BuilderBase*>(pBuilder)->doProduceItem(itemID);
     } else {
@@ -123,6 +214,11 @@ void Player::doProduceItem(const BuilderBase* pBuilder, Uint32 itemID) {
 }
 
 void Player::doCancelItem(const BuilderBase* pBuilder, Uint32 itemID) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doCancelItem, this, pBuilder, itemID), pBuilder);
+        return;
+    }
+
     if(pBuilder->getOwner() == getHouse()) {
         const_cast<BuilderBase*>(pBuilder)->doCancelItem(itemID);
     } else {
@@ -131,6 +227,11 @@ void Player::doCancelItem(const BuilderBase* pBuilder, Uint32 itemID) {
 }
 
 void Player::doSetOnHold(const BuilderBase* pBuilder, bool bOnHold) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doSetOnHold, this, pBuilder, bOnHold), pBuilder);
+        return;
+    }
+
     if(pBuilder->getOwner() == getHouse()) {
         const_cast<BuilderBase*>(pBuilder)->doSetOnHold(bOnHold);
     } else {
@@ -139,6 +240,11 @@ void Player::doSetOnHold(const BuilderBase* pBuilder, bool bOnHold) {
 }
 
 void Player::doBuildRandom(const BuilderBase* pBuilder) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doBuildRandom, this, pBuilder), pBuilder);
+        return;
+    }
+
     if(pBuilder->getOwner() == getHouse()) {
         const_cast<BuilderBase*>(pBuilder)->doBuildRandom();
     } else {
@@ -147,6 +253,11 @@ void Player::doBuildRandom(const BuilderBase* pBuilder) {
 }
 
 void Player::doPlaceOrder(const StarPort* pStarport) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doPlaceOrder, this, pStarport), pStarport);
+        return;
+    }
+
     if(pStarport->getOwner() == getHouse()) {
         const_cast<StarPort*>(pStarport)->doPlaceOrder();
     } else {
@@ -155,6 +266,11 @@ void Player::doPlaceOrder(const StarPort* pStarport) {
 }
 
 bool Player::doPlaceStructure(const ConstructionYard* pConstYard, int x, int y) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doPlaceStructure, this, pConstYard, x, y), pConstYard);
+        return true;
+    }
+
     if(pConstYard->getOwner() == getHouse()) {
         return const_cast<ConstructionYard*>(pConstYard)->doPlaceStructure(x, y);
     } else {
@@ -164,6 +280,11 @@ bool Player::doPlaceStructure(const ConstructionYard* pConstYard, int x, int y)
 }
 
 void Player::doSpecialWeapon(const Palace* pPalace) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doSpecialWeapon, this, pPalace), pPalace);
+        return;
+    }
+
     if(pPalace->getOwner() == getHouse()) {
         const_cast<Palace*>(pPalace)->doSpecialWeapon();
     } else {
@@ -172,6 +293,11 @@ void Player::doSpecialWeapon(const Palace* pPalace) {
 }
 
 void Player::doLaunchDeathhand(const Palace* pPalace, int x, int y) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doLaunchDeathhand, this, pPalace, x, y), pPalace);
+        return;
+    }
+
     if(pPalace->getOwner() == getHouse()) {
         const_cast<Palace*>(pPalace)->doLaunchDeathhand(x, y);
     } else {
@@ -180,6 +306,11 @@ void Player::doLaunchDeathhand(const Palace* pPalace, int x, int y) {
 }
 
 void Player::doAttackObject(const TurretBase* pTurret, const ObjectBase* pTargetObject) {
+    if(bThinking) {
+        deferAction(std::bind(static_cast<void (Player::*)(const TurretBase*, const ObjectBase*)>(&Player::doAttackObject), this, pTurret, pTargetObject), pTurret, pTargetObject);
+        return;
+    }
+
     if(pTurret->getOwner() == getHouse()) {
         const_cast<TurretBase*>(pTurret)->doAttackObject(pTargetObject);
     } else {
@@ -191,6 +322,11 @@ void Player::doAttackObject(const TurretBase* pTurret, const ObjectBase* pTarget
 
 
 void Player::doMove2Pos(const UnitBase* pUnit, int x, int y, bool bForced) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doMove2Pos, this, pUnit, x, y, bForced), pUnit);
+        return;
+    }
+
     if(pUnit->getOwner() == getHouse()) {
         const_cast<UnitBase*>(pUnit)->doMove2Pos(x, y, bForced);
     } else {
@@ -200,6 +336,11 @@ void Player::doMove2Pos(const UnitBase* pUnit, int x, int y, bool bForced) {
 }
 
 void Player::doMove2Object(const UnitBase* pUnit, const ObjectBase* pTargetObject) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doMove2Object, this, pUnit, pTargetObject), pUnit, pTargetObject);
+        return;
+    }
+
     if(pUnit->getOwner() == getHouse()) {
         const_cast<UnitBase*>(pUnit)->doMove2Object(pTargetObject);
     } else {
@@ -209,6 +350,11 @@ void Player::doMove2Object(const UnitBase* pUnit, const ObjectBase* pTargetObjec
 }
 
 void Player::doAttackPos(const UnitBase* pUnit, int x, int y, bool bForced) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doAttackPos, this, pUnit, x, y, bForced), pUnit);
+        return;
+    }
+
     if(pUnit->getOwner() == getHouse()) {
         const_cast<UnitBase*>(pUnit)->doAttackPos(x, y, bForced);
     } else {
@@ -218,6 +364,11 @@ void Player::doAttackPos(const UnitBase* pUnit, int x, int y, bool bForced) {
 }
 
 void Player::doAttackObject(const UnitBase* pUnit, const ObjectBase* pTargetObject, bool bForced) {
+    if(bThinking) {
+        deferAction(std::bind(static_cast<void (Player::*)(const UnitBase*, const ObjectBase*, bool)>(&Player::doAttackObject), this, pUnit, pTargetObject, bForced), pUnit, pTargetObject);
+        return;
+    }
+
     if(pUnit->getOwner() == getHouse()) {
         const_cast<UnitBase*>(pUnit)->doAttackObject(pTargetObject, bForced);
     } else {
@@ -227,6 +378,11 @@ void Player::doAttackObject(const UnitBase* pUnit, const ObjectBase* pTargetObje
 }
 
 void Player::doSetAttackMode(const UnitBase* pUnit, ATTACKMODE attackMode) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doSetAttackMode, this, pUnit, attackMode), pUnit);
+        return;
+    }
+
     if(pUnit->getOwner() == getHouse()) {
         const_cast<UnitBase*>(pUnit)->doSetAttackMode(attackMode);
     } else {
@@ -236,6 +392,11 @@ void Player::doSetAttackMode(const UnitBase* pUnit, ATTACKMODE attackMode) {
 }
 
 void Player::doStartDevastate(const Devastator* pDevastator) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doStartDevastate, this, pDevastator), pDevastator);
+        return;
+    }
+
     if(pDevastator->getOwner() == getHouse()) {
         const_cast<Devastator*>(pDevastator)->doStartDevastate();
     } else {
@@ -245,6 +406,11 @@ void Player::doStartDevastate(const Devastator* pDevastator) {
 }
 
 void Player::doReturn(const Harvester* pHarvester) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doReturn, this, pHarvester), pHarvester);
+        return;
+    }
+
     if(pHarvester->getOwner() == getHouse()) {
         const_cast<Harvester*>(pHarvester)->doReturn();
     } else {
@@ -254,6 +420,11 @@ void Player::doReturn(const Harvester* pHarvester) {
 }
 
 void Player::doCaptureStructure(const InfantryBase* pInfantry, const StructureBase* pTargetStructure) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doCaptureStructure, this, pInfantry, pTargetStructure), pInfantry, pTargetStructure);
+        return;
+    }
+
     if(pInfantry->getOwner() == getHouse()) {
         const_cast<InfantryBase*>(pInfantry)->doCaptureStructure(pTargetStructure);
     } else {
@@ -263,6 +434,11 @@ void Player::doCaptureStructure(const InfantryBase* pInfantry, const StructureBa
 }
 
 bool Player::doDeploy(const MCV* pMCV) {
+    if(bThinking) {
+        deferAction(std::bind(&Player::doDeploy, this, pMCV), pMCV);
+        return true;
+    }
+
     if(pMCV->getOwner() == getHouse()) {
         return const_cast<MCV*>(pMCV)->doDeploy();
     } else {
@@ -642,19 +642,49 @@ float getDeviateWeakness(HOUSETYPE house) {
 	\param	filename	the filename of the replay file
 */
 void startReplay(std::string filename) {
-    printf("Initing Replay:\n");
+    Uint32 startCycle = 0;
+
+    do {
+        printf("Initing Replay:\n");
+        currentGame = new Game();
+        currentGame->initReplay(filename, startCycle);
+
+        printf("Initialization finished!\n");
+        fflush(stdout);
+
+        currentGame->runMainLoop();
+
+        // the player may have skipped to a later keyframe
+        startCycle = currentGame->getReplaySeekCycle();
+
+        delete currentGame;
+    } while(startCycle != 0);
+
+    // Change music to menu music
+    musicPlayer->changeMusic(MUSIC_MENU);
+}
+
+
+/**
+	Simulates a replay as fast as possible without drawing anything and prints the timing results (see Game::runBenchmark())
+	\param	filename	the filename of the replay file
+	\param	maxCycles	the maximum number of game cycles to simulate (0 = until the end of the replay)
+	\return the hash of the final game state
+*/
+std::string benchmarkReplay(std::string filename, Uint32 maxCycles) {
+    printf("Initing Replay Benchmark:\n");
     currentGame = new Game();
     currentGame->initReplay(filename);
 
     printf("Initialization finished!\n");
     fflush(stdout);
 
-    currentGame->runMainLoop();
+    std::string stateHash = currentGame->runBenchmark(maxCycles);
 
     delete currentGame;
+    currentGame = NULL;
 
-    // Change music to menu music
-    musicPlayer->changeMusic(MUSIC_MENU);
+    return stateHash;
 }
 
 
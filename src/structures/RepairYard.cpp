@@ -135,7 +135,7 @@ void RepairYard::updateStructureSpecificStuff() {
 		    // find carryall
 		    Carryall* pCarryall = NULL;
             if((pRepairUnit->getGuardPoint().isValid()) && getOwner()->hasCarryalls())	{
-                RobustList<UnitBase*>::const_iterator iter;
+                DenseList<UnitBase*>::const_iterator iter;
                 for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
                     UnitBase* unit = *iter;
                     if ((unit->getOwner() == owner) && (unit->getItemID() == Unit_Carryall)) {
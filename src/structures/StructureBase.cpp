@@ -73,6 +73,11 @@ void StructureBase::init() {
 
 StructureBase::~StructureBase() {
     currentGameMap->removeObjectFromMap(getObjectID());	//no map point will reference now
+    for(int i = location.x; i < location.x + structureSize.x; i++) {
+        for(int j = location.y; j < location.y + structureSize.y; j++) {
+            currentGameMap->getPathClusterGraph().invalidateTile(i, j);
+        }
+    }
 	currentGame->getObjectManager().removeObject(getObjectID());
 	structureList.remove(this);
 	owner->decrementStructures(itemID, location);
@@ -132,7 +137,7 @@ void StructureBase::blitToScreen() {
     int imageW = graphic[currentZoomlevel]->w/numImagesX;
     int imageH = graphic[currentZoomlevel]->h/numImagesY;
 
-    SDL_Rect dest = { screenborder->world2screenX((int) lround(realX)), screenborder->world2screenY((int) lround(realY)), imageW, imageH };
+    SDL_Rect dest = { screenborder->world2screenX(realX.roundToInt()), screenborder->world2screenY(realY.roundToInt()), imageW, imageH };
     SDL_Rect source = { imageW * (fogged ? lastVisibleFrame : curAnimFrame), 0, imageW, imageH };
 
     SDL_BlitSurface(graphic[currentZoomlevel], &source, screen, &dest);
@@ -175,8 +180,8 @@ void StructureBase::drawSelectionBox() {
     int imageH = graphic[currentZoomlevel]->h/numImagesY;
 
 	SDL_Rect dest;
-	dest.x = screenborder->world2screenX((int) realX);
-	dest.y = screenborder->world2screenY((int) realY);
+	dest.x = screenborder->world2screenX(realX.toInt());
+	dest.y = screenborder->world2screenY(realY.toInt());
 	dest.w = imageW;
 	dest.h = imageH;
 
@@ -221,8 +226,8 @@ void StructureBase::drawOtherPlayerSelectionBox() {
     int imageH = graphic[currentZoomlevel]->h/numImagesY;
 
 	SDL_Rect dest;
-	dest.x = screenborder->world2screenX((int) realX) + (currentZoomlevel+1);
-	dest.y = screenborder->world2screenY((int) realY) + (currentZoomlevel+1);
+	dest.x = screenborder->world2screenX(realX.toInt()) + (currentZoomlevel+1);
+	dest.y = screenborder->world2screenY(realY.toInt()) + (currentZoomlevel+1);
 	dest.w = imageW - 2*(currentZoomlevel+1);
 	dest.h = imageH - 2*(currentZoomlevel+1);
 
@@ -264,8 +269,8 @@ void StructureBase::drawOtherPlayerSelectionBox() {
     \return the center point in world coordinates
 */
 Coord StructureBase::getCenterPoint() const {
-    return Coord( lround(realX + structureSize.x*TILESIZE/2),
-                  lround(realY + structureSize.y*TILESIZE/2));
+    return Coord( (realX + structureSize.x*TILESIZE/2).roundToInt(),
+                  (realY + structureSize.y*TILESIZE/2).roundToInt());
 }
 
 Coord StructureBase::getClosestCenterPoint(const Coord& objectLocation) const {
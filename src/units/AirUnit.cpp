@@ -60,7 +60,7 @@ void AirUnit::save(OutputStream& stream) const
 void AirUnit::destroy()
 {
     if(isVisible()) {
-        Coord position(lround(realX), lround(realY));
+        Coord position(realX.roundToInt(), realY.roundToInt());
         currentGame->getExplosionList().push_back(new Explosion(Explosion_Medium2, position, owner->getHouseID()));
 
         if(isVisible(getOwner()->getTeam()))
@@ -87,7 +87,7 @@ void AirUnit::blitToScreen()
     int imageW = graphic[currentZoomlevel]->w/numImagesX;
     int imageH = graphic[currentZoomlevel]->h/numImagesY;
 
-    if(screenborder->isInsideScreen(Coord(lround(realX + 4), lround(realY + 12)),Coord(imageW, imageH)) == true) {
+    if(screenborder->isInsideScreen(Coord((realX + 4).roundToInt(), (realY + 12).roundToInt()),Coord(imageW, imageH)) == true) {
 		// Not out of screen
 
         SDL_Rect dest = { screenborder->world2screenX(realX + 4) - imageW/2 + 1, screenborder->world2screenY(realY + 12) - imageH/2, imageW, imageH };
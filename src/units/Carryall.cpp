@@ -48,7 +48,7 @@ Carryall::Carryall(House* newOwner) : AirUnit(newOwner)
     droppedOffCargo = false;
     respondable = false;
 
-    currentMaxSpeed = 2.0f;
+    currentMaxSpeed = 2;
 
 	curFlyPoint = 0;
 	for(int i=0; i < 8; i++) {
@@ -68,7 +68,7 @@ Carryall::Carryall(InputStream& stream) : AirUnit(stream)
 
     stream.readBools(&booked, &idle, &firstRun, &owned, &aDropOfferer, &droppedOffCargo);
 
-	currentMaxSpeed = stream.readFloat();
+	currentMaxSpeed = stream.readFixPoint();
 
 	curFlyPoint = stream.readUint8();
 	for(int i=0; i < 8; i++) {
@@ -107,7 +107,7 @@ void Carryall::save(OutputStream& stream) const
 
     stream.writeBools(booked, idle, firstRun, owned, aDropOfferer, droppedOffCargo);
 
-	stream.writeFloat(currentMaxSpeed);
+	stream.writeFixPoint(currentMaxSpeed);
 
 	stream.writeUint8(curFlyPoint);
 	for(int i=0; i < 8; i++) {
@@ -124,14 +124,16 @@ bool Carryall::update() {
         return false;
     }
 
-    float dist = distanceFrom(location.x*TILESIZE + TILESIZE/2, location.y*TILESIZE + TILESIZE/2,
-                                destination.x*TILESIZE + TILESIZE/2, destination.y*TILESIZE + TILESIZE/2);
+    FixPoint dist = distanceFrom(   FixPoint(location.x*TILESIZE + TILESIZE/2), FixPoint(location.y*TILESIZE + TILESIZE/2),
+                                    FixPoint(destination.x*TILESIZE + TILESIZE/2), FixPoint(destination.y*TILESIZE + TILESIZE/2));
 
-    if((target || hasCargo()) && dist < 256.0f) {
-        currentMaxSpeed = (((2.0f - currentGame->objectData.data[itemID][originalHouseID].maxspeed)/256.0f) * (256.0f - dist)) + currentGame->objectData.data[itemID][originalHouseID].maxspeed;
+    const FixPoint maxSpeed = currentGame->objectData.data[itemID][originalHouseID].maxspeed;
+
+    if((target || hasCargo()) && dist < 256) {
+        currentMaxSpeed = ((2 - maxSpeed) * (256 - dist))/256 + maxSpeed;
         setSpeeds();
     } else {
-        currentMaxSpeed = std::min(currentMaxSpeed + 0.2f, currentGame->objectData.data[itemID][originalHouseID].maxspeed);
+        currentMaxSpeed = std::min(currentMaxSpeed + FixPoint::fromFloat(0.2f), maxSpeed);
         setSpeeds();
     }
 
@@ -151,7 +153,7 @@ bool Carryall::update() {
 	return true;
 }
 
-float Carryall::getMaxSpeed() const {
+FixPoint Carryall::getMaxSpeed() const {
     return currentMaxSpeed;
 }
 
@@ -274,7 +276,7 @@ void Carryall::deployUnit(Uint32 unitID)
     }
 
 	if (found) {
-	    currentMaxSpeed = 0.0f;
+	    currentMaxSpeed = 0;
 	    setSpeeds();
 
 	    if (currentGameMap->getTile(location)->hasANonInfantryGroundObject()) {
@@ -338,7 +340,7 @@ void Carryall::destroy()
 	// place wreck
     if(isVisible() && currentGameMap->tileExists(location)) {
         Tile* pTile = currentGameMap->getTile(location);
-        pTile->assignDeadUnit(DeadUnit_Carrall, owner->getHouseID(), Coord((Sint32) realX, (Sint32) realY));
+        pTile->assignDeadUnit(DeadUnit_Carrall, owner->getHouseID(), Coord(realX.toInt(), realY.toInt()));
     }
 
 	AirUnit::destroy();
@@ -387,7 +389,7 @@ void Carryall::engageTarget()
         targetLocation = target.getObjPointer()->getClosestPoint(location);
     }
 
-    Coord realLocation = Coord(lround(realX), lround(realY));
+    Coord realLocation = Coord(realX.roundToInt(), realY.roundToInt());
     Coord realDestination = targetLocation * TILESIZE + Coord(TILESIZE/2,TILESIZE/2);
 
     targetAngle = lround((float)NUM_ANGLES*destinationAngle(location, destination)/256.0f);
@@ -438,7 +440,7 @@ void Carryall::giveCargo(UnitBase* newUnit)
 
 void Carryall::pickupTarget()
 {
-    currentMaxSpeed = 0.0f;
+    currentMaxSpeed = 0;
     setSpeeds();
 
     ObjectBase* pTarget = target.getObjPointer();
@@ -529,7 +531,7 @@ void Carryall::findConstYard() {
     float	closestYardDistance = 1000000.0f;
     ConstructionYard* bestYard = NULL;
 
-    RobustList<StructureBase*>::const_iterator iter;
+    DenseList<StructureBase*>::const_iterator iter;
     for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
         StructureBase* tempStructure = *iter;
 
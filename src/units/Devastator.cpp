@@ -127,7 +127,7 @@ void Devastator::destroy()
     if(currentGameMap->tileExists(location) && isVisible()) {
         for(int i = 0; i < 3; i++) {
             for(int j = 0; j < 3; j++) {
-                Coord realPos(lround(realX) + (i - 1)*TILESIZE, lround(realY) + (j - 1)*TILESIZE);
+                Coord realPos(realX.roundToInt() + (i - 1)*TILESIZE, realY.roundToInt() + (j - 1)*TILESIZE);
 
                 currentGameMap->damage(objectID, owner, realPos, itemID, 250, 16, false);
 
@@ -119,7 +119,7 @@ bool GroundUnit::requestCarryall() {
 	if (getOwner()->hasCarryalls())	{
 		Carryall* carryall = NULL;
 
-        RobustList<UnitBase*>::const_iterator iter;
+        DenseList<UnitBase*>::const_iterator iter;
 	    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
 			UnitBase* unit = *iter;
 			if ((unit->getOwner() == owner) && (unit->getItemID() == Unit_Carryall)) {
@@ -182,7 +182,7 @@ void GroundUnit::doRepair() {
 		float	closestLeastBookedRepairYardDistance = 1000000.0f;
         RepairYard* bestRepairYard = NULL;
 
-        RobustList<StructureBase*>::const_iterator iter;
+        DenseList<StructureBase*>::const_iterator iter;
         for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
             StructureBase* tempStructure = *iter;
 
@@ -172,7 +172,7 @@ void Harvester::checkPos()
 				float	closestLeastBookedRefineryDistance = 1000000.0f;
 				Refinery	*bestRefinery = NULL;
 
-                RobustList<StructureBase*>::const_iterator iter;
+                DenseList<StructureBase*>::const_iterator iter;
                 for(iter = structureList.begin(); iter != structureList.end(); ++iter) {
 					StructureBase* tempStructure = *iter;
 
@@ -277,7 +277,7 @@ void Harvester::destroy()
 
         setTarget(NULL);
 
-        Coord realPos(lround(realX), lround(realY));
+        Coord realPos(realX.roundToInt(), realY.roundToInt());
         Uint32 explosionID = currentGame->randomGen.getRandOf(2,Explosion_Medium1, Explosion_Medium2);
         currentGame->getExplosionList().push_back(new Explosion(explosionID, realPos, owner->getHouseID()));
 
@@ -464,23 +464,14 @@ float Harvester::extractSpice(float extractionSpeed)
 
 void Harvester::setSpeeds()
 {
-	float speed = getMaxSpeed();
+	FixPoint speed = getMaxSpeed();
 
 	if(isBadlyDamaged()) {
-        speed *= HEAVILYDAMAGEDSPEEDMULTIPLIER;
+        speed *= FixPoint::fromFloat(HEAVILYDAMAGEDSPEEDMULTIPLIER);
 	}
 
-    float percentFull = spice/HARVESTERMAXSPICE;
-	speed = speed * (1 - MAXIMUMHARVESTERSLOWDOWN*percentFull);
-
-	switch(drawnAngle){
-        case LEFT:      xSpeed = -speed;                    ySpeed = 0;         break;
-        case LEFTUP:    xSpeed = -speed*DIAGONALSPEEDCONST; ySpeed = xSpeed;    break;
-        case UP:        xSpeed = 0;                         ySpeed = -speed;    break;
-        case RIGHTUP:   xSpeed = speed*DIAGONALSPEEDCONST;  ySpeed = -xSpeed;   break;
-        case RIGHT:     xSpeed = speed;                     ySpeed = 0;         break;
-        case RIGHTDOWN: xSpeed = speed*DIAGONALSPEEDCONST;  ySpeed = xSpeed;    break;
-        case DOWN:      xSpeed = 0;                         ySpeed = speed;     break;
-        case LEFTDOWN:  xSpeed = -speed*DIAGONALSPEEDCONST; ySpeed = -xSpeed;   break;
-	}
+    FixPoint percentFull = FixPoint::fromFloat(spice)/HARVESTERMAXSPICE;
+	speed = speed * (1 - FixPoint::fromFloat(MAXIMUMHARVESTERSLOWDOWN)*percentFull);
+
+	setSpeedsForDrawnAngle(speed);
 }
@@ -32,7 +32,6 @@
 #include <structures/RepairYard.h>
 #include <units/Harvester.h>
 
-#include <misc/strictmath.h>
 
 // the position on the tile
 Coord tilePositionOffset[5] = { Coord(0,0), Coord(-TILESIZE/4,-TILESIZE/4), Coord(TILESIZE/4,-TILESIZE/4), Coord(-TILESIZE/4,TILESIZE/4), Coord(TILESIZE/4,TILESIZE/4)};
@@ -243,8 +242,8 @@ void InfantryBase::checkPos() {
                         for(int j = capturedStructureLocation.y; j < capturedStructureLocation.y + pCapturedStructure->getStructureSizeY(); j++) {
 
                             // make a copy of infantry list to avoid problems of modifing the list during iteration (!)
-                            const std::list<Uint32> infantryList = currentGameMap->getTile(i,j)->getInfantryList();
-                            std::list<Uint32>::const_iterator iter;
+                            const Tile::InfantryList infantryList = currentGameMap->getTile(i,j)->getInfantryList();
+                            Tile::InfantryList::const_iterator iter;
                             for(iter = infantryList.begin(); iter != infantryList.end(); ++iter) {
                                 if(*iter != getObjectID()) {
                                     ObjectBase* pObject = currentGame->getObjectManager().getObject(*iter);
@@ -338,7 +337,7 @@ void InfantryBase::destroy() {
                 // squashed
                 pTile->assignDeadUnit( currentGame->randomGen.randBool() ? DeadUnit_Infantry_Squashed1 : DeadUnit_Infantry_Squashed2,
                                             owner->getHouseID(),
-                                            Coord(lround(realX), lround(realY)) );
+                                            Coord(realX.roundToInt(), realY.roundToInt()) );
 
                 if(isVisible(getOwner()->getTeam())) {
                     soundPlayer->playSoundAt(Sound_Squashed,location);
@@ -351,7 +350,7 @@ void InfantryBase::destroy() {
             // "normal" dead
             pTile->assignDeadUnit( DeadUnit_Infantry,
                                         owner->getHouseID(),
-                                        Coord(lround(realX), lround(realY)));
+                                        Coord(realX.roundToInt(), realY.roundToInt()));
 
             if(isVisible(getOwner()->getTeam())) {
                 soundPlayer->playSoundAt((Sound_enum) getRandomOf(6,Sound_Scream1,Sound_Scream2,Sound_Scream3,Sound_Scream4,Sound_Scream5,Sound_Trumpet),location);
@@ -373,21 +372,21 @@ void InfantryBase::move() {
 
 
         // check if unit is on the first half of the way
-        float fromDistanceX;
-        float fromDistanceY;
-		float toDistanceX;
-		float toDistanceY;
+        FixPoint fromDistanceX;
+        FixPoint fromDistanceY;
+		FixPoint toDistanceX;
+		FixPoint toDistanceY;
 
-        const float epsilon = 3.75f;
+        const FixPoint epsilon = FixPoint::fromFloat(3.75f);
 
 		if(location != nextSpot) {
-		    float abstractDistanceX = strictmath::abs(location.x*TILESIZE + TILESIZE/2 - (realX-bumpyOffsetX));
-		    float abstractDistanceY = strictmath::abs(location.y*TILESIZE + TILESIZE/2 - (realY-bumpyOffsetY));
+		    FixPoint abstractDistanceX = FixPoint::abs(location.x*TILESIZE + TILESIZE/2 - (realX-bumpyOffsetX));
+		    FixPoint abstractDistanceY = FixPoint::abs(location.y*TILESIZE + TILESIZE/2 - (realY-bumpyOffsetY));
 
-            fromDistanceX = strictmath::abs(location.x*TILESIZE + TILESIZE/2 + tilePositionOffset[oldTilePosition].x - (realX-bumpyOffsetX));
-		    fromDistanceY = strictmath::abs(location.y*TILESIZE + TILESIZE/2 + tilePositionOffset[oldTilePosition].y - (realY-bumpyOffsetY));
-		    toDistanceX = strictmath::abs(nextSpot.x*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].x - (realX-bumpyOffsetX));
-		    toDistanceY = strictmath::abs(nextSpot.y*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].y - (realY-bumpyOffsetY));
+            fromDistanceX = FixPoint::abs(location.x*TILESIZE + TILESIZE/2 + tilePositionOffset[oldTilePosition].x - (realX-bumpyOffsetX));
+		    fromDistanceY = FixPoint::abs(location.y*TILESIZE + TILESIZE/2 + tilePositionOffset[oldTilePosition].y - (realY-bumpyOffsetY));
+		    toDistanceX = FixPoint::abs(nextSpot.x*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].x - (realX-bumpyOffsetX));
+		    toDistanceY = FixPoint::abs(nextSpot.y*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].y - (realY-bumpyOffsetY));
 
 		    // check if unit is half way out of old tile
             if((abstractDistanceX >= TILESIZE/2 + epsilon) || (abstractDistanceY >= TILESIZE/2 + epsilon)) {
@@ -400,21 +399,21 @@ void InfantryBase::move() {
 		    }
 
 		} else {
-            fromDistanceX = strictmath::abs(oldLocation.x*TILESIZE + TILESIZE/2 + tilePositionOffset[oldTilePosition].x - (realX-bumpyOffsetX));
-		    fromDistanceY = strictmath::abs(oldLocation.y*TILESIZE + TILESIZE/2 + tilePositionOffset[oldTilePosition].y - (realY-bumpyOffsetY));
-		    toDistanceX = strictmath::abs(location.x*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].x - (realX-bumpyOffsetX));
-		    toDistanceY = strictmath::abs(location.y*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].y - (realY-bumpyOffsetY));
+            fromDistanceX = FixPoint::abs(oldLocation.x*TILESIZE + TILESIZE/2 + tilePositionOffset[oldTilePosition].x - (realX-bumpyOffsetX));
+		    fromDistanceY = FixPoint::abs(oldLocation.y*TILESIZE + TILESIZE/2 + tilePositionOffset[oldTilePosition].y - (realY-bumpyOffsetY));
+		    toDistanceX = FixPoint::abs(location.x*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].x - (realX-bumpyOffsetX));
+		    toDistanceY = FixPoint::abs(location.y*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].y - (realY-bumpyOffsetY));
 
             Coord	wantedReal;
             wantedReal.x = nextSpot.x*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].x;
             wantedReal.y = nextSpot.y*TILESIZE + TILESIZE/2 + tilePositionOffset[tilePosition].y;
 
-            if( (strictmath::abs((float)wantedReal.x - (realX-bumpyOffsetX)) <= strictmath::abs(xSpeed)/2 + epsilon)
-                && (strictmath::abs((float)wantedReal.y - (realY-bumpyOffsetY)) <= strictmath::abs(ySpeed)/2 + epsilon) ) {
+            if( (FixPoint::abs(wantedReal.x - (realX-bumpyOffsetX)) <= FixPoint::abs(xSpeed)/2 + epsilon)
+                && (FixPoint::abs(wantedReal.y - (realY-bumpyOffsetY)) <= FixPoint::abs(ySpeed)/2 + epsilon) ) {
                 realX = wantedReal.x;
                 realY = wantedReal.y;
-                bumpyOffsetX = 0.0f;
-                bumpyOffsetY = 0.0f;
+                bumpyOffsetX = 0;
+                bumpyOffsetY = 0;
 
                 if(forced && (location == destination) && !target) {
                     setForced(false);
@@ -481,7 +480,7 @@ void InfantryBase::setSpeeds() {
 		dx -= sx;
 		dy -= sy;
 
-		float scale = currentGame->objectData.data[itemID][originalHouseID].maxspeed/std::sqrt((float)(dx*dx + dy*dy));
+		FixPoint scale = currentGame->objectData.data[itemID][originalHouseID].maxspeed/FixPoint::hypot(dx, dy);
 		xSpeed = dx*scale;
 		ySpeed = dy*scale;
 	}
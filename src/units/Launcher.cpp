@@ -93,7 +93,7 @@ void Launcher::blitToScreen() {
 
 void Launcher::destroy() {
     if(currentGameMap->tileExists(location) && isVisible()) {
-        Coord realPos(lround(realX), lround(realY));
+        Coord realPos(realX.roundToInt(), realY.roundToInt());
         Uint32 explosionID = currentGame->randomGen.getRandOf(3,Explosion_Medium1, Explosion_Medium2,Explosion_Flames);
         currentGame->getExplosionList().push_back(new Explosion(explosionID, realPos, owner->getHouseID()));
 
@@ -101,7 +101,7 @@ bool MCV::canAttack(const ObjectBase* object) const {
 
 void MCV::destroy() {
     if(currentGameMap->tileExists(location) && isVisible()) {
-        Coord realPos(lround(realX), lround(realY));
+        Coord realPos(realX.roundToInt(), realY.roundToInt());
         currentGame->getExplosionList().push_back(new Explosion(Explosion_SmallUnit, realPos, owner->getHouseID()));
 
         if(isVisible(getOwner()->getTeam()))
@@ -75,7 +75,7 @@ void Ornithopter::destroy() {
 	// place wreck
     if(currentGameMap->tileExists(location)) {
         Tile* pTile = currentGameMap->getTile(location);
-        pTile->assignDeadUnit(DeadUnit_Ornithopter, owner->getHouseID(), Coord(lround(realX), lround(realY)));
+        pTile->assignDeadUnit(DeadUnit_Ornithopter, owner->getHouseID(), Coord(realX.roundToInt(), realY.roundToInt()));
     }
 
 	AirUnit::destroy();
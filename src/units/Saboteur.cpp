@@ -138,7 +138,7 @@ bool Saboteur::canAttack(const ObjectBase* object) const {
 
 void Saboteur::destroy()
 {
-    Coord realPos(lround(realX), lround(realY));
+    Coord realPos(realX.roundToInt(), realY.roundToInt());
     Uint32 explosionID = currentGame->randomGen.getRandOf(2,Explosion_Medium1, Explosion_Medium2);
     currentGame->getExplosionList().push_back(new Explosion(explosionID, realPos, owner->getHouseID()));
 
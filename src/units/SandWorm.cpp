@@ -224,13 +224,13 @@ void Sandworm::blitToScreen() {
 
 void Sandworm::checkPos() {
 	if(moving && !justStoppedMoving) {
-		if((abs(lround(realX) - lastLocs[0].x) >= 4) || (abs(lround(realY) - lastLocs[0].y) >= 4)) {
+		if((abs(realX.roundToInt() - lastLocs[0].x) >= 4) || (abs(realY.roundToInt() - lastLocs[0].y) >= 4)) {
 			for(int i = (SANDWORM_LENGTH-1); i > 0 ; i--) {
 				lastLocs[i] = lastLocs[i-1];
 			}
 
-			lastLocs[0].x = lround(realX);
-			lastLocs[0].y = lround(realY);
+			lastLocs[0].x = realX.roundToInt();
+			lastLocs[0].y = realY.roundToInt();
 		}
 	}
 
@@ -292,8 +292,8 @@ void Sandworm::setLocation(int xPos, int yPos) {
 		UnitBase::setLocation(xPos, yPos);
 
 		for(int i = 0; i < SANDWORM_LENGTH; i++) {
-			lastLocs[i].x = lround(realX);
-			lastLocs[i].y = lround(realY);
+			lastLocs[i].x = realX.roundToInt();
+			lastLocs[i].y = realY.roundToInt();
 		}
 	}
 }
@@ -360,7 +360,7 @@ bool Sandworm::update() {
                     if(drawnFrame == 1) {
                         // the close mouth bit of graphic is currently shown => eat unit
                         bool wasAlive = ( target && target.getObjPointer()->isVisible(getOwner()->getTeam()));	//see if unit was alive before attack
-                        Coord realPos = Coord(lround(realX), lround(realY));
+                        Coord realPos = Coord(realX.roundToInt(), realY.roundToInt());
                         currentGameMap->damage(objectID, getOwner(), realPos, Bullet_Sandworm, 5000, NONE, false);
 
                         if(wasAlive && (target.getObjPointer()->isVisible(getOwner()->getTeam()) == false)) {
@@ -432,7 +432,7 @@ const ObjectBase* Sandworm::findTarget() const {
 	if(attackMode == HUNT) {
 	    float closestDistance = INFINITY;
 
-        RobustList<UnitBase*>::const_iterator iter;
+        DenseList<UnitBase*>::const_iterator iter;
 	    for(iter = unitList.begin(); iter != unitList.end(); ++iter) {
 			UnitBase* tempUnit = *iter;
             if (canAttack(tempUnit)
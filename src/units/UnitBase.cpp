@@ -32,6 +32,7 @@
 #include <misc/draw_util.h>
 
 #include <AStarSearch.h>
+#include <PathClusterGraph.h>
 
 #include <GUI/ObjectInterfaces/UnitInterface.h>
 
@@ -60,10 +61,10 @@ UnitBase::UnitBase(House* newOwner) : ObjectBase(newOwner) {
     moving = false;
     turning = false;
     justStoppedMoving = false;
-    xSpeed = 0.0f;
-    ySpeed = 0.0f;
-    bumpyOffsetX = 0.0f;
-    bumpyOffsetY = 0.0f;
+    xSpeed = 0;
+    ySpeed = 0;
+    bumpyOffsetX = 0;
+    bumpyOffsetY = 0;
 
     targetDistance = 0.0f;
 	targetAngle = INVALID;
@@ -92,10 +93,10 @@ UnitBase::UnitBase(InputStream& stream) : ObjectBase(stream) {
 	attackPos.y = stream.readSint32();
 
 	stream.readBools(&moving, &turning, &justStoppedMoving);
-	xSpeed = stream.readFloat();
-	ySpeed = stream.readFloat();
-	bumpyOffsetX = stream.readFloat();
-	bumpyOffsetY = stream.readFloat();
+	xSpeed = stream.readFixPoint();
+	ySpeed = stream.readFixPoint();
+	bumpyOffsetX = stream.readFixPoint();
+	bumpyOffsetY = stream.readFixPoint();
 
 	targetDistance = stream.readFloat();
 	targetAngle = stream.readSint8();
@@ -152,10 +153,10 @@ void UnitBase::save(OutputStream& stream) const {
 	stream.writeSint32(attackPos.y);
 
 	stream.writeBools(moving, turning, justStoppedMoving);
-	stream.writeFloat(xSpeed);
-	stream.writeFloat(ySpeed);
-	stream.writeFloat(bumpyOffsetX);
-	stream.writeFloat(bumpyOffsetY);
+	stream.writeFixPoint(xSpeed);
+	stream.writeFixPoint(ySpeed);
+	stream.writeFixPoint(bumpyOffsetX);
+	stream.writeFixPoint(bumpyOffsetY);
 
 	stream.writeFloat(targetDistance);
 	stream.writeSint8(targetAngle);
@@ -309,6 +310,7 @@ void UnitBase::destroy() {
                 // deviation is inherited
                 pNewUnit->owner = owner;
                 pNewUnit->graphic = pGFXManager->getObjPic(pNewUnit->graphicID,owner->getHouseID());
+                currentGameMap->getRadarTileTracker().setTileDirty(pNewUnit->location);
                 pNewUnit->deviationTimer = deviationTimer;
             }
         }
@@ -332,6 +334,10 @@ void UnitBase::deviate(House* newOwner) {
 
         graphic = pGFXManager->getObjPic(graphicID,getOwner()->getHouseID());
         deviationTimer = DEVIATIONTIME;
+
+        // the radar color of this unit has changed
+        currentGameMap->getRadarTileTracker().setTileDirty(location);
+        currentGameMap->getRadarTileTracker().setTileDirty(nextSpot);
     }
 }
 
@@ -514,17 +520,17 @@ void UnitBase::move() {
 		}
 
 		// check if vehicle is on the first half of the way
-		float fromDistanceX;
-		float fromDistanceY;
-		float toDistanceX;
-		float toDistanceY;
+		FixPoint fromDistanceX;
+		FixPoint fromDistanceY;
+		FixPoint toDistanceX;
+		FixPoint toDistanceY;
 		if(location != nextSpot) {
 		    // check if vehicle is half way out of old tile
 
-		    fromDistanceX = strictmath::abs(location.x*TILESIZE - (realX-bumpyOffsetX) + TILESIZE/2);
-		    fromDistanceY = strictmath::abs(location.y*TILESIZE - (realY-bumpyOffsetY) + TILESIZE/2);
-		    toDistanceX = strictmath::abs(nextSpot.x*TILESIZE - (realX-bumpyOffsetX) + TILESIZE/2);
-		    toDistanceY = strictmath::abs(nextSpot.y*TILESIZE - (realY-bumpyOffsetY) + TILESIZE/2);
+		    fromDistanceX = FixPoint::abs(location.x*TILESIZE - (realX-bumpyOffsetX) + TILESIZE/2);
+		    fromDistanceY = FixPoint::abs(location.y*TILESIZE - (realY-bumpyOffsetY) + TILESIZE/2);
+		    toDistanceX = FixPoint::abs(nextSpot.x*TILESIZE - (realX-bumpyOffsetX) + TILESIZE/2);
+		    toDistanceY = FixPoint::abs(nextSpot.y*TILESIZE - (realY-bumpyOffsetY) + TILESIZE/2);
 
             if((fromDistanceX >= TILESIZE/2) || (fromDistanceY >= TILESIZE/2)) {
                 // let something else go in
@@ -540,10 +546,10 @@ void UnitBase::move() {
 		} else {
 			// if vehicle is out of old tile
 
-			fromDistanceX = strictmath::abs(oldLocation.x*TILESIZE - (realX-bumpyOffsetX) + TILESIZE/2);
-		    fromDistanceY = strictmath::abs(oldLocation.y*TILESIZE - (realY-bumpyOffsetY) + TILESIZE/2);
-		    toDistanceX = strictmath::abs(location.x*TILESIZE - (realX-bumpyOffsetX) + TILESIZE/2);
-		    toDistanceY = strictmath::abs(location.y*TILESIZE - (realY-bumpyOffsetY) + TILESIZE/2);
+			fromDistanceX = FixPoint::abs(oldLocation.x*TILESIZE - (realX-bumpyOffsetX) + TILESIZE/2);
+		    fromDistanceY = FixPoint::abs(oldLocation.y*TILESIZE - (realY-bumpyOffsetY) + TILESIZE/2);
+		    toDistanceX = FixPoint::abs(location.x*TILESIZE - (realX-bumpyOffsetX) + TILESIZE/2);
+		    toDistanceY = FixPoint::abs(location.y*TILESIZE - (realY-bumpyOffsetY) + TILESIZE/2);
 
 			if ((fromDistanceX >= TILESIZE) || (fromDistanceY >= TILESIZE)) {
 
@@ -555,8 +561,8 @@ void UnitBase::move() {
 				justStoppedMoving = true;
 				realX = location.x * TILESIZE + TILESIZE/2;
                 realY = location.y * TILESIZE + TILESIZE/2;
-                bumpyOffsetX = 0.0f;
-                bumpyOffsetY = 0.0f;
+                bumpyOffsetX = 0;
+                bumpyOffsetY = 0;
 
                 oldLocation.invalidate();
 			}
@@ -572,44 +578,44 @@ void UnitBase::move() {
 	checkPos();
 }
 
-void UnitBase::bumpyMovementOnRock(float fromDistanceX, float fromDistanceY, float toDistanceX, float toDistanceY) {
+void UnitBase::bumpyMovementOnRock(FixPoint fromDistanceX, FixPoint fromDistanceY, FixPoint toDistanceX, FixPoint toDistanceY) {
 
     if(hasBumpyMovementOnRock() && ((currentGameMap->getTile(location)->getType() == Terrain_Rock)
                                     || (currentGameMap->getTile(location)->getType() == Terrain_Mountain)
                                     || (currentGameMap->getTile(location)->getType() == Terrain_ThickSpice))) {
         // bumping effect
 
-        const float epsilon = 0.005f;
-        const float bumpyOffset = 2.5f;
-        const float absXSpeed = strictmath::abs(xSpeed);
-        const float absYSpeed = strictmath::abs(ySpeed);
+        const FixPoint epsilon = FixPoint::fromFloat(0.005f);
+        const FixPoint bumpyOffset = FixPoint::fromFloat(2.5f);
+        const FixPoint absXSpeed = FixPoint::abs(xSpeed);
+        const FixPoint absYSpeed = FixPoint::abs(ySpeed);
 
 
-        if((strictmath::abs(xSpeed) >= epsilon) && (strictmath::abs(fromDistanceX - absXSpeed) < absXSpeed/2)) { realY -= bumpyOffset; bumpyOffsetY -= bumpyOffset; }
-        if((strictmath::abs(ySpeed) >= epsilon) && (strictmath::abs(fromDistanceY - absYSpeed) < absYSpeed/2)) { realX += bumpyOffset; bumpyOffsetX += bumpyOffset; }
+        if((FixPoint::abs(xSpeed) >= epsilon) && (FixPoint::abs(fromDistanceX - absXSpeed) < absXSpeed/2)) { realY -= bumpyOffset; bumpyOffsetY -= bumpyOffset; }
+        if((FixPoint::abs(ySpeed) >= epsilon) && (FixPoint::abs(fromDistanceY - absYSpeed) < absYSpeed/2)) { realX += bumpyOffset; bumpyOffsetX += bumpyOffset; }
 
-        if((strictmath::abs(xSpeed) >= epsilon) && (strictmath::abs(fromDistanceX - 4*absXSpeed) < absXSpeed/2)) { realY += bumpyOffset; bumpyOffsetY += bumpyOffset; }
-        if((strictmath::abs(ySpeed) >= epsilon) && (strictmath::abs(fromDistanceY - 4*absYSpeed) < absYSpeed/2)) { realX -= bumpyOffset; bumpyOffsetX -= bumpyOffset; }
+        if((FixPoint::abs(xSpeed) >= epsilon) && (FixPoint::abs(fromDistanceX - 4*absXSpeed) < absXSpeed/2)) { realY += bumpyOffset; bumpyOffsetY += bumpyOffset; }
+        if((FixPoint::abs(ySpeed) >= epsilon) && (FixPoint::abs(fromDistanceY - 4*absYSpeed) < absYSpeed/2)) { realX -= bumpyOffset; bumpyOffsetX -= bumpyOffset; }
 
 
-        if((strictmath::abs(xSpeed) >= epsilon) && (strictmath::abs(fromDistanceX - 10*absXSpeed) < absXSpeed/2)) { realY -= bumpyOffset; bumpyOffsetY -= bumpyOffset; }
-        if((strictmath::abs(ySpeed) >= epsilon) && (strictmath::abs(fromDistanceY - 20*absYSpeed) < absYSpeed/2)) { realX += bumpyOffset; bumpyOffsetX += bumpyOffset; }
+        if((FixPoint::abs(xSpeed) >= epsilon) && (FixPoint::abs(fromDistanceX - 10*absXSpeed) < absXSpeed/2)) { realY -= bumpyOffset; bumpyOffsetY -= bumpyOffset; }
+        if((FixPoint::abs(ySpeed) >= epsilon) && (FixPoint::abs(fromDistanceY - 20*absYSpeed) < absYSpeed/2)) { realX += bumpyOffset; bumpyOffsetX += bumpyOffset; }
 
-        if((strictmath::abs(xSpeed) >= epsilon) && (strictmath::abs(fromDistanceX - 14*absXSpeed) < absXSpeed/2)) { realY += bumpyOffset; bumpyOffsetY += bumpyOffset; }
-        if((strictmath::abs(ySpeed) >= epsilon) && (strictmath::abs(fromDistanceY - 14*absYSpeed) < absYSpeed/2)) { realX -= bumpyOffset; bumpyOffsetX -= bumpyOffset; }
+        if((FixPoint::abs(xSpeed) >= epsilon) && (FixPoint::abs(fromDistanceX - 14*absXSpeed) < absXSpeed/2)) { realY += bumpyOffset; bumpyOffsetY += bumpyOffset; }
+        if((FixPoint::abs(ySpeed) >= epsilon) && (FixPoint::abs(fromDistanceY - 14*absYSpeed) < absYSpeed/2)) { realX -= bumpyOffset; bumpyOffsetX -= bumpyOffset; }
 
 
-        if((strictmath::abs(xSpeed) >= epsilon) && (strictmath::abs(toDistanceX - absXSpeed) < absXSpeed/2)) { realY -= bumpyOffset; bumpyOffsetY -= bumpyOffset; }
-        if((strictmath::abs(ySpeed) >= epsilon) && (strictmath::abs(toDistanceY - absYSpeed) < absYSpeed/2)) { realX += bumpyOffset; bumpyOffsetX += bumpyOffset; }
+        if((FixPoint::abs(xSpeed) >= epsilon) && (FixPoint::abs(toDistanceX - absXSpeed) < absXSpeed/2)) { realY -= bumpyOffset; bumpyOffsetY -= bumpyOffset; }
+        if((FixPoint::abs(ySpeed) >= epsilon) && (FixPoint::abs(toDistanceY - absYSpeed) < absYSpeed/2)) { realX += bumpyOffset; bumpyOffsetX += bumpyOffset; }
 
-        if((strictmath::abs(xSpeed) >= epsilon) && (strictmath::abs(toDistanceX - 4*absXSpeed) < absXSpeed/2)) { realY += bumpyOffset; bumpyOffsetY += bumpyOffset; }
-        if((strictmath::abs(ySpeed) >= epsilon) && (strictmath::abs(toDistanceY - 4*absYSpeed) < absYSpeed/2)) { realX -= bumpyOffset; bumpyOffsetX -= bumpyOffset; }
+        if((FixPoint::abs(xSpeed) >= epsilon) && (FixPoint::abs(toDistanceX - 4*absXSpeed) < absXSpeed/2)) { realY += bumpyOffset; bumpyOffsetY += bumpyOffset; }
+        if((FixPoint::abs(ySpeed) >= epsilon) && (FixPoint::abs(toDistanceY - 4*absYSpeed) < absYSpeed/2)) { realX -= bumpyOffset; bumpyOffsetX -= bumpyOffset; }
 
-        if((strictmath::abs(xSpeed) >= epsilon) && (strictmath::abs(toDistanceX - 10*absXSpeed) < absXSpeed/2)) { realY -= bumpyOffset; bumpyOffsetY -= bumpyOffset; }
-        if((strictmath::abs(ySpeed) >= epsilon) && (strictmath::abs(toDistanceY - 10*absYSpeed) < absYSpeed/2)) { realX += bumpyOffset; bumpyOffsetX += bumpyOffset; }
+        if((FixPoint::abs(xSpeed) >= epsilon) && (FixPoint::abs(toDistanceX - 10*absXSpeed) < absXSpeed/2)) { realY -= bumpyOffset; bumpyOffsetY -= bumpyOffset; }
+        if((FixPoint::abs(ySpeed) >= epsilon) && (FixPoint::abs(toDistanceY - 10*absYSpeed) < absYSpeed/2)) { realX += bumpyOffset; bumpyOffsetX += bumpyOffset; }
 
-        if((strictmath::abs(xSpeed) >= epsilon) && (strictmath::abs(toDistanceX - 14*absXSpeed) < absXSpeed/2)) { realY += bumpyOffset; bumpyOffsetY += bumpyOffset; }
-        if((strictmath::abs(ySpeed) >= epsilon) && (strictmath::abs(toDistanceY - 14*absYSpeed) < absYSpeed/2)) { realX -= bumpyOffset; bumpyOffsetX -= bumpyOffset; }
+        if((FixPoint::abs(xSpeed) >= epsilon) && (FixPoint::abs(toDistanceX - 14*absXSpeed) < absXSpeed/2)) { realY += bumpyOffset; bumpyOffsetY += bumpyOffset; }
+        if((FixPoint::abs(ySpeed) >= epsilon) && (FixPoint::abs(toDistanceY - 14*absYSpeed) < absYSpeed/2)) { realX -= bumpyOffset; bumpyOffsetX -= bumpyOffset; }
 
     }
 }
@@ -1006,8 +1012,8 @@ void UnitBase::setLocation(int xPos, int yPos) {
 		ObjectBase::setLocation(xPos, yPos);
 		realX += TILESIZE/2;
 		realY += TILESIZE/2;
-		bumpyOffsetX = 0.0f;
-		bumpyOffsetY = 0.0f;
+		bumpyOffsetX = 0;
+		bumpyOffsetY = 0;
 	}
 
 	moving = false;
@@ -1048,29 +1054,36 @@ void UnitBase::setPickedUp(UnitBase* newCarrier) {
 	clearPath();
 }
 
-float UnitBase::getMaxSpeed() const {
+FixPoint UnitBase::getMaxSpeed() const {
     return currentGame->objectData.data[itemID][originalHouseID].maxspeed;
 }
 
 void UnitBase::setSpeeds() {
-	float speed = getMaxSpeed();
+	FixPoint speed = getMaxSpeed();
 
 	if(!isAFlyingUnit()) {
-		speed += speed*(1.0f - getTerrainDifficulty((TERRAINTYPE) currentGameMap->getTile(location)->getType()));
+		// the difficulty is a constant of the unit type; converting it is exact and calculating with it is done in FixPoint
+		speed += speed*(1 - FixPoint::fromFloat(getTerrainDifficulty((TERRAINTYPE) currentGameMap->getTile(location)->getType())));
 		if(isBadlyDamaged()) {
-            speed *= HEAVILYDAMAGEDSPEEDMULTIPLIER;
+            speed *= FixPoint::fromFloat(HEAVILYDAMAGEDSPEEDMULTIPLIER);
 		}
 	}
 
+	setSpeedsForDrawnAngle(speed);
+}
+
+void UnitBase::setSpeedsForDrawnAngle(FixPoint speed) {
+	const FixPoint diagonalSpeed = speed*FixPoint::fromFloat(DIAGONALSPEEDCONST);
+
 	switch(drawnAngle){
-        case LEFT:      xSpeed = -speed;                    ySpeed = 0;         break;
-        case LEFTUP:    xSpeed = -speed*DIAGONALSPEEDCONST; ySpeed = xSpeed;    break;
-        case UP:        xSpeed = 0;                         ySpeed = -speed;    break;
-        case RIGHTUP:   xSpeed = speed*DIAGONALSPEEDCONST;  ySpeed = -xSpeed;   break;
-        case RIGHT:     xSpeed = speed;                     ySpeed = 0;         break;
-        case RIGHTDOWN: xSpeed = speed*DIAGONALSPEEDCONST;  ySpeed = xSpeed;    break;
-        case DOWN:      xSpeed = 0;                         ySpeed = speed;     break;
-        case LEFTDOWN:  xSpeed = -speed*DIAGONALSPEEDCONST; ySpeed = -xSpeed;   break;
+        case LEFT:      xSpeed = -speed;            ySpeed = 0;         break;
+        case LEFTUP:    xSpeed = -diagonalSpeed;    ySpeed = xSpeed;    break;
+        case UP:        xSpeed = 0;                 ySpeed = -speed;    break;
+        case RIGHTUP:   xSpeed = diagonalSpeed;     ySpeed = -xSpeed;   break;
+        case RIGHT:     xSpeed = speed;             ySpeed = 0;         break;
+        case RIGHTDOWN: xSpeed = diagonalSpeed;     ySpeed = xSpeed;    break;
+        case DOWN:      xSpeed = 0;                 ySpeed = speed;     break;
+        case LEFTDOWN:  xSpeed = -diagonalSpeed;    ySpeed = -xSpeed;   break;
 	}
 }
 
@@ -1195,6 +1208,10 @@ void UnitBase::quitDeviation() {
         owner = currentGame->getHouse(originalHouseID);
         graphic = pGFXManager->getObjPic(graphicID,getOwner()->getHouseID());
         deviationTimer = INVALID;
+
+        // the radar color of this unit has changed
+        currentGameMap->getRadarTileTracker().setTileDirty(location);
+        currentGameMap->getRadarTileTracker().setTileDirty(nextSpot);
     }
 }
 
@@ -1251,6 +1268,21 @@ bool UnitBase::SearchPathWithAStar() {
 		destinationCoord = destination;
 	}
 
+	if(!isAFlyingUnit() && (blockDistance(location, destinationCoord) > 2*PATHCLUSTERSIZE)) {
+        // the destination is far away => only search the path to the first waypoint outside the current cluster
+        PathClusterGraph& pathClusterGraph = currentGameMap->getPathClusterGraph();
+        std::vector<Coord> waypoints;
+        if(pathClusterGraph.findAbstractPath(this, location, destinationCoord, waypoints)) {
+            int currentCluster = pathClusterGraph.getClusterIndex(location);
+            for(std::vector<Coord>::const_iterator iter = waypoints.begin(); iter != waypoints.end(); ++iter) {
+                if(pathClusterGraph.getClusterIndex(*iter) != currentCluster) {
+                    destinationCoord = *iter;
+                    break;
+                }
+            }
+        }
+	}
+
 	AStarSearch pathfinder(currentGameMap, this, location, destinationCoord);
 	pathList = pathfinder.getFoundPath();
 
@@ -0,0 +1,168 @@
+#include "FixPointTestCase.h"
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <fstream>
+#include <sstream>
+#include <math.h>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(FixPointTestCase);
+
+
+void FixPointTestCase::setUp() {
+
+}
+
+void FixPointTestCase::tearDown() {
+
+}
+
+void FixPointTestCase::testSinCos() {
+	std::vector<std::vector<int> > referenceData = loadReferenceData(TESTSRC "/FixPointTestCase/sincos.ref", 3);
+
+	CPPUNIT_ASSERT_MESSAGE("no reference data", referenceData.empty() == false);
+
+	std::vector<std::vector<int> >::iterator iter;
+	for(iter = referenceData.begin(); iter != referenceData.end(); ++iter) {
+		FixPoint angle = FixPoint::fromRaw((*iter)[0]);
+		FixPoint resultSin = FixPoint::sin(angle);
+		FixPoint resultCos = FixPoint::cos(angle);
+
+		// the simulation depends on the exact results
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("sin(" + int2String(angle.getRaw()) + ")", (*iter)[1], (int) resultSin.getRaw());
+		CPPUNIT_ASSERT_EQUAL_MESSAGE("cos(" + int2String(angle.getRaw()) + ")", (*iter)[2], (int) resultCos.getRaw());
+
+		// and they must be close to the real values
+		double radians = angle.getRaw() / (double) FIXPOINT_ONE * 2.0 * M_PI / 256.0;
+		CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("sin(" + int2String(angle.getRaw()) + ")", ::sin(radians), resultSin.getRaw() / (double) FIXPOINT_ONE, 8.0 / FIXPOINT_ONE);
+		CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("cos(" + int2String(angle.getRaw()) + ")", ::cos(radians), resultCos.getRaw() / (double) FIXPOINT_ONE, 8.0 / FIXPOINT_ONE);
+	}
+}
+
+void FixPointTestCase::testAtan2() {
+	std::vector<std::vector<int> > referenceData = loadReferenceData(TESTSRC "/FixPointTestCase/atan2.ref", 3);
+
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("number of vectors", (size_t) 33*33, referenceData.size());
+
+	std::vector<std::vector<int> >::iterator iter;
+	for(iter = referenceData.begin(); iter != referenceData.end(); ++iter) {
+		int y = (*iter)[0];
+		int x = (*iter)[1];
+		std::string message = "atan2(" + int2String(y) + ", " + int2String(x) + ")";
+
+		FixPoint result = FixPoint::atan2(y, x);
+
+		CPPUNIT_ASSERT_EQUAL_MESSAGE(message, (*iter)[2], (int) result.getRaw());
+
+		CPPUNIT_ASSERT_MESSAGE(message, (result >= 0) && (result < 256));
+
+		if((x != 0) || (y != 0)) {
+			double angle = ::atan2((double) y, (double) x) / (2.0 * M_PI) * 256.0;
+			if(angle < 0.0) {
+				angle += 256.0;
+			}
+
+			double difference = fabs(angle - result.getRaw() / (double) FIXPOINT_ONE);
+			if(difference > 128.0) {
+				// e.g. 255.9999 and 0
+				difference = 256.0 - difference;
+			}
+
+			CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(message, 0.0, difference, 1.0/1024.0);
+		}
+	}
+}
+
+void FixPointTestCase::testSqrt() {
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("sqrt(0)", (int) FixPoint(0).getRaw(), (int) FixPoint::sqrt(0).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("sqrt(-1)", (int) FixPoint(0).getRaw(), (int) FixPoint::sqrt(-1).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("sqrt(4)", (int) FixPoint(2).getRaw(), (int) FixPoint::sqrt(4).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("sqrt(1024)", (int) FixPoint(32).getRaw(), (int) FixPoint::sqrt(1024).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("sqrt(2)", 92681, (int) FixPoint::sqrt(2).getRaw());
+
+	// the result r must be the largest raw value with r*r <= x*65536
+	for(Sint64 raw = 1; raw <= 0x7FFFFFFF; raw = raw*3/2 + 1) {
+		Sint64 square = raw << FIXPOINT_FRACBITS;
+		Sint64 result = FixPoint::sqrt(FixPoint::fromRaw((Sint32) raw)).getRaw();
+
+		CPPUNIT_ASSERT_MESSAGE("sqrt(" + int2String((int) raw) + "/65536)", (result*result <= square) && ((result+1)*(result+1) > square));
+	}
+}
+
+void FixPointTestCase::testHypot() {
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("hypot(0, 0)", (int) FixPoint(0).getRaw(), (int) FixPoint::hypot(0, 0).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("hypot(3, 4)", (int) FixPoint(5).getRaw(), (int) FixPoint::hypot(3, 4).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("hypot(-3, 4)", (int) FixPoint(5).getRaw(), (int) FixPoint::hypot(-3, 4).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("hypot(3, -4)", (int) FixPoint(5).getRaw(), (int) FixPoint::hypot(3, -4).getRaw());
+
+	// large values must not overflow
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("hypot(30000, 0)", (int) FixPoint(30000).getRaw(), (int) FixPoint::hypot(30000, 0).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("hypot(18000, 24000)", (int) FixPoint(30000).getRaw(), (int) FixPoint::hypot(18000, 24000).getRaw());
+
+	// the result r must be the largest raw value with r*r <= x*x + y*y
+	for(Sint64 x = -0x40000000; x <= 0x40000000; x += 0x1234567) {
+		Sint64 y = 0x40000000 - (x < 0 ? -x : x) / 2;
+		Uint64 sum = (Uint64) (x*x) + (Uint64) (y*y);
+		Uint64 result = FixPoint::hypot(FixPoint::fromRaw((Sint32) x), FixPoint::fromRaw((Sint32) y)).getRaw();
+
+		CPPUNIT_ASSERT_MESSAGE("hypot(" + int2String((int) x) + "/65536, " + int2String((int) y) + "/65536)", (result*result <= sum) && ((result+1)*(result+1) > sum));
+	}
+}
+
+void FixPointTestCase::testRounding() {
+	const float values[] = { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f, 1.5f, 2.4999847f, 2.5f, 100.5f, 32767.5f };
+
+	for(unsigned int i = 0; i < sizeof(values)/sizeof(values[0]); i++) {
+		for(int sign = -1; sign <= 1; sign += 2) {
+			float value = sign*values[i];
+			FixPoint x = FixPoint::fromFloat(value);
+
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("fromFloat(" + int2String(x.getRaw()) + "/65536)", value, x.toFloat());
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("toInt(" + int2String(x.getRaw()) + "/65536)", (int) value, x.toInt());
+			CPPUNIT_ASSERT_EQUAL_MESSAGE("roundToInt(" + int2String(x.getRaw()) + "/65536)", (int) lroundf(value), x.roundToInt());
+		}
+	}
+
+	// fromFloat() rounds to the nearest raw value
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("fromFloat(0.1f)", 6554, (int) FixPoint::fromFloat(0.1f).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("fromFloat(-0.1f)", -6554, (int) FixPoint::fromFloat(-0.1f).getRaw());
+
+	// multiplication and division truncate the raw result like the simulation expects
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("0.5 * 0.5", (int) FixPoint::fromFloat(0.25f).getRaw(), (int) (FixPoint::fromFloat(0.5f) * FixPoint::fromFloat(0.5f)).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("1 / 3", 21845, (int) (FixPoint(1) / FixPoint(3)).getRaw());
+	CPPUNIT_ASSERT_EQUAL_MESSAGE("-1 / 3", -21845, (int) (FixPoint(-1) / FixPoint(3)).getRaw());
+}
+
+std::vector<std::vector<int> > FixPointTestCase::loadReferenceData(std::string filename, unsigned int numColumns) {
+	std::vector<std::vector<int> > referenceData;
+
+	std::ifstream file(filename.c_str());
+	std::string completeline;
+	while(std::getline(file, completeline)) {
+		if(completeline.empty()) {
+			continue;
+		}
+
+		if(completeline.at(0) == '#') {
+			// comment
+			continue;
+		}
+
+		std::istringstream linestream(completeline);
+
+		std::vector<int> row(numColumns);
+		for(unsigned int i = 0; i < numColumns; i++) {
+			linestream >> row[i];
+		}
+
+		referenceData.push_back(row);
+	}
+
+	return referenceData;
+}
+
+std::string FixPointTestCase::int2String(int x) {
+	std::ostringstream os;
+	os << x;
+	return os.str();
+}
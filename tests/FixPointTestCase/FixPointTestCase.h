@@ -0,0 +1,34 @@
+#include <misc/FixPoint.h>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <string>
+#include <vector>
+
+class FixPointTestCase: public CppUnit::TestFixture  {
+
+	CPPUNIT_TEST_SUITE(FixPointTestCase);
+
+	CPPUNIT_TEST(testSinCos);
+	CPPUNIT_TEST(testAtan2);
+	CPPUNIT_TEST(testSqrt);
+	CPPUNIT_TEST(testHypot);
+	CPPUNIT_TEST(testRounding);
+
+	CPPUNIT_TEST_SUITE_END();
+
+public:
+	void setUp();
+	void tearDown();
+
+	void testSinCos();
+	void testAtan2();
+	void testSqrt();
+	void testHypot();
+	void testRounding();
+
+private:
+	std::vector<std::vector<int> > loadReferenceData(std::string filename, unsigned int numColumns);
+
+	std::string int2String(int x);
+};